@@ -6,7 +6,9 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <random>
+#include <vector>
 
 namespace
 {
@@ -266,6 +268,54 @@ namespace
     {
         setToBoundedNonEmptyCache<64 * 1024 * 1024>(state);
     }
+
+    // Each thread either gets an item from the cache or sets it on miss like async navmesh updater workers do
+    template <std::size_t maxCacheSize, int hitPercentage>
+    void getOrSetFromMultipleThreads(benchmark::State& state)
+    {
+        struct Shared
+        {
+            NavMeshTilesCache mCache{ maxCacheSize };
+            std::vector<Key> mKeys;
+        };
+
+        static std::unique_ptr<Shared> shared;
+
+        // All threads wait for each other before first iteration and after the last one
+        if (state.thread_index() == 0)
+        {
+            shared = std::make_unique<Shared>();
+            std::minstd_rand random;
+            fillCache(std::back_inserter(shared->mKeys), random, shared->mCache);
+            generateKeys(std::back_inserter(shared->mKeys), shared->mKeys.size() * (100 - hitPercentage) / 100, random);
+            std::shuffle(shared->mKeys.begin(), shared->mKeys.end(), random);
+        }
+
+        std::size_t n = static_cast<std::size_t>(state.thread_index()) * 7919;
+
+        for (auto _ : state)
+        {
+            const auto& key = shared->mKeys[n++ % shared->mKeys.size()];
+            auto result = shared->mCache.get(key.mAgentBounds, key.mTilePosition, key.mRecastMesh);
+            if (!result)
+                result = shared->mCache.set(
+                    key.mAgentBounds, key.mTilePosition, key.mRecastMesh, std::make_unique<PreparedNavMeshData>());
+            benchmark::DoNotOptimize(result);
+        }
+
+        if (state.thread_index() == 0)
+            shared.reset();
+    }
+
+    void getOrSetFromMultipleThreads_16m_100hit(benchmark::State& state)
+    {
+        getOrSetFromMultipleThreads<16 * 1024 * 1024, 100>(state);
+    }
+
+    void getOrSetFromMultipleThreads_16m_70hit(benchmark::State& state)
+    {
+        getOrSetFromMultipleThreads<16 * 1024 * 1024, 70>(state);
+    }
 } // namespace
 
 BENCHMARK(getFromFilledCache_1m_100hit);
@@ -280,5 +330,7 @@ BENCHMARK(setToBoundedNonEmptyCache_1m);
 BENCHMARK(setToBoundedNonEmptyCache_4m);
 BENCHMARK(setToBoundedNonEmptyCache_16m);
 BENCHMARK(setToBoundedNonEmptyCache_64m);
+BENCHMARK(getOrSetFromMultipleThreads_16m_100hit)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(getOrSetFromMultipleThreads_16m_70hit)->ThreadRange(1, 8)->UseRealTime();
 
 BENCHMARK_MAIN();
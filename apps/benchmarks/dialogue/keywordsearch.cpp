@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include "apps/openmw/mwdialogue/keywordsearch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Roughly the size of the journal at the end of the main quest with a few guilds done
+    constexpr std::size_t journalEntriesCount = 1500;
+    constexpr std::size_t wordsPerEntry = 60;
+    constexpr std::size_t vocabularySize = 2000;
+
+    std::vector<std::string> generateVocabulary(std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<std::size_t> length(2, 10);
+        std::uniform_int_distribution<int> letter('a', 'z');
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i < vocabularySize; ++i)
+        {
+            std::string& word = result.emplace_back(length(random), ' ');
+            for (char& c : word)
+                c = static_cast<char>(letter(random));
+        }
+        return result;
+    }
+
+    std::vector<std::string> generateTopics(
+        const std::vector<std::string>& vocabulary, std::size_t count, std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<std::size_t> words(1, 3);
+        std::uniform_int_distribution<std::size_t> word(0, vocabulary.size() - 1);
+        std::set<std::string> result;
+        while (result.size() < count)
+        {
+            std::string topic = vocabulary[word(random)];
+            for (std::size_t i = 1, n = words(random); i < n; ++i)
+                topic += ' ' + vocabulary[word(random)];
+            result.insert(std::move(topic));
+        }
+        return { result.begin(), result.end() };
+    }
+
+    std::vector<std::string> generateJournal(const std::vector<std::string>& vocabulary, std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<std::size_t> word(0, vocabulary.size() - 1);
+        std::uniform_int_distribution<int> capital(0, 9);
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i < journalEntriesCount; ++i)
+        {
+            std::string& entry = result.emplace_back();
+            for (std::size_t j = 0; j < wordsPerEntry; ++j)
+            {
+                std::string value = vocabulary[word(random)];
+                if (capital(random) == 0)
+                    value[0] = static_cast<char>(value[0] - 'a' + 'A');
+                entry += value;
+                entry += j % 12 == 11 ? ". " : " ";
+            }
+        }
+        return result;
+    }
+
+    void seedKeywordSearch(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::vector<std::string> vocabulary = generateVocabulary(random);
+        const std::vector<std::string> topics
+            = generateTopics(vocabulary, static_cast<std::size_t>(state.range(0)), random);
+        const std::string text = "text";
+
+        for (auto _ : state)
+        {
+            MWDialogue::KeywordSearch<std::intptr_t> search;
+            for (std::size_t i = 0; i < topics.size(); ++i)
+                search.seed(topics[i], static_cast<std::intptr_t>(i));
+            search.buildLinks();
+            std::vector<MWDialogue::KeywordSearch<std::intptr_t>::Match> matches;
+            search.highlightKeywords(text.begin(), text.end(), matches);
+            benchmark::DoNotOptimize(matches);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void highlightJournalKeywords(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::vector<std::string> vocabulary = generateVocabulary(random);
+        const std::vector<std::string> topics
+            = generateTopics(vocabulary, static_cast<std::size_t>(state.range(0)), random);
+        const std::vector<std::string> journal = generateJournal(vocabulary, random);
+        MWDialogue::KeywordSearch<std::intptr_t> search;
+        for (std::size_t i = 0; i < topics.size(); ++i)
+            search.seed(topics[i], static_cast<std::intptr_t>(i));
+        search.buildLinks();
+        std::vector<MWDialogue::KeywordSearch<std::intptr_t>::Match> matches;
+
+        for (auto _ : state)
+        {
+            for (const std::string& entry : journal)
+            {
+                matches.clear();
+                search.highlightKeywords(entry.begin(), entry.end(), matches);
+                benchmark::DoNotOptimize(matches);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * journal.size());
+    }
+}
+
+BENCHMARK(seedKeywordSearch)->Arg(1000)->Arg(3000);
+BENCHMARK(highlightJournalKeywords)->Arg(1000)->Arg(3000);
+
+BENCHMARK_MAIN();
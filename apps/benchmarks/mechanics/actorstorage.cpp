@@ -0,0 +1,220 @@
+#include <benchmark/benchmark.h>
+
+#include "apps/openmw/mwmechanics/actorstorage.hpp"
+#include "components/misc/spatialhash.hpp"
+
+#include <osg/Vec3f>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Similar to the values used by MWMechanics::Actors::update
+    constexpr float processingRange = 7168;
+    constexpr float searchRadius = 200;
+    constexpr float cellSize = 256;
+    constexpr float areaSize = 3 * 8192;
+    constexpr std::size_t lookupsPerFrame = 64;
+
+    // Stands for the world data an actor Ptr refers to
+    struct Reference
+    {
+        osg::Vec3f mPosition;
+        osg::Vec3f mMovement;
+        float mMaxSpeed = 0;
+        bool mDead = false;
+        char mOther[256]{};
+    };
+
+    // Stands for MWMechanics::Actor holding a Ptr and a large CharacterController
+    struct Actor
+    {
+        explicit Actor(Reference* reference)
+            : mReference(reference)
+        {
+        }
+
+        Reference* mReference;
+        char mCharacterController[1024]{};
+    };
+
+    struct World
+    {
+        std::vector<std::unique_ptr<Reference>> mReferences;
+        // Keeps allocations of references and actors interleaved with unrelated ones like in the game
+        std::vector<std::unique_ptr<char[]>> mGarbage;
+        osg::Vec3f mPlayerPosition{ areaSize / 2, areaSize / 2, 0 };
+    };
+
+    World generateWorld(std::size_t count, std::minstd_rand& random)
+    {
+        std::uniform_real_distribution<float> position(0, areaSize);
+        std::uniform_real_distribution<float> movement(-1, 1);
+        std::uniform_int_distribution<std::size_t> garbageSize(16, 4096);
+        World result;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto reference = std::make_unique<Reference>();
+            reference->mPosition = osg::Vec3f(position(random), position(random), 0);
+            reference->mMovement = osg::Vec3f(movement(random), movement(random), 0);
+            reference->mMaxSpeed = 200;
+            reference->mDead = i % 10 == 0;
+            result.mReferences.push_back(std::move(reference));
+            result.mGarbage.push_back(std::make_unique<char[]>(garbageSize(random)));
+        }
+        std::shuffle(result.mReferences.begin(), result.mReferences.end(), random);
+        return result;
+    }
+
+    void moveReferences(World& world)
+    {
+        for (const std::unique_ptr<Reference>& reference : world.mReferences)
+            reference->mPosition += reference->mMovement * reference->mMaxSpeed * (1.0f / 60);
+    }
+
+    template <class Function>
+    void forEachLookup(const World& world, std::minstd_rand& random, Function&& function)
+    {
+        std::uniform_int_distribution<std::size_t> index(0, world.mReferences.size() - 1);
+        for (std::size_t i = 0; i < lookupsPerFrame; ++i)
+            function(world.mReferences[index(random)].get());
+    }
+
+    float predictCollision(const osg::Vec3f& relPos, const osg::Vec3f& relSpeed)
+    {
+        const float vr = relPos * relSpeed;
+        const float v2 = relSpeed.length2();
+        if (v2 == 0)
+            return 0;
+        return std::max(0.f, -vr / v2);
+    }
+
+    void listWithIndex(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        World world = generateWorld(static_cast<std::size_t>(state.range(0)), random);
+        std::list<Actor> actors;
+        std::map<const Reference*, std::list<Actor>::iterator> index;
+        for (const std::unique_ptr<Reference>& reference : world.mReferences)
+        {
+            index.emplace(reference.get(), actors.emplace(actors.end(), reference.get()));
+            world.mGarbage.push_back(std::make_unique<char[]>(512));
+        }
+        Misc::SpatialHash<const Actor*> grid(cellSize);
+        std::vector<const Actor*> neighbours;
+        std::size_t inRange = 0;
+        float sum = 0;
+
+        for (auto _ : state)
+        {
+            moveReferences(world);
+            // Processing range is checked by several passes over the actors
+            for (int pass = 0; pass < 3; ++pass)
+                for (const Actor& actor : actors)
+                    if (!actor.mReference->mDead
+                        && (actor.mReference->mPosition - world.mPlayerPosition).length2()
+                            <= processingRange * processingRange)
+                        ++inRange;
+            grid.clear();
+            for (const Actor& actor : actors)
+                grid.add(actor.mReference->mPosition, &actor);
+            for (const Actor& actor : actors)
+            {
+                const Reference& reference = *actor.mReference;
+                neighbours.clear();
+                grid.forEachInRange(
+                    reference.mPosition, searchRadius, [&](const Actor* other) { neighbours.push_back(other); });
+                const osg::Vec3f speed = reference.mMovement * reference.mMaxSpeed;
+                for (const Actor* other : neighbours)
+                {
+                    if (other == &actor)
+                        continue;
+                    const Reference& otherReference = *other->mReference;
+                    sum += predictCollision(otherReference.mPosition - reference.mPosition,
+                        otherReference.mMovement * otherReference.mMaxSpeed - speed);
+                }
+            }
+            forEachLookup(world, random, [&](const Reference* reference) {
+                const auto it = index.find(reference);
+                if (it != index.end())
+                    sum += it->second->mReference->mMaxSpeed;
+            });
+            benchmark::DoNotOptimize(inRange);
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    void actorStorage(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        World world = generateWorld(static_cast<std::size_t>(state.range(0)), random);
+        MWMechanics::ActorStorage<const Reference*, Actor> actors;
+        for (const std::unique_ptr<Reference>& reference : world.mReferences)
+        {
+            actors.emplace(reference.get(), reference.get());
+            world.mGarbage.push_back(std::make_unique<char[]>(512));
+        }
+        std::vector<osg::Vec3f> positions;
+        std::vector<osg::Vec3f> velocities;
+        std::vector<std::uint8_t> inProcessingRange;
+        Misc::SpatialHash<std::size_t> grid(cellSize);
+        std::vector<std::size_t> neighbours;
+        std::size_t inRange = 0;
+        float sum = 0;
+
+        for (auto _ : state)
+        {
+            moveReferences(world);
+            positions.resize(actors.getDenseSize());
+            velocities.resize(actors.getDenseSize());
+            inProcessingRange.resize(actors.getDenseSize());
+            // Hot data is filled once per frame
+            for (auto it = actors.begin(); it != actors.end(); ++it)
+            {
+                const Reference& reference = *it->mReference;
+                const std::size_t i = it.getIndex();
+                positions[i] = reference.mPosition;
+                velocities[i] = reference.mMovement * reference.mMaxSpeed;
+                inProcessingRange[i] = !reference.mDead
+                    && (reference.mPosition - world.mPlayerPosition).length2() <= processingRange * processingRange;
+            }
+            for (int pass = 0; pass < 3; ++pass)
+                for (std::size_t i = 0; i < inProcessingRange.size(); ++i)
+                    if (inProcessingRange[i])
+                        ++inRange;
+            grid.clear();
+            for (std::size_t i = 0; i < positions.size(); ++i)
+                grid.add(positions[i], i);
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                neighbours.clear();
+                grid.forEachInRange(
+                    positions[i], searchRadius, [&](std::size_t other) { neighbours.push_back(other); });
+                for (const std::size_t other : neighbours)
+                {
+                    if (other == i)
+                        continue;
+                    sum += predictCollision(positions[other] - positions[i], velocities[other] - velocities[i]);
+                }
+            }
+            forEachLookup(world, random, [&](const Reference* reference) {
+                if (const Actor* actor = actors.find(reference))
+                    sum += actor->mReference->mMaxSpeed;
+            });
+            benchmark::DoNotOptimize(inRange);
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+}
+
+BENCHMARK(listWithIndex)->Arg(100)->Arg(1000)->Arg(4000);
+BENCHMARK(actorStorage)->Arg(100)->Arg(1000)->Arg(4000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include "components/misc/spatialhash.hpp"
+
+#include <osg/Vec3f>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Similar to the distances used by MWMechanics::Actors::predictAndAvoidCollisions
+    constexpr float searchRadius = 200;
+    constexpr float cellSize = 256;
+    // Actors are spread over an area of a few exterior cells like a crowded town
+    constexpr float areaSize = 3 * 8192;
+
+    struct Actor
+    {
+        osg::Vec3f mPosition;
+        osg::Vec3f mVelocity;
+    };
+
+    std::vector<Actor> generateActors(std::size_t count)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> position(0, areaSize);
+        std::uniform_real_distribution<float> velocity(-200, 200);
+        std::vector<Actor> result(count);
+        for (Actor& actor : result)
+        {
+            actor.mPosition = osg::Vec3f(position(random), position(random), 0);
+            actor.mVelocity = osg::Vec3f(velocity(random), velocity(random), 0);
+        }
+        return result;
+    }
+
+    void moveActors(std::vector<Actor>& actors)
+    {
+        for (Actor& actor : actors)
+            actor.mPosition += actor.mVelocity * (1.0f / 60);
+    }
+
+    void bruteForce(benchmark::State& state)
+    {
+        std::vector<Actor> actors = generateActors(static_cast<std::size_t>(state.range(0)));
+        std::size_t found = 0;
+
+        for (auto _ : state)
+        {
+            moveActors(actors);
+            for (const Actor& actor : actors)
+                for (const Actor& other : actors)
+                    if (&other != &actor
+                        && (other.mPosition - actor.mPosition).length2() <= searchRadius * searchRadius)
+                        ++found;
+            benchmark::DoNotOptimize(found);
+        }
+
+        state.counters["found"] = benchmark::Counter(static_cast<double>(found), benchmark::Counter::kAvgIterations);
+    }
+
+    void spatialHash(benchmark::State& state)
+    {
+        std::vector<Actor> actors = generateActors(static_cast<std::size_t>(state.range(0)));
+        Misc::SpatialHash<const Actor*> grid(cellSize);
+        std::size_t found = 0;
+
+        for (auto _ : state)
+        {
+            moveActors(actors);
+            grid.clear();
+            for (const Actor& actor : actors)
+                grid.add(actor.mPosition, &actor);
+            for (const Actor& actor : actors)
+                grid.forEachInRange(actor.mPosition, searchRadius, [&](const Actor* other) {
+                    if (other != &actor)
+                        ++found;
+                });
+            benchmark::DoNotOptimize(found);
+        }
+
+        state.counters["found"] = benchmark::Counter(static_cast<double>(found), benchmark::Counter::kAvgIterations);
+    }
+}
+
+BENCHMARK(bruteForce)->Arg(100)->Arg(1000)->Arg(4000);
+BENCHMARK(spatialHash)->Arg(100)->Arg(1000)->Arg(4000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,354 @@
+#include <benchmark/benchmark.h>
+
+#include "components/misc/taskgraph.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t actorsCount = 500;
+    constexpr std::size_t obstaclesCount = 2000;
+    constexpr std::size_t stepsCount = 2;
+    constexpr float worldSize = 8192;
+    constexpr float cellSize = 256;
+    constexpr std::size_t gridSize = static_cast<std::size_t>(worldSize / cellSize);
+    constexpr float actorRadius = 32;
+    constexpr float timeStep = 1.0f / 60;
+
+    struct Vec3
+    {
+        float mX = 0;
+        float mY = 0;
+        float mZ = 0;
+    };
+
+    Vec3 operator+(const Vec3& l, const Vec3& r)
+    {
+        return Vec3{ l.mX + r.mX, l.mY + r.mY, l.mZ + r.mZ };
+    }
+
+    Vec3 operator-(const Vec3& l, const Vec3& r)
+    {
+        return Vec3{ l.mX - r.mX, l.mY - r.mY, l.mZ - r.mZ };
+    }
+
+    Vec3 operator*(const Vec3& v, float s)
+    {
+        return Vec3{ v.mX * s, v.mY * s, v.mZ * s };
+    }
+
+    struct Box
+    {
+        Vec3 mMin;
+        Vec3 mMax;
+    };
+
+    struct Actor
+    {
+        Vec3 mPosition;
+        Vec3 mVelocity;
+        Vec3 mTarget;
+        bool mOnGround = false;
+        bool mLineOfSight = false;
+    };
+
+    enum class Stage
+    {
+        PreStep,
+        Move,
+        PostStep,
+        LineOfSight,
+    };
+
+    constexpr std::array stageNames = { "PreStep", "Move", "PostStep", "LineOfSight" };
+
+    // Static obstacles bucketed into a uniform grid, stands in for Bullet broadphase
+    struct World
+    {
+        std::vector<Box> mObstacles;
+        std::vector<std::vector<std::size_t>> mCells;
+        std::vector<Actor> mActors;
+        Vec3 mPlayer;
+        std::atomic_size_t mNextActor{ 0 };
+        std::array<std::atomic<std::int64_t>, stageNames.size()> mStageTime{};
+
+        static std::size_t getCellIndex(float value)
+        {
+            return std::min(static_cast<std::size_t>(std::max(value, 0.0f) / cellSize), gridSize - 1);
+        }
+
+        template <class F>
+        void forEachObstacle(const Vec3& min, const Vec3& max, F&& f) const
+        {
+            for (std::size_t x = getCellIndex(min.mX), maxX = getCellIndex(max.mX); x <= maxX; ++x)
+                for (std::size_t y = getCellIndex(min.mY), maxY = getCellIndex(max.mY); y <= maxY; ++y)
+                    for (std::size_t index : mCells[x * gridSize + y])
+                        f(mObstacles[index]);
+        }
+    };
+
+    template <class Random>
+    void generateWorld(World& world, Random& random)
+    {
+        std::uniform_real_distribution<float> position(0, worldSize);
+        std::uniform_real_distribution<float> extent(16, 128);
+        world.mCells.resize(gridSize * gridSize);
+        for (std::size_t i = 0; i < obstaclesCount; ++i)
+        {
+            const Vec3 min{ position(random), position(random), 0 };
+            const Box box{ min, min + Vec3{ extent(random), extent(random), extent(random) } };
+            for (std::size_t x = World::getCellIndex(box.mMin.mX); x <= World::getCellIndex(box.mMax.mX); ++x)
+                for (std::size_t y = World::getCellIndex(box.mMin.mY); y <= World::getCellIndex(box.mMax.mY); ++y)
+                    world.mCells[x * gridSize + y].push_back(world.mObstacles.size());
+            world.mObstacles.push_back(box);
+        }
+        world.mActors.resize(actorsCount);
+        for (Actor& actor : world.mActors)
+        {
+            actor.mPosition = Vec3{ position(random), position(random), 64 };
+            actor.mTarget = Vec3{ position(random), position(random), 0 };
+        }
+        world.mPlayer = Vec3{ worldSize / 2, worldSize / 2, 64 };
+    }
+
+    bool intersects(const Box& box, const Vec3& center, float radius)
+    {
+        const float x = std::clamp(center.mX, box.mMin.mX, box.mMax.mX) - center.mX;
+        const float y = std::clamp(center.mY, box.mMin.mY, box.mMax.mY) - center.mY;
+        const float z = std::clamp(center.mZ, box.mMin.mZ, box.mMax.mZ) - center.mZ;
+        return x * x + y * y + z * z < radius * radius;
+    }
+
+    bool intersects(const Box& box, const Vec3& from, const Vec3& to)
+    {
+        float enter = 0;
+        float exit = 1;
+        const std::array<std::array<float, 4>, 3> axes = { {
+            { from.mX, to.mX, box.mMin.mX, box.mMax.mX },
+            { from.mY, to.mY, box.mMin.mY, box.mMax.mY },
+            { from.mZ, to.mZ, box.mMin.mZ, box.mMax.mZ },
+        } };
+        for (const auto& [start, end, min, max] : axes)
+        {
+            const float delta = end - start;
+            if (std::abs(delta) < 1e-6f)
+            {
+                if (start < min || start > max)
+                    return false;
+                continue;
+            }
+            float t0 = (min - start) / delta;
+            float t1 = (max - start) / delta;
+            if (t0 > t1)
+                std::swap(t0, t1);
+            enter = std::max(enter, t0);
+            exit = std::min(exit, t1);
+            if (enter > exit)
+                return false;
+        }
+        return true;
+    }
+
+    void preStep(World& world)
+    {
+        for (Actor& actor : world.mActors)
+        {
+            const Vec3 direction = actor.mTarget - actor.mPosition;
+            const float length = std::sqrt(direction.mX * direction.mX + direction.mY * direction.mY);
+            const float speed = 200;
+            if (length > 1)
+            {
+                actor.mVelocity.mX = direction.mX / length * speed;
+                actor.mVelocity.mY = direction.mY / length * speed;
+            }
+            actor.mVelocity.mZ = actor.mOnGround ? 0 : actor.mVelocity.mZ - 627.2f * timeStep;
+        }
+        world.mNextActor = 0;
+    }
+
+    // Sweep each actor in a few substeps and stop at the first blocking obstacle
+    void moveActor(const World& world, Actor& actor)
+    {
+        constexpr int substeps = 4;
+        const Vec3 delta = actor.mVelocity * (timeStep / substeps);
+        for (int i = 0; i < substeps; ++i)
+        {
+            Vec3 next = actor.mPosition + delta;
+            if (next.mZ < actorRadius)
+            {
+                next.mZ = actorRadius;
+                actor.mOnGround = true;
+            }
+            const Vec3 extent{ actorRadius, actorRadius, actorRadius };
+            bool blocked = false;
+            world.forEachObstacle(next - extent, next + extent,
+                [&](const Box& box) { blocked = blocked || intersects(box, next, actorRadius); });
+            if (blocked)
+                break;
+            actor.mPosition = next;
+        }
+    }
+
+    void moveActors(World& world)
+    {
+        while (true)
+        {
+            const std::size_t index = world.mNextActor++;
+            if (index >= world.mActors.size())
+                break;
+            moveActor(world, world.mActors[index]);
+        }
+    }
+
+    void postStep(World& world)
+    {
+        for (Actor& actor : world.mActors)
+        {
+            const Vec3 direction = actor.mTarget - actor.mPosition;
+            if (direction.mX * direction.mX + direction.mY * direction.mY < actorRadius * actorRadius)
+                std::swap(actor.mTarget.mX, actor.mTarget.mY);
+        }
+    }
+
+    void refreshLineOfSight(World& world, std::size_t batch, std::size_t batches)
+    {
+        const std::size_t size = (world.mActors.size() + batches - 1) / batches;
+        const std::size_t end = std::min(world.mActors.size(), (batch + 1) * size);
+        for (std::size_t i = batch * size; i < end; ++i)
+        {
+            Actor& actor = world.mActors[i];
+            const Vec3& position = actor.mPosition;
+            const Vec3 min{ std::min(position.mX, world.mPlayer.mX), std::min(position.mY, world.mPlayer.mY), 0 };
+            const Vec3 max{ std::max(position.mX, world.mPlayer.mX), std::max(position.mY, world.mPlayer.mY), 0 };
+            bool visible = true;
+            world.forEachObstacle(min, max, [&](const Box& box) {
+                visible = visible && !intersects(box, position, world.mPlayer);
+            });
+            actor.mLineOfSight = visible;
+        }
+    }
+
+    template <class F>
+    auto measure(World& world, Stage stage, F&& f)
+    {
+        return [&world, stage, f = std::forward<F>(f)](std::size_t batch) {
+            const auto start = std::chrono::steady_clock::now();
+            f(batch);
+            const auto duration = std::chrono::steady_clock::now() - start;
+            world.mStageTime[static_cast<std::size_t>(stage)]
+                += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        };
+    }
+
+    // Synthetic model of the physics frame without Bullet: stages and their dependencies are laid out the same way
+    // as PhysicsTaskScheduler::buildTaskGraph does but the work is a simplified sweep over a grid of boxes. Measures
+    // how Misc::TaskGraph distributes such a frame over threads, not the performance of the actual scheduler.
+    void buildTaskGraph(World& world, Misc::TaskGraph& graph, std::size_t threads)
+    {
+        graph.clear();
+        const std::size_t batches = std::max<std::size_t>(threads, 1);
+        std::size_t lastPostStep = 0;
+        for (std::size_t step = 0; step < stepsCount; ++step)
+        {
+            const auto pre = graph.addTask(measure(world, Stage::PreStep, [&world](std::size_t) { preStep(world); }));
+            if (step != 0)
+                graph.addDependency(pre, lastPostStep);
+            const auto move
+                = graph.addTask(measure(world, Stage::Move, [&world](std::size_t) { moveActors(world); }), batches);
+            graph.addDependency(move, pre);
+            lastPostStep = graph.addTask(measure(world, Stage::PostStep, [&world](std::size_t) { postStep(world); }));
+            graph.addDependency(lastPostStep, move);
+        }
+        const auto los = graph.addTask(measure(world, Stage::LineOfSight,
+                                           [&world, batches](std::size_t batch) {
+                                               refreshLineOfSight(world, batch, batches);
+                                           }),
+            batches);
+        graph.addDependency(los, lastPostStep);
+    }
+
+    void reportStages(benchmark::State& state, const World& world)
+    {
+        for (std::size_t i = 0; i < stageNames.size(); ++i)
+            state.counters[stageNames[i]] = benchmark::Counter(
+                static_cast<double>(world.mStageTime[i].load()) / 1e3, benchmark::Counter::kAvgIterations);
+    }
+
+    void serial(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        World world;
+        generateWorld(world, random);
+
+        for (auto _ : state)
+        {
+            for (std::size_t step = 0; step < stepsCount; ++step)
+            {
+                measure(world, Stage::PreStep, [&](std::size_t) { preStep(world); })(0);
+                measure(world, Stage::Move, [&](std::size_t) { moveActors(world); })(0);
+                measure(world, Stage::PostStep, [&](std::size_t) { postStep(world); })(0);
+            }
+            measure(world, Stage::LineOfSight, [&](std::size_t) { refreshLineOfSight(world, 0, 1); })(0);
+            benchmark::DoNotOptimize(world.mActors.data());
+        }
+
+        reportStages(state, world);
+    }
+
+    void taskGraph(benchmark::State& state)
+    {
+        const std::size_t threadsCount = static_cast<std::size_t>(state.range(0));
+        std::minstd_rand random;
+        World world;
+        generateWorld(world, random);
+        Misc::TaskGraph graph;
+        buildTaskGraph(world, graph, threadsCount);
+
+        bool stop = false;
+        std::barrier startBarrier(static_cast<std::ptrdiff_t>(threadsCount + 1));
+        std::barrier finishBarrier(static_cast<std::ptrdiff_t>(threadsCount + 1));
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < threadsCount; ++i)
+            threads.emplace_back([&] {
+                while (true)
+                {
+                    startBarrier.arrive_and_wait();
+                    if (stop)
+                        break;
+                    graph.run();
+                    finishBarrier.arrive_and_wait();
+                }
+            });
+
+        for (auto _ : state)
+        {
+            graph.start();
+            startBarrier.arrive_and_wait();
+            graph.run();
+            finishBarrier.arrive_and_wait();
+            benchmark::DoNotOptimize(world.mActors.data());
+        }
+
+        stop = true;
+        startBarrier.arrive_and_wait();
+        for (std::thread& thread : threads)
+            thread.join();
+
+        reportStages(state, world);
+    }
+}
+
+BENCHMARK(serial)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(taskGraph)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include "components/sceneutil/skinning.hpp"
+
+#include <osg/Matrixf>
+#include <osg/Vec3f>
+#include <osg/Vec4f>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t bonesCount = 32;
+    constexpr std::size_t influencesPerVertex = 4;
+    // Vertices of real meshes are grouped by the same bone weights
+    constexpr std::size_t verticesPerGroup = 16;
+
+    struct Influence
+    {
+        std::size_t mBone;
+        float mWeight;
+    };
+
+    struct Mesh
+    {
+        std::vector<osg::Vec3f> mPositions;
+        std::vector<osg::Vec3f> mNormals;
+        std::vector<osg::Vec4f> mTangents;
+        std::vector<std::vector<Influence>> mGroupInfluences;
+        std::vector<std::vector<unsigned short>> mGroupVertices;
+        std::vector<osg::Matrixf> mBones;
+    };
+
+    Mesh generateMesh(std::size_t verticesCount)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> coordinate(-100, 100);
+        std::uniform_real_distribution<float> element(-1, 1);
+        std::uniform_int_distribution<std::size_t> bone(0, bonesCount - 1);
+        Mesh result;
+        for (std::size_t i = 0; i < verticesCount; ++i)
+        {
+            result.mPositions.emplace_back(coordinate(random), coordinate(random), coordinate(random));
+            result.mNormals.emplace_back(element(random), element(random), element(random));
+            result.mTangents.emplace_back(element(random), element(random), element(random), 1);
+            if (i % verticesPerGroup == 0)
+            {
+                result.mGroupVertices.emplace_back();
+                std::vector<Influence>& influences = result.mGroupInfluences.emplace_back();
+                for (std::size_t j = 0; j < influencesPerVertex; ++j)
+                    influences.push_back(Influence{ bone(random), 1.0f / influencesPerVertex });
+            }
+            result.mGroupVertices.back().push_back(static_cast<unsigned short>(i));
+        }
+        for (std::size_t i = 0; i < bonesCount; ++i)
+        {
+            osg::Matrixf& matrix = result.mBones.emplace_back();
+            for (int row = 0; row < 4; ++row)
+                for (int column = 0; column < 3; ++column)
+                    matrix(row, column) = element(random);
+        }
+        return result;
+    }
+
+    osg::Matrixf getGroupMatrix(const Mesh& mesh, std::size_t group)
+    {
+        osg::Matrixf result(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1);
+        for (const Influence& influence : mesh.mGroupInfluences[group])
+            SceneUtil::accumulateBoneMatrix(mesh.mBones[influence.mBone], influence.mWeight, result);
+        return result;
+    }
+
+    void skinScalar(benchmark::State& state)
+    {
+        const Mesh mesh = generateMesh(static_cast<std::size_t>(state.range(0)));
+        std::vector<osg::Vec3f> positions(mesh.mPositions.size());
+        std::vector<osg::Vec3f> normals(mesh.mNormals.size());
+        std::vector<osg::Vec4f> tangents(mesh.mTangents.size());
+
+        for (auto _ : state)
+        {
+            for (std::size_t group = 0; group < mesh.mGroupVertices.size(); ++group)
+            {
+                const osg::Matrixf matrix = getGroupMatrix(mesh, group);
+                for (unsigned short vertex : mesh.mGroupVertices[group])
+                {
+                    positions[vertex] = matrix.preMult(mesh.mPositions[vertex]);
+                    normals[vertex] = osg::Matrixf::transform3x3(mesh.mNormals[vertex], matrix);
+                    const osg::Vec4f& tangent = mesh.mTangents[vertex];
+                    tangents[vertex] = osg::Vec4f(
+                        osg::Matrixf::transform3x3(osg::Vec3f(tangent.x(), tangent.y(), tangent.z()), matrix),
+                        tangent.w());
+                }
+            }
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::DoNotOptimize(normals.data());
+            benchmark::DoNotOptimize(tangents.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void skinVectorised(benchmark::State& state)
+    {
+        const Mesh mesh = generateMesh(static_cast<std::size_t>(state.range(0)));
+        SceneUtil::SkinningSource source;
+        source.reserve(mesh.mPositions.size());
+        for (const std::vector<unsigned short>& vertices : mesh.mGroupVertices)
+            for (unsigned short vertex : vertices)
+                source.add(vertex, mesh.mPositions[vertex], &mesh.mNormals[vertex], &mesh.mTangents[vertex]);
+        std::vector<osg::Vec3f> positions(mesh.mPositions.size());
+        std::vector<osg::Vec3f> normals(mesh.mNormals.size());
+        std::vector<osg::Vec4f> tangents(mesh.mTangents.size());
+
+        for (auto _ : state)
+        {
+            std::size_t begin = 0;
+            for (std::size_t group = 0; group < mesh.mGroupVertices.size(); ++group)
+            {
+                const std::size_t end = begin + mesh.mGroupVertices[group].size();
+                SceneUtil::skinVertices(
+                    getGroupMatrix(mesh, group), source, begin, end, positions.data(), normals.data(), tangents.data());
+                begin = end;
+            }
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::DoNotOptimize(normals.data());
+            benchmark::DoNotOptimize(tangents.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(skinScalar)->Arg(1000)->Arg(5000);
+BENCHMARK(skinVectorised)->Arg(1000)->Arg(5000);
+
+BENCHMARK_MAIN();
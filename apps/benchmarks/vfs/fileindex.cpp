@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+
+#include "components/vfs/fileindex.hpp"
+#include "components/vfs/filemap.hpp"
+#include "components/vfs/pathutil.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t filesCount = 500 * 1000;
+    constexpr std::size_t queriesCount = 64 * 1024;
+
+    constexpr std::array<std::string_view, 6> rootDirectories = {
+        "meshes",
+        "textures",
+        "sound",
+        "music",
+        "icons",
+        "bookart",
+    };
+
+    constexpr std::array<std::string_view, 6> extensions = {
+        ".nif",
+        ".dds",
+        ".wav",
+        ".mp3",
+        ".tga",
+        ".kf",
+    };
+
+    template <class Random>
+    std::string generateName(std::size_t size, Random& random)
+    {
+        std::uniform_int_distribution<int> distribution('a', 'z');
+        std::string result;
+        result.reserve(size);
+        std::generate_n(std::back_inserter(result), size, [&] { return static_cast<char>(distribution(random)); });
+        return result;
+    }
+
+    // Produces paths like "meshes/xyz/abcdefgh.nif" with a few levels of nested directories
+    template <class Random>
+    std::string generatePath(Random& random)
+    {
+        std::uniform_int_distribution<std::size_t> rootDistribution(0, rootDirectories.size() - 1);
+        std::uniform_int_distribution<std::size_t> depthDistribution(0, 3);
+        std::uniform_int_distribution<std::size_t> lengthDistribution(3, 16);
+        std::string result(rootDirectories[rootDistribution(random)]);
+        for (std::size_t i = 0, depth = depthDistribution(random); i < depth; ++i)
+        {
+            result += VFS::Path::separator;
+            result += generateName(lengthDistribution(random), random);
+        }
+        result += VFS::Path::separator;
+        result += generateName(lengthDistribution(random), random);
+        result += extensions[rootDistribution(random)];
+        return result;
+    }
+
+    struct Data
+    {
+        VFS::FileMap mFileMap;
+        VFS::FileIndex mFileIndex;
+        std::vector<VFS::Path::Normalized> mPresent;
+        std::vector<VFS::Path::Normalized> mAbsent;
+    };
+
+    const Data& getData()
+    {
+        static const Data data = [] {
+            std::minstd_rand random;
+            Data result;
+            while (result.mFileMap.size() < filesCount)
+                result.mFileMap.emplace(VFS::Path::Normalized(generatePath(random)), nullptr);
+            result.mFileIndex.build(result.mFileMap);
+            std::vector<VFS::Path::Normalized> keys;
+            keys.reserve(result.mFileMap.size());
+            for (const auto& [k, v] : result.mFileMap)
+                keys.push_back(k);
+            std::shuffle(keys.begin(), keys.end(), random);
+            result.mPresent.assign(keys.begin(), keys.begin() + queriesCount);
+            result.mAbsent.reserve(queriesCount);
+            while (result.mAbsent.size() < queriesCount)
+            {
+                VFS::Path::Normalized path(generatePath(random));
+                if (!result.mFileMap.contains(path))
+                    result.mAbsent.push_back(std::move(path));
+            }
+            return result;
+        }();
+        return data;
+    }
+
+    void findInFileMap(benchmark::State& state, const std::vector<VFS::Path::Normalized> Data::*queries)
+    {
+        const Data& data = getData();
+        const std::vector<VFS::Path::Normalized>& paths = data.*queries;
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(data.mFileMap.find(paths[i]));
+            if (++i >= paths.size())
+                i = 0;
+        }
+    }
+
+    void findInFileIndex(benchmark::State& state, const std::vector<VFS::Path::Normalized> Data::*queries)
+    {
+        const Data& data = getData();
+        const std::vector<VFS::Path::Normalized>& paths = data.*queries;
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(data.mFileIndex.find(paths[i].view()));
+            if (++i >= paths.size())
+                i = 0;
+        }
+    }
+
+    void buildFileIndex(benchmark::State& state)
+    {
+        const Data& data = getData();
+        for (auto _ : state)
+        {
+            VFS::FileIndex index;
+            index.build(data.mFileMap);
+            benchmark::DoNotOptimize(index);
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(findInFileMap, present, &Data::mPresent);
+BENCHMARK_CAPTURE(findInFileMap, absent, &Data::mAbsent);
+BENCHMARK_CAPTURE(findInFileIndex, present, &Data::mPresent);
+BENCHMARK_CAPTURE(findInFileIndex, absent, &Data::mAbsent);
+BENCHMARK(buildFileIndex)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -155,7 +155,8 @@ namespace
 
         VFS::Manager vfs;
 
-        VFS::registerArchives(&vfs, fileCollections, archives, true);
+        VFS::registerArchives(
+            &vfs, fileCollections, archives, true, config.getCachePath() / VFS::indexCacheFileName);
 
         Settings::Manager::load(config);
 
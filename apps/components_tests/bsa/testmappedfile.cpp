@@ -0,0 +1,103 @@
+#include <components/bsa/bsa_file.hpp>
+#include <components/bsa/memorystream.hpp>
+#include <components/platform/file.hpp>
+#include <components/testing/util.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace Bsa
+{
+    namespace
+    {
+        using namespace testing;
+
+        std::string readAll(std::istream& stream)
+        {
+            return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        }
+
+        void createArchive(const std::filesystem::path& path)
+        {
+            std::filesystem::remove(path);
+            BSAFile bsa;
+            bsa.open(path);
+            std::istringstream first("first file content");
+            bsa.addFile("meshes\\a.nif", first);
+            std::istringstream second("second");
+            bsa.addFile("textures\\b.dds", second);
+        }
+
+        const BSAFile::FileStruct& findFile(const BSAFile& bsa, std::string_view name)
+        {
+            for (const BSAFile::FileStruct& file : bsa.getList())
+                if (name == file.name())
+                    return file;
+            throw std::runtime_error("File is not found: " + std::string(name));
+        }
+
+        TEST(PlatformMappedFileTest, shouldMapWholeFile)
+        {
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("mapped_file");
+            std::ofstream(path, std::ios_base::binary) << "content";
+            const Platform::File::MappedFile file(path);
+            ASSERT_EQ(file.size(), 7);
+            EXPECT_EQ(std::string(file.data(), file.size()), "content");
+        }
+
+        TEST(PlatformMappedFileTest, shouldThrowExceptionForAbsentFile)
+        {
+            EXPECT_ANY_THROW(Platform::File::MappedFile(TestingOpenMW::temporaryFilePath("absent_mapped_file")));
+        }
+
+        TEST(BsaMappedFileTest, mappedArchiveShouldServeFilesFromMemory)
+        {
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("mapped_archive.bsa");
+            createArchive(path);
+
+            BSAFile bsa;
+            bsa.open(path);
+            bsa.mapIntoMemory();
+
+            Files::IStreamPtr first = bsa.getFile(&findFile(bsa, "meshes\\a.nif"));
+            EXPECT_NE(dynamic_cast<MappedInputStream*>(first.get()), nullptr);
+            EXPECT_EQ(readAll(*first), "first file content");
+
+            Files::IStreamPtr second = bsa.getFile(&findFile(bsa, "textures\\b.dds"));
+            EXPECT_EQ(readAll(*second), "second");
+        }
+
+        TEST(BsaMappedFileTest, streamShouldStayValidAfterArchiveIsClosed)
+        {
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("mapped_archive_closed.bsa");
+            createArchive(path);
+
+            Files::IStreamPtr stream;
+            {
+                BSAFile bsa;
+                bsa.open(path);
+                bsa.mapIntoMemory();
+                stream = bsa.getFile(&findFile(bsa, "meshes\\a.nif"));
+            }
+            EXPECT_EQ(readAll(*stream), "first file content");
+        }
+
+        TEST(BsaMappedFileTest, mappedArchiveShouldRejectAddFile)
+        {
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("mapped_archive_add.bsa");
+            createArchive(path);
+
+            BSAFile bsa;
+            bsa.open(path);
+            bsa.mapIntoMemory();
+            std::istringstream content("content");
+            EXPECT_ANY_THROW(bsa.addFile("c.txt", content));
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#include "operators.hpp"
+#include "settings.hpp"
+
+#include <components/detournavigator/asyncpathfinder.hpp>
+#include <components/detournavigator/navigatorimpl.hpp>
+#include <components/detournavigator/navigatorutils.hpp>
+#include <components/detournavigator/navmeshdb.hpp>
+#include <components/esm3/loadland.hpp>
+#include <components/loadinglistener/loadinglistener.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace DetourNavigator;
+    using namespace DetourNavigator::Tests;
+
+    constexpr int heightfieldTileSize = ESM::Land::REAL_SIZE / (ESM::Land::LAND_SIZE - 1);
+
+    constexpr std::array<float, 5 * 5> heightfieldData{ {
+        0, 0, 0, 0, 0, // row 0
+        0, -25, -25, -25, -25, // row 1
+        0, -25, -100, -100, -100, // row 2
+        0, -25, -100, -100, -100, // row 3
+        0, -25, -100, -100, -100, // row 4
+    } };
+
+    struct DetourNavigatorAsyncPathFinderTest : Test
+    {
+        Settings mSettings = makeSettings();
+        std::unique_ptr<Navigator> mNavigator = std::make_unique<NavigatorImpl>(
+            mSettings, std::make_unique<NavMeshDb>(":memory:", std::numeric_limits<std::uint64_t>::max()));
+        const osg::Vec3f mPlayerPosition{ 256, 256, 0 };
+        const AgentBounds mAgentBounds{ CollisionShapeType::Aabb, { 29, 29, 66 } };
+        const PathQuery mQuery{
+            .mAgentBounds = mAgentBounds,
+            .mStart = osg::Vec3f(52, 460, 1),
+            .mEnd = osg::Vec3f(460, 52, 1),
+            .mIncludeFlags = Flag_walk,
+        };
+        Loading::Listener mListener;
+
+        void addHeightfield()
+        {
+            HeightfieldSurface surface;
+            surface.mHeights = heightfieldData.data();
+            surface.mMinHeight = -100;
+            surface.mMaxHeight = 100;
+            surface.mSize = 5;
+            const int cellSize = heightfieldTileSize * static_cast<int>(surface.mSize - 1);
+
+            ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+            auto updateGuard = mNavigator->makeUpdateGuard();
+            mNavigator->addHeightfield(osg::Vec2i(0, 0), cellSize, surface, updateGuard.get());
+            mNavigator->update(mPlayerPosition, updateGuard.get());
+            updateGuard.reset();
+            mNavigator->wait(WaitConditionType::requiredTilesPresent, &mListener);
+        }
+
+        std::vector<osg::Vec3f> findPathSync(const PathQuery& query) const
+        {
+            std::deque<osg::Vec3f> path;
+            EXPECT_EQ(findPath(*mNavigator, query.mAgentBounds, query.mStart, query.mEnd, query.mIncludeFlags,
+                          query.mAreaCosts, query.mEndTolerance, std::back_inserter(path)),
+                Status::Success);
+            return { path.begin(), path.end() };
+        }
+    };
+
+    TEST_F(DetourNavigatorAsyncPathFinderTest, enqueue_for_absent_navmesh_should_return_ready_result)
+    {
+        AsyncPathFinder pathFinder(*mNavigator, 1);
+        const std::shared_ptr<const PendingPath> pendingPath = pathFinder.enqueue(mQuery);
+        ASSERT_TRUE(pendingPath->isReady());
+        EXPECT_EQ(pendingPath->getResult().mStatus, Status::NavMeshNotFound);
+        EXPECT_THAT(pendingPath->getResult().mPath, IsEmpty());
+    }
+
+    TEST_F(DetourNavigatorAsyncPathFinderTest, enqueued_query_should_not_be_processed_before_submit)
+    {
+        addHeightfield();
+        AsyncPathFinder pathFinder(*mNavigator, 0);
+        const std::shared_ptr<const PendingPath> pendingPath = pathFinder.enqueue(mQuery);
+        EXPECT_FALSE(pendingPath->isReady());
+    }
+
+    TEST_F(DetourNavigatorAsyncPathFinderTest, submit_without_threads_should_process_queries)
+    {
+        addHeightfield();
+        AsyncPathFinder pathFinder(*mNavigator, 0);
+        const std::shared_ptr<const PendingPath> pendingPath = pathFinder.enqueue(mQuery);
+        pathFinder.submit();
+        ASSERT_TRUE(pendingPath->isReady());
+        EXPECT_EQ(pendingPath->getResult().mStatus, Status::Success);
+        EXPECT_EQ(pendingPath->getResult().mPath, findPathSync(mQuery));
+    }
+
+    TEST_F(DetourNavigatorAsyncPathFinderTest, submitted_batch_should_be_processed_by_threads)
+    {
+        addHeightfield();
+        AsyncPathFinder pathFinder(*mNavigator, 2);
+        PathQuery reversed = mQuery;
+        std::swap(reversed.mStart, reversed.mEnd);
+        std::vector<std::shared_ptr<const PendingPath>> pendingPaths;
+        for (int i = 0; i < 4; ++i)
+            pendingPaths.push_back(pathFinder.enqueue(i % 2 == 0 ? mQuery : reversed));
+        pathFinder.submit();
+        pathFinder.wait();
+        for (std::size_t i = 0; i < pendingPaths.size(); ++i)
+        {
+            ASSERT_TRUE(pendingPaths[i]->isReady()) << i;
+            EXPECT_EQ(pendingPaths[i]->getResult().mStatus, Status::Success) << i;
+            EXPECT_EQ(pendingPaths[i]->getResult().mPath, findPathSync(i % 2 == 0 ? mQuery : reversed)) << i;
+        }
+    }
+
+    TEST_F(DetourNavigatorAsyncPathFinderTest, dropped_query_should_be_skipped)
+    {
+        addHeightfield();
+        AsyncPathFinder pathFinder(*mNavigator, 1);
+        std::weak_ptr<const PendingPath> dropped = pathFinder.enqueue(mQuery);
+        const std::shared_ptr<const PendingPath> kept = pathFinder.enqueue(mQuery);
+        pathFinder.submit();
+        pathFinder.wait();
+        EXPECT_TRUE(dropped.expired());
+        ASSERT_TRUE(kept->isReady());
+        EXPECT_EQ(kept->getResult().mStatus, Status::Success);
+    }
+
+    TEST_F(DetourNavigatorAsyncPathFinderTest, stop_should_cancel_not_processed_queries)
+    {
+        addHeightfield();
+        AsyncPathFinder pathFinder(*mNavigator, 1);
+        const std::shared_ptr<const PendingPath> pendingPath = pathFinder.enqueue(mQuery);
+        pathFinder.stop();
+        ASSERT_TRUE(pendingPath->isReady());
+        EXPECT_EQ(pendingPath->getResult().mStatus, Status::NavMeshNotFound);
+    }
+}
@@ -4,6 +4,7 @@
 #include <components/detournavigator/preparednavmeshdata.hpp>
 #include <components/detournavigator/recast.hpp>
 #include <components/detournavigator/recastmesh.hpp>
+#include <components/detournavigator/stats.hpp>
 
 #include <osg/Vec3f>
 
@@ -13,6 +14,8 @@
 
 #include <random>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -367,4 +370,70 @@ namespace
         EXPECT_FALSE(cache.set(mAgentBounds, mTilePosition, anotherRecastMesh, std::move(anotherData)));
         EXPECT_TRUE(cache.get(mAgentBounds, mTilePosition, mRecastMesh));
     }
+
+    TEST_F(DetourNavigatorNavMeshTilesCacheTest, digest_should_be_equal_for_equal_keys)
+    {
+        const RecastMesh recastMesh(mVersion, mMesh, mWater, mHeightfields, mFlatHeightfields, mSources);
+        EXPECT_EQ(
+            getDigest(mAgentBounds, mTilePosition, mRecastMesh), getDigest(mAgentBounds, mTilePosition, recastMesh));
+    }
+
+    TEST_F(DetourNavigatorNavMeshTilesCacheTest, digest_should_depend_on_recast_mesh_content)
+    {
+        const std::vector<CellWater> water(1, CellWater{ osg::Vec2i(), Water{ 1, 0.0f } });
+        const RecastMesh recastMesh(mVersion, mMesh, water, mHeightfields, mFlatHeightfields, mSources);
+        EXPECT_NE(
+            getDigest(mAgentBounds, mTilePosition, mRecastMesh), getDigest(mAgentBounds, mTilePosition, recastMesh));
+    }
+
+    TEST_F(DetourNavigatorNavMeshTilesCacheTest, digest_should_not_depend_on_zero_sign)
+    {
+        std::vector<float> vertices{ { -0.0f, 0, 0, 1, 0, 0, 1, 1, -0.0f } };
+        const Mesh mesh(std::vector<int>{ 0, 1, 2 }, std::move(vertices), std::vector<AreaType>{ 1, AreaType_ground });
+        const std::vector<CellWater> water(1, CellWater{ osg::Vec2i(), Water{ 1, 0.0f } });
+        const std::vector<CellWater> negativeZeroWater(1, CellWater{ osg::Vec2i(), Water{ 1, -0.0f } });
+        const RecastMesh recastMesh(mVersion, mMesh, water, mHeightfields, mFlatHeightfields, mSources);
+        const RecastMesh negativeZeroRecastMesh(
+            mVersion, mesh, negativeZeroWater, mHeightfields, mFlatHeightfields, mSources);
+        EXPECT_EQ(getDigest(mAgentBounds, mTilePosition, recastMesh),
+            getDigest(mAgentBounds, mTilePosition, negativeZeroRecastMesh));
+    }
+
+    TEST_F(DetourNavigatorNavMeshTilesCacheTest, get_should_find_item_set_for_key_with_different_zero_sign)
+    {
+        const std::size_t maxSize = 2 * (mRecastMeshWithWaterSize + mPreparedNavMeshDataSize);
+        NavMeshTilesCache cache(maxSize);
+        const std::vector<CellWater> water(1, CellWater{ osg::Vec2i(), Water{ 1, 0.0f } });
+        const std::vector<CellWater> negativeZeroWater(1, CellWater{ osg::Vec2i(), Water{ 1, -0.0f } });
+        const RecastMesh recastMesh(mVersion, mMesh, water, mHeightfields, mFlatHeightfields, mSources);
+        const RecastMesh negativeZeroRecastMesh(
+            mVersion, mMesh, negativeZeroWater, mHeightfields, mFlatHeightfields, mSources);
+        ASSERT_TRUE(cache.set(mAgentBounds, mTilePosition, recastMesh, std::move(mPreparedNavMeshData)));
+        EXPECT_TRUE(cache.get(mAgentBounds, mTilePosition, negativeZeroRecastMesh));
+    }
+
+    TEST_F(DetourNavigatorNavMeshTilesCacheTest, get_and_set_from_multiple_threads_should_release_all_items)
+    {
+        const std::size_t maxSize = 4 * (mRecastMeshSize + mPreparedNavMeshDataSize);
+        NavMeshTilesCache cache(maxSize);
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+            threads.emplace_back([&, i] {
+                for (int j = 0; j < 1000; ++j)
+                {
+                    const TilePosition tilePosition((i + j) % 8, 0);
+                    if (cache.get(mAgentBounds, tilePosition, mRecastMesh))
+                        continue;
+                    cache.set(mAgentBounds, tilePosition, mRecastMesh, clone(*mPreparedNavMeshData));
+                }
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+
+        const NavMeshTilesCacheStats stats = cache.getStats();
+        EXPECT_EQ(stats.mUsedNavMeshTiles, 0);
+        EXPECT_LE(stats.mNavMeshCacheSize, maxSize);
+        EXPECT_GT(stats.mHitCount, 0);
+    }
 }
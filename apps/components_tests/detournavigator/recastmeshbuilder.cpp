@@ -17,32 +17,6 @@
 
 #include <array>
 
-namespace DetourNavigator
-{
-    static inline bool operator==(const Water& lhs, const Water& rhs)
-    {
-        const auto tie = [](const Water& v) { return std::tie(v.mCellSize, v.mLevel); };
-        return tie(lhs) == tie(rhs);
-    }
-
-    static inline bool operator==(const CellWater& lhs, const CellWater& rhs)
-    {
-        const auto tie = [](const CellWater& v) { return std::tie(v.mCellPosition, v.mWater); };
-        return tie(lhs) == tie(rhs);
-    }
-
-    static inline bool operator==(const Heightfield& lhs, const Heightfield& rhs)
-    {
-        return makeTuple(lhs) == makeTuple(rhs);
-    }
-
-    static inline bool operator==(const FlatHeightfield& lhs, const FlatHeightfield& rhs)
-    {
-        const auto tie = [](const FlatHeightfield& v) { return std::tie(v.mCellPosition, v.mCellSize, v.mHeight); };
-        return tie(lhs) == tie(rhs);
-    }
-}
-
 namespace
 {
     using namespace testing;
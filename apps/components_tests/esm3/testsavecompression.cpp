@@ -0,0 +1,206 @@
+#include <components/esm/fourcc.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/formatversion.hpp>
+#include <components/esm3/savecompression.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace ESM
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        constexpr std::uint32_t fakeRecordId = fourCC("FAKE");
+
+        std::string makeValue(std::size_t index)
+        {
+            return std::to_string(index) + std::string(index % 1000, static_cast<char>('a' + index % 26));
+        }
+
+        std::string makeSaveGame(std::size_t recordCount, FormatVersion formatVersion)
+        {
+            std::ostringstream stream;
+            ESMWriter writer;
+            writer.setFormatVersion(formatVersion);
+            writer.save(stream);
+            for (std::size_t i = 0; i < recordCount; ++i)
+            {
+                writer.startRecord(fakeRecordId);
+                writer.writeHNString("NAME", makeValue(i));
+                writer.endRecord(fakeRecordId);
+            }
+            writer.close();
+            return stream.str();
+        }
+
+        TEST(Esm3SaveCompressionTest, compressSaveGameShouldKeepHeaderUncompressed)
+        {
+            const std::string data = makeSaveGame(0, CurrentSaveGameFormatVersion);
+            const std::string compressed = compressSaveGame(data);
+            EXPECT_EQ(compressed.substr(0, data.size()), data);
+        }
+
+        TEST(Esm3SaveCompressionTest, compressSaveGameShouldReduceSize)
+        {
+            const std::string data = makeSaveGame(3000, CurrentSaveGameFormatVersion);
+            EXPECT_LT(compressSaveGame(data).size(), data.size() / 2);
+        }
+
+        TEST(Esm3SaveCompressionTest, compressSaveGameShouldThrowForNotSaveGame)
+        {
+            EXPECT_THROW(compressSaveGame("not a saved game"), std::runtime_error);
+        }
+
+        TEST(Esm3SaveCompressionTest, isCompressedSaveGameShouldNotChangePosition)
+        {
+            const std::string data = makeSaveGame(0, CurrentSaveGameFormatVersion);
+            std::istringstream stream(compressSaveGame(data));
+            stream.seekg(static_cast<std::streamoff>(data.size()));
+            EXPECT_TRUE(isCompressedSaveGame(stream));
+            EXPECT_EQ(stream.tellg(), static_cast<std::streamoff>(data.size()));
+        }
+
+        template <class T>
+        void overwrite(std::string& data, std::size_t offset, T value)
+        {
+            std::memcpy(data.data() + offset, &value, sizeof(value));
+        }
+
+        // Offsets relative to the end of the uncompressed header
+        constexpr std::size_t blockSizeOffset = 4;
+        constexpr std::size_t sizeOffset = 8;
+        constexpr std::size_t blockCountOffset = 16;
+        constexpr std::size_t blockTableOffset = 20;
+
+        void expectOpenThrows(const std::string& data)
+        {
+            ESMReader reader;
+            EXPECT_THROW(reader.open(std::make_unique<std::istringstream>(data), "stream"), std::runtime_error);
+        }
+
+        TEST(Esm3SaveCompressionTest, readerShouldRejectTooLargeBlockSize)
+        {
+            const std::string header = makeSaveGame(0, CurrentSaveGameFormatVersion);
+            std::string compressed = compressSaveGame(makeSaveGame(10, CurrentSaveGameFormatVersion));
+            overwrite<std::uint32_t>(compressed, header.size() + blockSizeOffset, 0x80000000);
+            overwrite<std::uint64_t>(compressed, header.size() + sizeOffset, 0x80000000);
+            expectOpenThrows(compressed);
+        }
+
+        TEST(Esm3SaveCompressionTest, readerShouldRejectBlockCountNotMatchingSize)
+        {
+            const std::string header = makeSaveGame(0, CurrentSaveGameFormatVersion);
+            std::string compressed = compressSaveGame(makeSaveGame(10, CurrentSaveGameFormatVersion));
+            overwrite<std::uint32_t>(compressed, header.size() + blockCountOffset, 0xffffffff);
+            expectOpenThrows(compressed);
+        }
+
+        TEST(Esm3SaveCompressionTest, readerShouldRejectBlockTableLargerThanFile)
+        {
+            const std::string header = makeSaveGame(0, CurrentSaveGameFormatVersion);
+            std::string compressed = compressSaveGame(makeSaveGame(10, CurrentSaveGameFormatVersion));
+            overwrite<std::uint32_t>(compressed, header.size() + blockSizeOffset, 1);
+            overwrite<std::uint64_t>(compressed, header.size() + sizeOffset, 0xffffffff);
+            overwrite<std::uint32_t>(compressed, header.size() + blockCountOffset, 0xffffffff);
+            expectOpenThrows(compressed);
+        }
+
+        TEST(Esm3SaveCompressionTest, readerShouldRejectBlockLargerThanFile)
+        {
+            const std::string header = makeSaveGame(0, CurrentSaveGameFormatVersion);
+            std::string compressed = compressSaveGame(makeSaveGame(10, CurrentSaveGameFormatVersion));
+            overwrite<std::uint32_t>(compressed, header.size() + blockTableOffset, 0x10000);
+            expectOpenThrows(compressed);
+        }
+
+        TEST(Esm3SaveCompressionTest, readerShouldLoadUncompressedSaveGameWithPreviousFormatVersion)
+        {
+            const std::string data = makeSaveGame(1, MaxUncompressedSaveGameFormatVersion);
+            ESMReader reader;
+            reader.open(std::make_unique<std::istringstream>(data), "stream");
+            EXPECT_EQ(reader.getFormatVersion(), MaxUncompressedSaveGameFormatVersion);
+            ASSERT_TRUE(reader.hasMoreRecs());
+            ASSERT_EQ(reader.getRecName().toInt(), fakeRecordId);
+            reader.getRecHeader();
+            EXPECT_EQ(reader.getHNString("NAME"), makeValue(0));
+        }
+
+        struct Esm3SaveCompressionReadTest : TestWithParam<std::size_t>
+        {
+        };
+
+        TEST_P(Esm3SaveCompressionReadTest, readerShouldLoadCompressedSaveGame)
+        {
+            const std::size_t recordCount = GetParam();
+            const std::string data = makeSaveGame(recordCount, CurrentSaveGameFormatVersion);
+            const std::string compressed = compressSaveGame(data);
+
+            ESMReader reader;
+            reader.open(std::make_unique<std::istringstream>(compressed), "stream");
+            EXPECT_EQ(reader.getFormatVersion(), CurrentSaveGameFormatVersion);
+            EXPECT_EQ(reader.getFileSize(), data.size());
+            for (std::size_t i = 0; i < recordCount; ++i)
+            {
+                ASSERT_TRUE(reader.hasMoreRecs());
+                ASSERT_EQ(reader.getRecName().toInt(), fakeRecordId);
+                reader.getRecHeader();
+                if (i % 3 == 0)
+                {
+                    reader.skipRecord();
+                    continue;
+                }
+                EXPECT_EQ(reader.getHNString("NAME"), makeValue(i));
+            }
+            EXPECT_FALSE(reader.hasMoreRecs());
+        }
+
+        TEST_P(Esm3SaveCompressionReadTest, readerShouldRestoreContextInCompressedSaveGame)
+        {
+            const std::size_t recordCount = GetParam();
+            if (recordCount == 0)
+                return;
+            const std::string compressed = compressSaveGame(makeSaveGame(recordCount, CurrentSaveGameFormatVersion));
+
+            ESMReader reader;
+            reader.open(std::make_unique<std::istringstream>(compressed), "stream");
+            reader.getRecName();
+            reader.getRecHeader();
+            const ESM_Context context = reader.getContext();
+            while (reader.hasMoreRecs())
+            {
+                reader.skipRecord();
+                if (reader.hasMoreRecs())
+                {
+                    reader.getRecName();
+                    reader.getRecHeader();
+                }
+            }
+            reader.restoreContext(context);
+            EXPECT_EQ(reader.getHNString("NAME"), makeValue(0));
+        }
+
+        TEST_P(Esm3SaveCompressionReadTest, readerShouldLoadUncompressedSaveGame)
+        {
+            const std::size_t recordCount = GetParam();
+            const std::string data = makeSaveGame(recordCount, CurrentSaveGameFormatVersion);
+            ESMReader reader;
+            reader.open(std::make_unique<std::istringstream>(data), "stream");
+            for (std::size_t i = 0; i < recordCount; ++i)
+            {
+                ASSERT_TRUE(reader.hasMoreRecs());
+                ASSERT_EQ(reader.getRecName().toInt(), fakeRecordId);
+                reader.getRecHeader();
+                EXPECT_EQ(reader.getHNString("NAME"), makeValue(i));
+            }
+            EXPECT_FALSE(reader.hasMoreRecs());
+        }
+
+        INSTANTIATE_TEST_SUITE_P(RecordCount, Esm3SaveCompressionReadTest, Values(0, 1, 10, 3000));
+    }
+}
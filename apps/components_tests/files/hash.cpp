@@ -1,6 +1,7 @@
 #include <components/files/constrainedfilestream.hpp>
 #include <components/files/conversion.hpp>
 #include <components/files/hash.hpp>
+#include <components/files/hashingstreambuf.hpp>
 #include <components/testing/util.hpp>
 
 #include <gmock/gmock.h>
@@ -61,11 +62,87 @@ namespace
         EXPECT_EQ(getHash(Files::pathToUnicodeString(file), *stream), GetParam().mHash);
     }
 
-    INSTANTIATE_TEST_SUITE_P(Params, FilesGetHash,
-        Values(Params{ 0, { 0, 0 } }, Params{ 1, { 9607679276477937801ull, 16624257681780017498ull } },
+    const auto hashParams
+        = Values(Params{ 0, { 0, 0 } }, Params{ 1, { 9607679276477937801ull, 16624257681780017498ull } },
             Params{ 128, { 15287858148353394424ull, 16818615825966581310ull } },
             Params{ 1000, { 11018119256083894017ull, 6631144854802791578ull } },
             Params{ 4096, { 11972283295181039100ull, 16027670129106775155ull } },
             Params{ 4097, { 16717956291025443060ull, 12856404199748778153ull } },
-            Params{ 5000, { 15775925571142117787ull, 10322955217889622896ull } }));
+            Params{ 5000, { 15775925571142117787ull, 10322955217889622896ull } });
+
+    INSTANTIATE_TEST_SUITE_P(Params, FilesGetHash, hashParams);
+
+    struct FilesHashingStreamBuf : TestWithParam<Params>
+    {
+    };
+
+    TEST_P(FilesHashingStreamBuf, finishShouldReturnHashForUnreadStream)
+    {
+        std::string content;
+        std::fill_n(std::back_inserter(content), GetParam().mSize, 'a');
+        std::istringstream source(content);
+        HashingStreamBuf buffer(source);
+        EXPECT_EQ(buffer.finish("fileName"), GetParam().mHash);
+    }
+
+    TEST_P(FilesHashingStreamBuf, finishShouldReturnHashForPartiallyReadStream)
+    {
+        std::string content;
+        std::fill_n(std::back_inserter(content), GetParam().mSize, 'a');
+        std::istringstream source(content);
+        HashingStreamBuf buffer(source);
+        std::istream stream(&buffer);
+        std::string data(GetParam().mSize / 2, '\0');
+        stream.read(data.data(), static_cast<std::streamsize>(data.size()));
+        EXPECT_EQ(data, content.substr(0, data.size()));
+        EXPECT_EQ(buffer.finish("fileName"), GetParam().mHash);
+    }
+
+    TEST_P(FilesHashingStreamBuf, finishShouldReturnHashForFullyReadStream)
+    {
+        std::string content;
+        std::fill_n(std::back_inserter(content), GetParam().mSize, 'a');
+        std::istringstream source(content);
+        HashingStreamBuf buffer(source);
+        std::istream stream(&buffer);
+        const std::string data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(data, content);
+        EXPECT_EQ(buffer.finish("fileName"), GetParam().mHash);
+    }
+
+    TEST_P(FilesHashingStreamBuf, finishShouldReturnHashAfterSeek)
+    {
+        std::string content;
+        std::fill_n(std::back_inserter(content), GetParam().mSize, 'a');
+        std::istringstream source(content);
+        HashingStreamBuf buffer(source);
+        std::istream stream(&buffer);
+        stream.seekg(0, std::ios_base::end);
+        EXPECT_EQ(stream.tellg(), static_cast<std::streamoff>(content.size()));
+        stream.seekg(0);
+        EXPECT_EQ(buffer.finish("fileName"), GetParam().mHash);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Params, FilesHashingStreamBuf, hashParams);
+
+    TEST(FilesHashingStreamBufTest, shouldReadSameDataAfterSeek)
+    {
+        std::string content;
+        for (int i = 0; i < 10000; ++i)
+            content.push_back(static_cast<char>(i % 251));
+        std::istringstream source(content);
+        HashingStreamBuf buffer(source);
+        std::istream stream(&buffer);
+        char value = 0;
+        stream.seekg(5000);
+        stream.read(&value, 1);
+        EXPECT_EQ(value, content[5000]);
+        stream.seekg(4097);
+        stream.read(&value, 1);
+        EXPECT_EQ(value, content[4097]);
+        stream.seekg(-2, std::ios_base::cur);
+        stream.read(&value, 1);
+        EXPECT_EQ(value, content[4096]);
+        EXPECT_EQ(stream.tellg(), 4097);
+    }
 }
@@ -0,0 +1,77 @@
+#include <components/misc/spatialhash.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    std::vector<int> findInRange(const SpatialHash<int>& hash, const osg::Vec3f& position, float radius)
+    {
+        std::vector<int> result;
+        hash.forEachInRange(position, radius, [&](int value) { result.push_back(value); });
+        return result;
+    }
+
+    TEST(MiscSpatialHashTest, forEachInRangeShouldNotCallFunctionForEmptyHash)
+    {
+        const SpatialHash<int> hash(100);
+        EXPECT_THAT(findInRange(hash, osg::Vec3f(0, 0, 0), 1000), IsEmpty());
+    }
+
+    TEST(MiscSpatialHashTest, forEachInRangeShouldFindValuesInRadius)
+    {
+        SpatialHash<int> hash(100);
+        hash.add(osg::Vec3f(0, 0, 0), 1);
+        hash.add(osg::Vec3f(150, 0, 0), 2);
+        hash.add(osg::Vec3f(-250, 0, 0), 3);
+        hash.add(osg::Vec3f(0, 0, 250), 4);
+        EXPECT_THAT(findInRange(hash, osg::Vec3f(0, 0, 0), 200), UnorderedElementsAre(1, 2));
+    }
+
+    TEST(MiscSpatialHashTest, forEachInRangeShouldIncludeValuesOnBoundary)
+    {
+        SpatialHash<int> hash(100);
+        hash.add(osg::Vec3f(0, -200, 0), 1);
+        EXPECT_THAT(findInRange(hash, osg::Vec3f(0, 0, 0), 200), ElementsAre(1));
+    }
+
+    TEST(MiscSpatialHashTest, clearShouldRemoveAllValues)
+    {
+        SpatialHash<int> hash(100);
+        hash.add(osg::Vec3f(0, 0, 0), 1);
+        hash.add(osg::Vec3f(1000, 0, 0), 2);
+        hash.clear();
+        hash.add(osg::Vec3f(0, 0, 0), 3);
+        EXPECT_EQ(hash.size(), 1);
+        hash.clear();
+        EXPECT_EQ(hash.size(), 0);
+        EXPECT_THAT(findInRange(hash, osg::Vec3f(0, 0, 0), 2000), IsEmpty());
+    }
+
+    TEST(MiscSpatialHashTest, forEachInRangeShouldMatchBruteForceSearch)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> distribution(-1000, 1000);
+        std::vector<osg::Vec3f> positions(1000);
+        SpatialHash<int> hash(64);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            positions[i] = osg::Vec3f(distribution(random), distribution(random), distribution(random) / 10);
+            hash.add(positions[i], static_cast<int>(i));
+        }
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            std::vector<int> expected;
+            for (std::size_t j = 0; j < positions.size(); ++j)
+                if ((positions[j] - positions[i]).length2() <= 150 * 150)
+                    expected.push_back(static_cast<int>(j));
+            EXPECT_THAT(findInRange(hash, positions[i], 150), UnorderedElementsAreArray(expected)) << i;
+        }
+    }
+}
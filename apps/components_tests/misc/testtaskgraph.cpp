@@ -0,0 +1,152 @@
+#include <components/misc/taskgraph.hpp>
+#include <components/misc/taskgraphworkers.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    TEST(MiscTaskGraphTest, runShouldReturnForEmptyGraph)
+    {
+        TaskGraph graph;
+        graph.start();
+        graph.run();
+        EXPECT_TRUE(graph.isDone());
+    }
+
+    TEST(MiscTaskGraphTest, runShouldCallEachBatchOnce)
+    {
+        TaskGraph graph;
+        std::vector<std::size_t> batches;
+        graph.addTask([&](std::size_t batch) { batches.push_back(batch); }, 3);
+        graph.start();
+        graph.run();
+        EXPECT_THAT(batches, ElementsAre(0, 1, 2));
+        EXPECT_TRUE(graph.isDone());
+    }
+
+    TEST(MiscTaskGraphTest, runShouldRespectDependencies)
+    {
+        TaskGraph graph;
+        std::vector<int> order;
+        const TaskGraph::TaskId first = graph.addTask([&](std::size_t) { order.push_back(1); });
+        const TaskGraph::TaskId second = graph.addTask([&](std::size_t) { order.push_back(2); }, 2);
+        const TaskGraph::TaskId third = graph.addTask([&](std::size_t) { order.push_back(3); });
+        graph.addDependency(second, first);
+        graph.addDependency(third, second);
+        graph.start();
+        graph.run();
+        EXPECT_THAT(order, ElementsAre(1, 2, 2, 3));
+    }
+
+    TEST(MiscTaskGraphTest, startShouldAllowToRunGraphAgain)
+    {
+        TaskGraph graph;
+        int calls = 0;
+        graph.addTask([&](std::size_t) { ++calls; });
+        graph.start();
+        graph.run();
+        graph.start();
+        graph.run();
+        EXPECT_EQ(calls, 2);
+    }
+
+    TEST(MiscTaskGraphTest, runShouldFinishAllTasksWhenCalledFromMultipleThreads)
+    {
+        TaskGraph graph;
+        std::mutex mutex;
+        std::vector<int> order;
+        std::atomic_int batches{ 0 };
+        const auto record = [&](int value) {
+            const std::lock_guard lock(mutex);
+            order.push_back(value);
+        };
+        const TaskGraph::TaskId first = graph.addTask([&](std::size_t) { record(1); });
+        const TaskGraph::TaskId parallel = graph.addTask([&](std::size_t) { ++batches; }, 100);
+        const TaskGraph::TaskId independent = graph.addTask([&](std::size_t) { record(2); });
+        const TaskGraph::TaskId last = graph.addTask([&](std::size_t) { record(3); });
+        graph.addDependency(parallel, first);
+        graph.addDependency(last, parallel);
+        graph.addDependency(last, independent);
+        graph.start();
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+            threads.emplace_back([&] { graph.run(); });
+        for (std::thread& thread : threads)
+            thread.join();
+
+        EXPECT_EQ(batches, 100);
+        ASSERT_EQ(order.size(), 3);
+        EXPECT_EQ(order.back(), 3);
+        EXPECT_TRUE(graph.isDone());
+    }
+
+    TEST(MiscTaskGraphWorkersTest, runWithoutThreadsShouldExecuteGraphByCallingThread)
+    {
+        TaskGraph graph;
+        std::vector<std::thread::id> threads;
+        graph.addTask([&](std::size_t) { threads.push_back(std::this_thread::get_id()); }, 3);
+        graph.start();
+        TaskGraphWorkers workers(0);
+        workers.run(graph);
+        EXPECT_THAT(threads, Each(std::this_thread::get_id()));
+        EXPECT_EQ(threads.size(), 3);
+        EXPECT_TRUE(graph.isDone());
+    }
+
+    TEST(MiscTaskGraphWorkersTest, runShouldFinishAllTasksOfEachGraph)
+    {
+        TaskGraphWorkers workers(3);
+        std::atomic_int batches{ 0 };
+        for (int i = 0; i < 10; ++i)
+        {
+            TaskGraph graph;
+            const TaskGraph::TaskId first = graph.addTask([&](std::size_t) { ++batches; }, 50);
+            const TaskGraph::TaskId second = graph.addTask([&](std::size_t) { ++batches; }, 50);
+            graph.addDependency(second, first);
+            graph.start();
+            workers.run(graph);
+            EXPECT_TRUE(graph.isDone());
+            EXPECT_EQ(batches, (i + 1) * 100);
+        }
+    }
+
+    std::vector<int> runWithWorkers(std::size_t threads, const std::vector<int>& input)
+    {
+        // Same pattern as Actors::think: each batch reads shared state and writes only its own result
+        std::vector<int> result(input.size());
+        TaskGraph graph;
+        graph.addTask(
+            [&](std::size_t batch) {
+                int sum = 0;
+                for (std::size_t i = 0; i < input.size(); ++i)
+                    if (i != batch)
+                        sum += input[i] * static_cast<int>(i % 7);
+                result[batch] = input[batch] * 31 + sum;
+            },
+            input.size());
+        graph.start();
+        TaskGraphWorkers workers(threads);
+        workers.run(graph);
+        return result;
+    }
+
+    TEST(MiscTaskGraphWorkersTest, resultsShouldNotDependOnNumberOfThreads)
+    {
+        std::vector<int> input(1000);
+        for (std::size_t i = 0; i < input.size(); ++i)
+            input[i] = static_cast<int>(i * 13 % 101);
+        const std::vector<int> expected = runWithWorkers(0, input);
+        for (const std::size_t threads : { 1, 2, 4, 8 })
+            EXPECT_EQ(runWithWorkers(threads, input), expected) << "threads=" << threads;
+    }
+}
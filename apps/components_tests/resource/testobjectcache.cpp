@@ -3,8 +3,14 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <osg/Image>
 #include <osg/Object>
 
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace Resource
 {
     namespace
@@ -35,6 +41,13 @@ namespace Resource
             META_Object(ResourceTest, Object)
         };
 
+        osg::ref_ptr<osg::Image> makeImage()
+        {
+            osg::ref_ptr<osg::Image> image(new osg::Image);
+            image->allocateImage(16, 16, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+            return image;
+        }
+
         TEST(ResourceGenericObjectCacheTest, shouldStoreValues)
         {
             osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
@@ -373,5 +386,171 @@ namespace Resource
             cache->addEntryToObjectCache(key, value);
             EXPECT_TRUE(cache->checkInObjectCache(std::string_view("key"), 0));
         }
+
+        TEST(ResourceGenericObjectCacheTest, getStatsShouldReturnMemoryUsage)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            cache->addEntryToObjectCache(1, makeImage());
+            cache->addEntryToObjectCache(2, nullptr);
+            EXPECT_EQ(cache->getStats().mMemoryUsage, 1024);
+
+            cache->addEntryToObjectCache(1, new Object);
+            EXPECT_EQ(cache->getStats().mMemoryUsage, 0);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldEvictLeastRecentlyUsedItemsExceedingMemoryBudget)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->setMemoryBudget(2048);
+
+            const double referenceTime = 3;
+            const double expiryDelay = 10;
+
+            cache->addEntryToObjectCache(1, makeImage(), 1);
+            cache->addEntryToObjectCache(2, makeImage(), 2);
+            cache->addEntryToObjectCache(3, makeImage(), 3);
+
+            cache->update(referenceTime, expiryDelay);
+
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(1), std::nullopt);
+            EXPECT_THAT(cache->getRefFromObjectCacheOrNone(2), Optional(_));
+            EXPECT_THAT(cache->getRefFromObjectCacheOrNone(3), Optional(_));
+
+            const CacheStats stats = cache->getStats();
+            EXPECT_EQ(stats.mEvicted, 1);
+            EXPECT_EQ(stats.mExpired, 0);
+            EXPECT_EQ(stats.mMemoryUsage, 2048);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldNotEvictExternallyReferencedItems)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->setMemoryBudget(1024);
+
+            const double referenceTime = 3;
+            const double expiryDelay = 10;
+
+            const osg::ref_ptr<osg::Image> value = makeImage();
+            cache->addEntryToObjectCache(1, value, 1);
+            cache->addEntryToObjectCache(2, makeImage(), 2);
+
+            cache->update(referenceTime, expiryDelay);
+
+            EXPECT_THAT(cache->getRefFromObjectCacheOrNone(1), Optional(_));
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(2), std::nullopt);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldKeepItemsWithinMemoryBudget)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->setMemoryBudget(4096);
+
+            cache->addEntryToObjectCache(1, makeImage(), 1);
+            cache->addEntryToObjectCache(2, makeImage(), 2);
+
+            cache->update(3, 10);
+
+            EXPECT_EQ(cache->getStats().mSize, 2);
+            EXPECT_EQ(cache->getStats().mEvicted, 0);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldApplyMemoryBudgetToAllShardsTogether)
+        {
+            osg::ref_ptr<GenericObjectCache<std::string>> cache(new GenericObjectCache<std::string>);
+            cache->setMemoryBudget(3 * 1024);
+
+            for (int i = 0; i < 4; ++i)
+                cache->addEntryToObjectCache("key" + std::to_string(i), makeImage(), i + 1);
+
+            cache->update(5, 10);
+
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(std::string_view("key0")), std::nullopt);
+            for (int i = 1; i < 4; ++i)
+                EXPECT_THAT(cache->getRefFromObjectCacheOrNone("key" + std::to_string(i)), Optional(_)) << i;
+
+            const CacheStats stats = cache->getStats();
+            EXPECT_EQ(stats.mEvicted, 1);
+            EXPECT_EQ(stats.mMemoryUsage, 3 * 1024);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, addEntryToObjectCacheShouldUseProvidedSize)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->addEntryToObjectCache(1, new Object, 0.0, 42);
+            EXPECT_EQ(cache->getStats().mMemoryUsage, 42);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, getStatsShouldReturnContentionOfEachShard)
+        {
+            osg::ref_ptr<GenericObjectCache<std::string>> stringCache(new GenericObjectCache<std::string>);
+            EXPECT_EQ(stringCache->getStats().mShardContended.size(), ObjectCacheShards<std::string>::sCount);
+
+            osg::ref_ptr<GenericObjectCache<int>> intCache(new GenericObjectCache<int>);
+            EXPECT_THAT(intCache->getStats().mShardContended, IsEmpty());
+        }
+
+        TEST(ResourceObjectCacheTest, getRemainingStreamSizeShouldReturnSizeFromCurrentPosition)
+        {
+            std::istringstream stream("content");
+            stream.seekg(3);
+            EXPECT_EQ(getRemainingStreamSize(stream), 4);
+            EXPECT_EQ(stream.tellg(), 3);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, callShouldIterateOverAllItemsInAllShards)
+        {
+            osg::ref_ptr<GenericObjectCache<std::string>> cache(new GenericObjectCache<std::string>);
+
+            std::vector<std::string> expected;
+            for (int i = 0; i < 100; ++i)
+            {
+                expected.push_back("key" + std::to_string(i));
+                cache->addEntryToObjectCache(expected.back(), nullptr);
+            }
+
+            std::vector<std::string> actual;
+            cache->call([&](const std::string& key, osg::Object* /*value*/) { actual.push_back(key); });
+
+            EXPECT_THAT(actual, UnorderedElementsAreArray(expected));
+            EXPECT_EQ(cache->getStats().mSize, expected.size());
+        }
+
+        TEST(ResourceGenericObjectCacheTest, lowerBoundShouldReturnFirstNotLessThatGivenKeyOverAllShards)
+        {
+            osg::ref_ptr<GenericObjectCache<std::string>> cache(new GenericObjectCache<std::string>);
+
+            for (int i = 0; i < 100; i += 2)
+                cache->addEntryToObjectCache(std::to_string(1000 + i), nullptr);
+
+            EXPECT_THAT(cache->lowerBound(std::string_view("1051")), Optional(Pair("1052", _)));
+            EXPECT_THAT(cache->lowerBound(std::string_view("0")), Optional(Pair("1000", _)));
+        }
+
+        TEST(ResourceGenericObjectCacheTest, shouldSupportConcurrentAccess)
+        {
+            osg::ref_ptr<GenericObjectCache<std::string>> cache(new GenericObjectCache<std::string>);
+
+            constexpr int threadsCount = 4;
+            constexpr int itemsCount = 1000;
+
+            std::vector<std::thread> threads;
+            for (int i = 0; i < threadsCount; ++i)
+                threads.emplace_back([&, i] {
+                    for (int j = 0; j < itemsCount; ++j)
+                    {
+                        const std::string key = std::to_string(i) + "/" + std::to_string(j);
+                        cache->addEntryToObjectCache(key, nullptr);
+                        cache->getRefFromObjectCache(key);
+                    }
+                });
+            for (std::thread& thread : threads)
+                thread.join();
+
+            const CacheStats stats = cache->getStats();
+            EXPECT_EQ(stats.mSize, threadsCount * itemsCount);
+            EXPECT_EQ(stats.mGet, threadsCount * itemsCount);
+            EXPECT_EQ(stats.mHit, threadsCount * itemsCount);
+        }
     }
 }
@@ -0,0 +1,88 @@
+#include <components/sceneutil/deformationbatch.hpp>
+
+#include <osg/NodeVisitor>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    struct Deformable : osg::Node
+    {
+        std::function<void()> mDeform;
+        bool mDeformedDuringTraversal = false;
+        std::atomic_bool mDeformed{ false };
+
+        void traverse(osg::NodeVisitor& nv) override
+        {
+            DeformationBatch* const batch = findDeformationBatch(nv.getNodePath());
+            ASSERT_NE(batch, nullptr);
+            batch->add([this] {
+                mDeformed = true;
+                if (mDeform)
+                    mDeform();
+            });
+            mDeformedDuringTraversal = mDeformed;
+        }
+    };
+
+    TEST(SceneUtilDeformationBatchTest, findDeformationBatchShouldReturnNullptrForPathWithoutBatch)
+    {
+        osg::ref_ptr<osg::Group> group(new osg::Group);
+        const osg::NodePath path{ group.get() };
+        EXPECT_EQ(findDeformationBatch(path), nullptr);
+    }
+
+    TEST(SceneUtilDeformationBatchTest, addShouldExecuteImmediatelyOutsideOfCullTraversal)
+    {
+        osg::ref_ptr<DeformationBatch> batch(new DeformationBatch);
+        bool deformed = false;
+        batch->add([&] { deformed = true; });
+        EXPECT_TRUE(deformed);
+    }
+
+    TEST(SceneUtilDeformationBatchTest, addShouldExecuteImmediatelyDuringUpdateTraversal)
+    {
+        osg::ref_ptr<DeformationBatch> batch(new DeformationBatch);
+        osg::ref_ptr<Deformable> deformable(new Deformable);
+        batch->addChild(deformable);
+        osg::NodeVisitor visitor(osg::NodeVisitor::UPDATE_VISITOR, osg::NodeVisitor::TRAVERSE_ALL_CHILDREN);
+        batch->accept(visitor);
+        EXPECT_TRUE(deformable->mDeformedDuringTraversal);
+    }
+
+    TEST(SceneUtilDeformationBatchTest, addShouldDeferUntilEndOfCullTraversal)
+    {
+        osg::ref_ptr<DeformationBatch> batch(new DeformationBatch);
+        osg::ref_ptr<Deformable> deformable(new Deformable);
+        batch->addChild(deformable);
+        osg::NodeVisitor visitor(osg::NodeVisitor::CULL_VISITOR, osg::NodeVisitor::TRAVERSE_ALL_CHILDREN);
+        batch->accept(visitor);
+        EXPECT_FALSE(deformable->mDeformedDuringTraversal);
+        EXPECT_TRUE(deformable->mDeformed);
+    }
+
+    TEST(SceneUtilDeformationBatchTest, cullTraversalShouldExecuteAllDeformationsUsingThreads)
+    {
+        osg::ref_ptr<DeformationBatch> batch(new DeformationBatch(3));
+        EXPECT_EQ(batch->getThreadsCount(), 3);
+        std::atomic_int deformed{ 0 };
+        for (int i = 0; i < 100; ++i)
+        {
+            osg::ref_ptr<Deformable> deformable(new Deformable);
+            deformable->mDeform = [&] { ++deformed; };
+            batch->addChild(deformable);
+        }
+        osg::NodeVisitor visitor(osg::NodeVisitor::CULL_VISITOR, osg::NodeVisitor::TRAVERSE_ALL_CHILDREN);
+        for (int frame = 1; frame <= 3; ++frame)
+        {
+            batch->accept(visitor);
+            EXPECT_EQ(deformed, 100 * frame);
+        }
+    }
+}
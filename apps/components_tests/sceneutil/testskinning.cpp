@@ -0,0 +1,117 @@
+#include <components/sceneutil/skinning.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    constexpr float tolerance = 1e-4f;
+
+    osg::Matrixf makeMatrix(std::minstd_rand& random)
+    {
+        std::uniform_real_distribution<float> distribution(-2, 2);
+        osg::Matrixf result;
+        for (int row = 0; row < 4; ++row)
+            for (int column = 0; column < 3; ++column)
+                result(row, column) = distribution(random);
+        return result;
+    }
+
+    osg::Vec3f makeVec3f(std::minstd_rand& random)
+    {
+        std::uniform_real_distribution<float> distribution(-100, 100);
+        return osg::Vec3f(distribution(random), distribution(random), distribution(random));
+    }
+
+    void expectNear(const osg::Vec3f& actual, const osg::Vec3f& expected)
+    {
+        for (int i = 0; i < 3; ++i)
+            EXPECT_NEAR(actual[i], expected[i], tolerance * (1 + std::abs(expected[i])));
+    }
+
+    struct SceneUtilSkinVerticesTest : TestWithParam<std::size_t>
+    {
+        std::minstd_rand mRandom;
+    };
+
+    TEST_P(SceneUtilSkinVerticesTest, shouldMatchOsgTransform)
+    {
+        const std::size_t size = GetParam();
+        SkinningSource source;
+        std::vector<osg::Vec3f> positions;
+        std::vector<osg::Vec3f> normals;
+        std::vector<osg::Vec4f> tangents;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            positions.push_back(makeVec3f(mRandom));
+            normals.push_back(makeVec3f(mRandom));
+            const osg::Vec3f tangent = makeVec3f(mRandom);
+            tangents.emplace_back(tangent.x(), tangent.y(), tangent.z(), i % 2 == 0 ? 1.0f : -1.0f);
+        }
+        // Reversed order to check that results are written at the geometry indices
+        for (std::size_t i = size; i > 0; --i)
+            source.add(static_cast<unsigned short>(i - 1), positions[i - 1], &normals[i - 1], &tangents[i - 1]);
+
+        const osg::Matrixf matrix = makeMatrix(mRandom);
+        std::vector<osg::Vec3f> positionsDst(size);
+        std::vector<osg::Vec3f> normalsDst(size);
+        std::vector<osg::Vec4f> tangentsDst(size);
+        skinVertices(matrix, source, 0, source.size(), positionsDst.data(), normalsDst.data(), tangentsDst.data());
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            expectNear(positionsDst[i], matrix.preMult(positions[i]));
+            expectNear(normalsDst[i], osg::Matrixf::transform3x3(normals[i], matrix));
+            const osg::Vec3f tangent(tangents[i].x(), tangents[i].y(), tangents[i].z());
+            expectNear(osg::Vec3f(tangentsDst[i].x(), tangentsDst[i].y(), tangentsDst[i].z()),
+                osg::Matrixf::transform3x3(tangent, matrix));
+            EXPECT_EQ(tangentsDst[i].w(), tangents[i].w());
+        }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Sizes, SceneUtilSkinVerticesTest, Values(0, 1, 3, 4, 5, 8, 13, 31));
+
+    TEST(SceneUtilSkinningTest, skinVerticesShouldTransformOnlyGivenRange)
+    {
+        std::minstd_rand random;
+        SkinningSource source;
+        for (unsigned short i = 0; i < 20; ++i)
+            source.add(i, makeVec3f(random), nullptr, nullptr);
+
+        const osg::Matrixf matrix = makeMatrix(random);
+        std::vector<osg::Vec3f> positions(20, osg::Vec3f(1, 2, 3));
+        skinVertices(matrix, source, 3, 15, positions.data(), nullptr, nullptr);
+
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            const osg::Vec3f position(
+                source.mPositions[0][i], source.mPositions[1][i], source.mPositions[2][i]);
+            if (i < 3 || i >= 15)
+                EXPECT_EQ(positions[i], osg::Vec3f(1, 2, 3)) << i;
+            else
+                expectNear(positions[i], matrix.preMult(position));
+        }
+    }
+
+    TEST(SceneUtilSkinningTest, accumulateBoneMatrixShouldKeepLastColumn)
+    {
+        std::minstd_rand random;
+        const osg::Matrixf first = makeMatrix(random);
+        const osg::Matrixf second = makeMatrix(random);
+        osg::Matrixf result(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1);
+        accumulateBoneMatrix(first, 0.25f, result);
+        accumulateBoneMatrix(second, 0.75f, result);
+
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int column = 0; column < 3; ++column)
+                EXPECT_NEAR(result(row, column), first(row, column) * 0.25f + second(row, column) * 0.75f, tolerance);
+            EXPECT_EQ(result(row, 3), row == 3 ? 1 : 0);
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#include <components/sceneutil/workqueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace SceneUtil;
+
+    struct CountingWorkItem : WorkItem
+    {
+        std::atomic_int& mCounter;
+
+        explicit CountingWorkItem(std::atomic_int& counter)
+            : mCounter(counter)
+        {
+        }
+
+        void doWork() override { ++mCounter; }
+    };
+
+    TEST(SceneUtilWorkQueueTest, shouldTakeItemsWithHigherPriorityFirst)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(0));
+        osg::ref_ptr<WorkItem> low(new WorkItem);
+        osg::ref_ptr<WorkItem> high(new WorkItem);
+        high->setPriority(1);
+        queue->addWorkItem(low);
+        queue->addWorkItem(high);
+        EXPECT_EQ(queue->removeWorkItem(0), high);
+        EXPECT_EQ(queue->removeWorkItem(0), low);
+        EXPECT_EQ(queue->getNumItems(), 0);
+    }
+
+    TEST(SceneUtilWorkQueueTest, shouldTakeItemsWithSamePriorityInOrder)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(0));
+        osg::ref_ptr<WorkItem> first(new WorkItem);
+        osg::ref_ptr<WorkItem> second(new WorkItem);
+        osg::ref_ptr<WorkItem> front(new WorkItem);
+        queue->addWorkItem(first);
+        queue->addWorkItem(second);
+        queue->addWorkItem(front, true);
+        EXPECT_EQ(queue->removeWorkItem(0), front);
+        EXPECT_EQ(queue->removeWorkItem(0), first);
+        EXPECT_EQ(queue->removeWorkItem(0), second);
+    }
+
+    TEST(SceneUtilWorkQueueTest, shouldTakeItemsCloserToViewPointFirst)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(0));
+        osg::ref_ptr<WorkItem> far(new WorkItem);
+        osg::ref_ptr<WorkItem> near(new WorkItem);
+        far->setPosition(osg::Vec3f(1000, 0, 0));
+        near->setPosition(osg::Vec3f(0, 100, 0));
+        queue->addWorkItem(far);
+        queue->addWorkItem(near);
+        queue->setViewPoint(osg::Vec3f(0, 0, 0));
+        EXPECT_EQ(queue->removeWorkItem(0), near);
+        EXPECT_EQ(queue->removeWorkItem(0), far);
+    }
+
+    TEST(SceneUtilWorkQueueTest, shouldReorderItemsWhenViewPointChanges)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(0));
+        osg::ref_ptr<WorkItem> first(new WorkItem);
+        osg::ref_ptr<WorkItem> second(new WorkItem);
+        first->setPosition(osg::Vec3f(0, 0, 0));
+        second->setPosition(osg::Vec3f(1000, 0, 0));
+        queue->addWorkItem(first);
+        queue->addWorkItem(second);
+        queue->setViewPoint(osg::Vec3f(900, 0, 0));
+        EXPECT_EQ(queue->removeWorkItem(0), second);
+    }
+
+    TEST(SceneUtilWorkQueueTest, shouldDropCancelledItems)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(0));
+        osg::ref_ptr<WorkItem> cancelled(new WorkItem);
+        osg::ref_ptr<WorkItem> item(new WorkItem);
+        queue->addWorkItem(cancelled);
+        queue->addWorkItem(item);
+        cancelled->cancel();
+        EXPECT_EQ(queue->removeWorkItem(0), item);
+        EXPECT_TRUE(cancelled->isDone());
+        EXPECT_EQ(queue->getNumItems(), 0);
+    }
+
+    TEST(SceneUtilWorkQueueTest, shouldCompleteAllItemsWithMultipleThreads)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(4));
+        std::atomic_int counter{ 0 };
+        std::vector<osg::ref_ptr<WorkItem>> items;
+        for (int i = 0; i < 100; ++i)
+        {
+            items.emplace_back(new CountingWorkItem(counter));
+            items.back()->setPriority(i % 3);
+            queue->addWorkItem(items.back());
+        }
+        for (const osg::ref_ptr<WorkItem>& item : items)
+            item->waitTillDone();
+        EXPECT_EQ(counter, 100);
+    }
+
+    TEST(SceneUtilWorkQueueTest, numItemsShouldNotExceedAddedItemsWhenAddingFromMultipleThreads)
+    {
+        constexpr int producers = 4;
+        constexpr int itemsPerProducer = 1000;
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(4));
+        std::atomic_int counter{ 0 };
+        std::vector<std::vector<osg::ref_ptr<WorkItem>>> items(producers);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < producers; ++i)
+            threads.emplace_back([&, i] {
+                for (int j = 0; j < itemsPerProducer; ++j)
+                {
+                    items[i].emplace_back(new CountingWorkItem(counter));
+                    queue->addWorkItem(items[i].back());
+                }
+            });
+        unsigned maxNumItems = 0;
+        while (counter < producers * itemsPerProducer)
+            maxNumItems = std::max(maxNumItems, queue->getNumItems());
+        for (std::thread& thread : threads)
+            thread.join();
+        for (const std::vector<osg::ref_ptr<WorkItem>>& v : items)
+            for (const osg::ref_ptr<WorkItem>& item : v)
+                item->waitTillDone();
+        EXPECT_LE(maxNumItems, static_cast<unsigned>(producers * itemsPerProducer));
+        EXPECT_EQ(queue->getNumItems(), 0);
+    }
+
+    TEST(SceneUtilWorkQueueTest, cancelledItemsShouldNotBeProcessed)
+    {
+        std::atomic_int counter{ 0 };
+        osg::ref_ptr<WorkItem> item(new CountingWorkItem(counter));
+        item->cancel();
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(1));
+        queue->addWorkItem(item);
+        item->waitTillDone();
+        EXPECT_EQ(counter, 0);
+    }
+}
@@ -0,0 +1,93 @@
+#include <components/testing/util.hpp>
+#include <components/vfs/fileindex.hpp>
+#include <components/vfs/filemap.hpp>
+#include <components/vfs/pathutil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace VFS
+{
+    namespace
+    {
+        using namespace testing;
+
+        TEST(VFSFileIndexTest, findInEmptyShouldReturnNullptr)
+        {
+            const FileIndex index;
+            EXPECT_EQ(index.find("foo/bar"), nullptr);
+            EXPECT_FALSE(index.contains("foo/bar"));
+        }
+
+        TEST(VFSFileIndexTest, findShouldReturnEntryForPresentPath)
+        {
+            TestingOpenMW::VFSTestFile file("content");
+            const FileMap files{ { Path::Normalized("foo/bar"), &file } };
+            FileIndex index;
+            index.build(files);
+            const FileIndex::Entry* const entry = index.find("foo/bar");
+            ASSERT_NE(entry, nullptr);
+            EXPECT_EQ(entry->mPath, "foo/bar");
+            EXPECT_EQ(entry->mFile, &file);
+        }
+
+        TEST(VFSFileIndexTest, findShouldReturnNullptrForAbsentPath)
+        {
+            TestingOpenMW::VFSTestFile file("content");
+            const FileMap files{ { Path::Normalized("foo/bar"), &file } };
+            FileIndex index;
+            index.build(files);
+            EXPECT_EQ(index.find("foo/baz"), nullptr);
+            EXPECT_EQ(index.find("foo"), nullptr);
+            EXPECT_EQ(index.find(""), nullptr);
+        }
+
+        TEST(VFSFileIndexTest, shouldSupportNullptrFile)
+        {
+            const FileMap files{ { Path::Normalized("foo/bar"), nullptr } };
+            FileIndex index;
+            index.build(files);
+            EXPECT_TRUE(index.contains("foo/bar"));
+        }
+
+        TEST(VFSFileIndexTest, shouldSupportEmptyPath)
+        {
+            const FileMap files{ { Path::Normalized(""), nullptr } };
+            FileIndex index;
+            index.build(files);
+            EXPECT_TRUE(index.contains(""));
+        }
+
+        TEST(VFSFileIndexTest, shouldFindAllPaths)
+        {
+            FileMap files;
+            for (int i = 0; i < 1000; ++i)
+                files.emplace(Path::Normalized("dir/file" + std::to_string(i) + ".nif"), nullptr);
+            FileIndex index;
+            index.build(files);
+            EXPECT_EQ(index.size(), files.size());
+            for (const auto& [path, file] : files)
+                EXPECT_TRUE(index.contains(path.view())) << path;
+            EXPECT_FALSE(index.contains("dir/file1000.nif"));
+        }
+
+        TEST(VFSFileIndexTest, clearShouldRemoveAllEntries)
+        {
+            const FileMap files{ { Path::Normalized("foo/bar"), nullptr } };
+            FileIndex index;
+            index.build(files);
+            index.clear();
+            EXPECT_EQ(index.size(), 0);
+            EXPECT_FALSE(index.contains("foo/bar"));
+        }
+
+        TEST(VFSManagerTest, existsShouldUseBuiltIndex)
+        {
+            const std::unique_ptr<Manager> vfs
+                = TestingOpenMW::createTestVFS({ { Path::NormalizedView("a/b"), nullptr } });
+            EXPECT_TRUE(vfs->exists(Path::NormalizedView("a/b")));
+            EXPECT_FALSE(vfs->exists(Path::NormalizedView("a/c")));
+        }
+    }
+}
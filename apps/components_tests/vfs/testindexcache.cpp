@@ -0,0 +1,71 @@
+#include <components/testing/util.hpp>
+#include <components/vfs/indexcache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+namespace VFS
+{
+    namespace
+    {
+        using namespace testing;
+
+        TEST(VFSIndexCacheTest, readShouldReturnEmptyCacheForAbsentFile)
+        {
+            const IndexCache cache = readIndexCache(TestingOpenMW::temporaryFilePath("absent_vfs_index_cache"));
+            EXPECT_TRUE(cache.mDirectories.empty());
+            EXPECT_TRUE(cache.mBsas.empty());
+        }
+
+        TEST(VFSIndexCacheTest, readShouldReturnEmptyCacheForInvalidFile)
+        {
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("invalid_vfs_index_cache");
+            std::ofstream(path, std::ios_base::binary) << "invalid";
+            const IndexCache cache = readIndexCache(path);
+            EXPECT_TRUE(cache.mDirectories.empty());
+            EXPECT_TRUE(cache.mBsas.empty());
+        }
+
+        TEST(VFSIndexCacheTest, shouldSupportWriteAndRead)
+        {
+            IndexCache cache;
+            cache.mDirectories["data"] = DirectoryListing{
+                .mFiles = { "meshes/a.nif", "Textures\\B.dds" },
+                .mDirectories = { DirectoryStamp{ .mPath = "", .mModificationTime = 1 },
+                    DirectoryStamp{ .mPath = "meshes", .mModificationTime = 2 } },
+            };
+            Bsa::BSAFile::FileStruct file;
+            file.fileSize = 3;
+            file.offset = 4;
+            file.hash = Bsa::BSAFile::Hash{ 5, 6 };
+            file.namesOffset = 0;
+            cache.mBsas["morrowind.bsa"] = BsaListing{
+                .mStamp = FileStamp{ .mSize = 7, .mModificationTime = 8 },
+                .mFiles = { file },
+                .mNames = { 'a', '\0' },
+            };
+
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("vfs_index_cache");
+            writeIndexCache(cache, path);
+            const IndexCache result = readIndexCache(path);
+
+            ASSERT_EQ(result.mDirectories.size(), 1);
+            const DirectoryListing& listing = result.mDirectories.at("data");
+            EXPECT_EQ(listing.mFiles, (std::vector<std::string>{ "meshes/a.nif", "Textures\\B.dds" }));
+            ASSERT_EQ(listing.mDirectories.size(), 2);
+            EXPECT_EQ(listing.mDirectories[1].mPath, "meshes");
+            EXPECT_EQ(listing.mDirectories[1].mModificationTime, 2);
+
+            ASSERT_EQ(result.mBsas.size(), 1);
+            const BsaListing& bsa = result.mBsas.at("morrowind.bsa");
+            EXPECT_EQ(bsa.mStamp, (FileStamp{ .mSize = 7, .mModificationTime = 8 }));
+            ASSERT_EQ(bsa.mFiles.size(), 1);
+            EXPECT_EQ(bsa.mFiles[0].fileSize, 3);
+            EXPECT_EQ(bsa.mFiles[0].offset, 4);
+            EXPECT_EQ(bsa.mFiles[0].hash.low, 5);
+            EXPECT_EQ(bsa.mFiles[0].hash.high, 6);
+            EXPECT_EQ(bsa.mNames, (std::vector<char>{ 'a', '\0' }));
+        }
+    }
+}
@@ -0,0 +1,175 @@
+#include <components/bsa/bsa_file.hpp>
+#include <components/files/collections.hpp>
+#include <components/files/conversion.hpp>
+#include <components/testing/util.hpp>
+#include <components/vfs/indexcache.hpp>
+#include <components/vfs/manager.hpp>
+#include <components/vfs/pathutil.hpp>
+#include <components/vfs/registerarchives.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace VFS
+{
+    namespace
+    {
+        using namespace testing;
+
+        struct VFSRegisterArchivesTest : Test
+        {
+            std::filesystem::path mDataDir;
+            std::filesystem::path mCachePath;
+
+            void SetUp() override
+            {
+                const std::filesystem::path dir = TestingOpenMW::outputFilePathWithSubDir(
+                    std::filesystem::path("vfs_register_archives")
+                    / UnitTest::GetInstance()->current_test_info()->name());
+                std::filesystem::remove_all(dir);
+                mDataDir = dir / "data";
+                mCachePath = dir / indexCacheFileName;
+                std::filesystem::create_directories(mDataDir);
+            }
+
+            void createArchive(const std::string& name)
+            {
+                Bsa::BSAFile bsa;
+                bsa.open(mDataDir / name);
+                std::istringstream content("content");
+                bsa.addFile("meshes\\a.nif", content);
+            }
+
+            void registerArchives(Manager& vfs, const std::vector<std::string>& archives, bool useLooseFiles)
+            {
+                const Files::Collections collections(Files::PathContainer{ mDataDir });
+                VFS::registerArchives(&vfs, collections, archives, useLooseFiles, mCachePath);
+            }
+
+            // Replaces name of the file in the cached listing to see whether the listing is used
+            void renameCachedBsaFile(const FileStamp& stamp)
+            {
+                IndexCache cache = readIndexCache(mCachePath);
+                ASSERT_EQ(cache.mBsas.size(), 1);
+                BsaListing& listing = cache.mBsas.begin()->second;
+                std::replace(listing.mNames.begin(), listing.mNames.end(), 'a', 'c');
+                listing.mStamp = stamp;
+                writeIndexCache(cache, mCachePath);
+            }
+        };
+
+        TEST_F(VFSRegisterArchivesTest, shouldWriteCacheForUsedArchives)
+        {
+            createArchive("test.bsa");
+            Manager vfs;
+            registerArchives(vfs, { "test.bsa" }, true);
+            const IndexCache cache = readIndexCache(mCachePath);
+            ASSERT_EQ(cache.mBsas.size(), 1);
+            EXPECT_EQ(cache.mBsas.begin()->second.mStamp, getFileStamp(mDataDir / "test.bsa"));
+            ASSERT_EQ(cache.mBsas.begin()->second.mFiles.size(), 1);
+            EXPECT_EQ(cache.mDirectories.size(), 1);
+        }
+
+        TEST_F(VFSRegisterArchivesTest, shouldReuseCachedBsaListing)
+        {
+            createArchive("test.bsa");
+            {
+                Manager vfs;
+                registerArchives(vfs, { "test.bsa" }, false);
+            }
+            renameCachedBsaFile(*getFileStamp(mDataDir / "test.bsa"));
+            Manager vfs;
+            registerArchives(vfs, { "test.bsa" }, false);
+            EXPECT_TRUE(vfs.exists(Path::Normalized("meshes/c.nif")));
+            EXPECT_FALSE(vfs.exists(Path::Normalized("meshes/a.nif")));
+        }
+
+        TEST_F(VFSRegisterArchivesTest, shouldIgnoreCachedBsaListingWhenSizeIsChanged)
+        {
+            createArchive("test.bsa");
+            {
+                Manager vfs;
+                registerArchives(vfs, { "test.bsa" }, false);
+            }
+            FileStamp stamp = *getFileStamp(mDataDir / "test.bsa");
+            ++stamp.mSize;
+            renameCachedBsaFile(stamp);
+            Manager vfs;
+            registerArchives(vfs, { "test.bsa" }, false);
+            EXPECT_TRUE(vfs.exists(Path::Normalized("meshes/a.nif")));
+            EXPECT_FALSE(vfs.exists(Path::Normalized("meshes/c.nif")));
+            EXPECT_EQ(readIndexCache(mCachePath).mBsas.begin()->second.mStamp, getFileStamp(mDataDir / "test.bsa"));
+        }
+
+        TEST_F(VFSRegisterArchivesTest, shouldIgnoreCachedBsaListingWhenModificationTimeIsChanged)
+        {
+            createArchive("test.bsa");
+            {
+                Manager vfs;
+                registerArchives(vfs, { "test.bsa" }, false);
+            }
+            FileStamp stamp = *getFileStamp(mDataDir / "test.bsa");
+            ++stamp.mModificationTime;
+            renameCachedBsaFile(stamp);
+            Manager vfs;
+            registerArchives(vfs, { "test.bsa" }, false);
+            EXPECT_TRUE(vfs.exists(Path::Normalized("meshes/a.nif")));
+            EXPECT_FALSE(vfs.exists(Path::Normalized("meshes/c.nif")));
+        }
+
+        TEST_F(VFSRegisterArchivesTest, shouldReuseCachedDirectoryListing)
+        {
+            std::ofstream(mDataDir / "a.txt") << "content";
+            IndexCache cache;
+            DirectoryListing listing = listDirectory(mDataDir);
+            listing.mFiles = { "b.txt" };
+            cache.mDirectories.emplace(Files::pathToUnicodeString(mDataDir), std::move(listing));
+            writeIndexCache(cache, mCachePath);
+            Manager vfs;
+            registerArchives(vfs, {}, true);
+            EXPECT_TRUE(vfs.exists(Path::Normalized("b.txt")));
+            EXPECT_FALSE(vfs.exists(Path::Normalized("a.txt")));
+        }
+
+        TEST_F(VFSRegisterArchivesTest, shouldIgnoreCachedDirectoryListingWhenDirectoryIsModified)
+        {
+            std::ofstream(mDataDir / "a.txt") << "content";
+            IndexCache cache;
+            DirectoryListing listing = listDirectory(mDataDir);
+            listing.mFiles = { "b.txt" };
+            cache.mDirectories.emplace(Files::pathToUnicodeString(mDataDir), std::move(listing));
+            writeIndexCache(cache, mCachePath);
+            std::filesystem::last_write_time(
+                mDataDir, std::filesystem::last_write_time(mDataDir) + std::chrono::seconds(1));
+            Manager vfs;
+            registerArchives(vfs, {}, true);
+            EXPECT_TRUE(vfs.exists(Path::Normalized("a.txt")));
+            EXPECT_FALSE(vfs.exists(Path::Normalized("b.txt")));
+        }
+
+        TEST_F(VFSRegisterArchivesTest, shouldKeepCacheEntriesOfExistingArchivesNotUsedByThisRun)
+        {
+            createArchive("used.bsa");
+            createArchive("unused.bsa");
+            const std::string unused = Files::pathToUnicodeString(mDataDir / "unused.bsa");
+            const std::string absent = Files::pathToUnicodeString(mDataDir / "absent.bsa");
+            IndexCache cache;
+            cache.mBsas.emplace(unused, BsaListing{ .mStamp = *getFileStamp(mDataDir / "unused.bsa") });
+            cache.mBsas.emplace(absent, BsaListing{});
+            writeIndexCache(cache, mCachePath);
+            Manager vfs;
+            registerArchives(vfs, { "used.bsa" }, false);
+            const IndexCache result = readIndexCache(mCachePath);
+            EXPECT_EQ(result.mBsas.size(), 2);
+            EXPECT_TRUE(result.mBsas.contains(unused));
+            EXPECT_FALSE(result.mBsas.contains(absent));
+        }
+    }
+}
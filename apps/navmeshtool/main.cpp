@@ -190,7 +190,8 @@ namespace NavMeshTool
 
             VFS::Manager vfs;
 
-            VFS::registerArchives(&vfs, fileCollections, archives, true);
+            VFS::registerArchives(
+                &vfs, fileCollections, archives, true, config.getCachePath() / VFS::indexCacheFileName);
 
             Settings::Manager::load(config);
 
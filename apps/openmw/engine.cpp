@@ -31,6 +31,7 @@
 #include <components/stereo/multiview.hpp>
 #include <components/stereo/stereomanager.hpp>
 
+#include <components/sceneutil/deformationbatch.hpp>
 #include <components/sceneutil/glextensions.hpp>
 #include <components/sceneutil/workqueue.hpp>
 
@@ -329,12 +330,14 @@ bool OMW::Engine::frame(unsigned frameNumber, float frametime)
 
         mResourceSystem->reportStats(frameNumber, stats);
 
-        stats->setAttribute(frameNumber, "WorkQueue", mWorkQueue->getNumItems());
-        stats->setAttribute(frameNumber, "WorkThread", mWorkQueue->getNumActiveThreads());
+        mWorkQueue->reportStats(frameNumber, *stats);
+
+        mDeformationBatch->reportStats(frameNumber, *stats);
 
         mMechanicsManager->reportStats(frameNumber, *stats);
         mWorld->reportStats(frameNumber, *stats);
         mLuaManager->reportStats(frameNumber, *stats);
+        mSoundManager->reportStats(frameNumber, *stats);
     }
 
     mStereoManager->updateSettings(Settings::camera().mNearClip, Settings::camera().mViewingDistance);
@@ -718,17 +721,21 @@ void OMW::Engine::prepareEngine()
     mStereoManager = std::make_unique<Stereo::Manager>(
         mViewer, stereoEnabled, Settings::camera().mNearClip, Settings::camera().mViewingDistance);
 
-    osg::ref_ptr<osg::Group> rootNode(new osg::Group);
+    mDeformationBatch
+        = new SceneUtil::DeformationBatch(static_cast<std::size_t>(Settings::general().mSkinningNumThreads.get()));
+    osg::ref_ptr<osg::Group> rootNode = mDeformationBatch;
     mViewer->setSceneData(rootNode);
 
     createWindow();
 
     mVFS = std::make_unique<VFS::Manager>();
 
-    VFS::registerArchives(mVFS.get(), mFileCollections, mArchives, true);
+    VFS::registerArchives(
+        mVFS.get(), mFileCollections, mArchives, true, mCfgMgr.getCachePath() / VFS::indexCacheFileName);
 
     mResourceSystem = std::make_unique<Resource::ResourceSystem>(
         mVFS.get(), Settings::cells().mCacheExpiryDelay, &mEncoder.get()->getStatelessEncoder());
+    mResourceSystem->setMemoryBudget(Settings::cells().mCacheMemoryBudget * 1024 * 1024);
     mResourceSystem->getSceneManager()->getShaderManager().setMaxTextureUnits(mGlMaxTextureImageUnits);
     mResourceSystem->getSceneManager()->setUnRefImageDataAfterApply(
         false); // keep to Off for now to allow better state sharing
@@ -816,7 +823,7 @@ void OMW::Engine::prepareEngine()
     mEnvironment.setInputManager(*mInputManager);
 
     // Create sound system
-    mSoundManager = std::make_unique<MWSound::SoundManager>(mVFS.get(), mUseSound);
+    mSoundManager = std::make_unique<MWSound::SoundManager>(mVFS.get(), mWorkQueue.get(), mUseSound);
     mEnvironment.setSoundManager(*mSoundManager);
 
     // Create the world
@@ -883,7 +890,8 @@ void OMW::Engine::prepareEngine()
     mScriptContext = std::make_unique<MWScript::CompilerContext>(MWScript::CompilerContext::Type_Full);
     mScriptContext->setExtensions(&mExtensions);
 
-    mScriptManager = std::make_unique<MWScript::ScriptManager>(mWorld->getStore(), *mScriptContext, mWarningsMode);
+    mScriptManager = std::make_unique<MWScript::ScriptManager>(mWorld->getStore(), *mScriptContext, mWarningsMode,
+        mCfgMgr.getCachePath() / MWScript::scriptCacheFileName);
     mEnvironment.setScriptManager(*mScriptManager);
 
     // Create game mechanics system
@@ -905,6 +913,12 @@ void OMW::Engine::prepareEngine()
             Log(Debug::Info) << "compiled " << result.second << " of " << result.first << " scripts ("
                              << 100 * static_cast<double>(result.second) / result.first << "%)";
     }
+    else if (const int numThreads = Settings::general().mScriptPrecompileNumThreads; numThreads > 0)
+    {
+        std::pair<int, int> result = mScriptManager->precompile(static_cast<std::size_t>(numThreads));
+        if (result.first)
+            Log(Debug::Info) << "precompiled " << result.second << " of " << result.first << " scripts";
+    }
     if (mCompileAllDialogue)
     {
         std::pair<int, int> result = MWDialogue::ScriptTest::compileAll(&mExtensions, mWarningsMode);
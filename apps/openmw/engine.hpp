@@ -24,6 +24,7 @@ namespace SceneUtil
     class WorkQueue;
     class AsyncScreenCaptureOperation;
     class UnrefQueue;
+    class DeformationBatch;
 }
 
 namespace VFS
@@ -128,6 +129,7 @@ namespace OMW
         std::unique_ptr<VFS::Manager> mVFS;
         std::unique_ptr<Resource::ResourceSystem> mResourceSystem;
         osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
+        osg::ref_ptr<SceneUtil::DeformationBatch> mDeformationBatch;
         std::unique_ptr<SceneUtil::UnrefQueue> mUnrefQueue;
         std::unique_ptr<MWWorld::World> mWorld;
         std::unique_ptr<MWSound::SoundManager> mSoundManager;
@@ -11,6 +11,11 @@
 #include "../mwsound/type.hpp"
 #include "../mwworld/ptr.hpp"
 
+namespace osg
+{
+    class Stats;
+}
+
 namespace MWWorld
 {
     class CellStore;
@@ -213,6 +218,9 @@ namespace MWBase
         ///< @param soundId ID of the sound to fade out.
         ///< @param duration Time until volume reaches 0.
 
+        virtual void preloadSound(const ESM::RefId& soundId) = 0;
+        ///< Start loading the given sound in background, so it can be played without delay later.
+
         virtual bool getSoundPlaying(const MWWorld::ConstPtr& reference, const ESM::RefId& soundId) const = 0;
         ///< Is the given sound currently playing on the given object?
         ///  If you want to check if sound played with playSound is playing, use empty Ptr
@@ -240,6 +248,8 @@ namespace MWBase
         float getSimulationTimeScale() const { return mSimulationTimeScale; }
 
         virtual void clear() = 0;
+
+        virtual void reportStats(unsigned int frameNumber, osg::Stats& stats) const = 0;
     };
 }
 
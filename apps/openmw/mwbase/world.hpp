@@ -81,6 +81,7 @@ namespace DetourNavigator
 {
     struct Navigator;
     struct AgentBounds;
+    class AsyncPathFinder;
 }
 
 namespace MWWorld
@@ -563,6 +564,9 @@ namespace MWBase
 
         virtual DetourNavigator::Navigator* getNavigator() const = 0;
 
+        /// Returns nullptr when paths are found only on the main thread
+        virtual DetourNavigator::AsyncPathFinder* getAsyncPathFinder() const = 0;
+
         virtual void updateActorPath(const MWWorld::ConstPtr& actor, const std::deque<osg::Vec3f>& path,
             const DetourNavigator::AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end) const = 0;
 
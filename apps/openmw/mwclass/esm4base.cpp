@@ -38,4 +38,9 @@ namespace MWClass
         info.caption = MyGUI::TextIterator::toTagsString(MyGUI::UString(name)) + MWGui::ToolTips::getCountString(count);
         return info;
     }
+
+    bool ESM4Impl::isHiddenModel(std::string_view model)
+    {
+        return Misc::StringUtils::ciStartsWith(model, "marker") || Misc::StringUtils::ciEndsWith(model, "lod.nif");
+    }
 }
@@ -28,6 +28,11 @@ namespace MWClass
             MWPhysics::PhysicsSystem& physics);
         MWGui::ToolTipInfo getToolTipInfo(std::string_view name, int count);
 
+        // Hide meshes meshes/marker/* and *LOD.nif in ESM4 cells. It is a temporarty hack.
+        // Needed because otherwise LOD meshes are rendered on top of normal meshes.
+        // TODO: Figure out a better way find markers and LOD meshes; show LOD only outside of active grid.
+        bool isHiddenModel(std::string_view model);
+
         // We don't handle ESM4 player stats yet, so for resolving levelled object we use an arbitrary number.
         constexpr int sDefaultLevel = 5;
 
@@ -100,11 +105,7 @@ namespace MWClass
         {
             std::string_view model = getClassModel<Record>(ptr);
 
-            // Hide meshes meshes/marker/* and *LOD.nif in ESM4 cells. It is a temporarty hack.
-            // Needed because otherwise LOD meshes are rendered on top of normal meshes.
-            // TODO: Figure out a better way find markers and LOD meshes; show LOD only outside of active grid.
-            if (model.empty() || Misc::StringUtils::ciStartsWith(model, "marker")
-                || Misc::StringUtils::ciEndsWith(model, "lod.nif"))
+            if (model.empty() || ESM4Impl::isHiddenModel(model))
                 return {};
 
             return model;
@@ -24,6 +24,7 @@
 #include "../mwmechanics/magiceffects.hpp"
 #include "../mwmechanics/npcstats.hpp"
 
+#include "infoindex.hpp"
 #include "selectwrapper.hpp"
 
 namespace
@@ -708,6 +709,35 @@ bool MWDialogue::Filter::hasFactionRankReputationRequirements(
     return stats.getFactionReputation(factionId) >= faction.mData.mRankData.at(rank).mFactReaction;
 }
 
+void MWDialogue::Filter::getCandidates(
+    const ESM::Dialogue& dialogue, std::vector<const ESM::DialInfo*>& candidates) const
+{
+    const InfoIndex* index
+        = MWBase::Environment::get().getESMStore()->get<ESM::Dialogue>().searchInfoIndex(dialogue.mId);
+
+    if (index == nullptr || &index->getDialogue() != &dialogue)
+    {
+        candidates.clear();
+        for (const ESM::DialInfo& info : dialogue.mInfo)
+            candidates.push_back(&info);
+        return;
+    }
+
+    InfoIndex::Speaker speaker;
+    speaker.mId = mActor.getCellRef().getRefId();
+    speaker.mIsCreature = mActor.getType() != ESM::NPC::sRecordId;
+    if (!speaker.mIsCreature)
+    {
+        const MWWorld::LiveCellRef<ESM::NPC>* npc = mActor.get<ESM::NPC>();
+        speaker.mRace = npc->mBase->mRace;
+        speaker.mClass = npc->mBase->mClass;
+        speaker.mFaction = mActor.getClass().getPrimaryFaction(mActor);
+        speaker.mIsFemale = (npc->mBase->mFlags & ESM::NPC::Female) != 0;
+    }
+
+    index->getCandidates(speaker, candidates);
+}
+
 MWDialogue::Filter::Filter(const MWWorld::Ptr& actor, int choice, bool talkedToPlayer)
     : mActor(actor)
     , mChoice(choice)
@@ -738,14 +768,17 @@ std::vector<MWDialogue::Filter::Response> MWDialogue::Filter::list(
 
     bool infoRefusal = false;
 
+    std::vector<const ESM::DialInfo*> candidates;
+    getCandidates(dialogue, candidates);
+
     // Iterate over topic responses to find a matching one
-    for (const auto& info : dialogue.mInfo)
+    for (const ESM::DialInfo* info : candidates)
     {
-        if (testActor(info) && testPlayer(info) && testSelectStructs(info))
+        if (testActor(*info) && testPlayer(*info) && testSelectStructs(*info))
         {
-            if (testDisposition(info, invertDisposition))
+            if (testDisposition(*info, invertDisposition))
             {
-                infos.emplace_back(&dialogue, &info);
+                infos.emplace_back(&dialogue, info);
                 if (!searchAll)
                     break;
             }
@@ -763,11 +796,13 @@ std::vector<MWDialogue::Filter::Response> MWDialogue::Filter::list(
 
         const ESM::Dialogue& infoRefusalDialogue = *dialogues.find(ESM::RefId::stringRefId("Info Refusal"));
 
-        for (const auto& info : infoRefusalDialogue.mInfo)
-            if (testActor(info) && testPlayer(info) && testSelectStructs(info)
-                && testDisposition(info, invertDisposition))
+        getCandidates(infoRefusalDialogue, candidates);
+
+        for (const ESM::DialInfo* info : candidates)
+            if (testActor(*info) && testPlayer(*info) && testSelectStructs(*info)
+                && testDisposition(*info, invertDisposition))
             {
-                infos.emplace_back(&infoRefusalDialogue, &info);
+                infos.emplace_back(&infoRefusalDialogue, info);
                 if (!searchAll)
                     break;
             }
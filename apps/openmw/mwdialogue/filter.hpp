@@ -52,6 +52,10 @@ namespace MWDialogue
         bool hasFactionRankReputationRequirements(
             const MWWorld::Ptr& actor, const ESM::RefId& factionId, int rank) const;
 
+        void getCandidates(const ESM::Dialogue& dialogue, std::vector<const ESM::DialInfo*>& candidates) const;
+        ///< Get infos of the dialogue which are not filtered out by actor id, race, class, faction and sex in the
+        /// dialogue order.
+
     public:
         using Response = std::pair<const ESM::Dialogue*, const ESM::DialInfo*>;
 
@@ -0,0 +1,87 @@
+#include "infoindex.hpp"
+
+#include <components/esm3/loaddial.hpp>
+#include <components/esm3/loadinfo.hpp>
+
+#include <algorithm>
+
+namespace MWDialogue
+{
+    namespace
+    {
+        enum SexGroup
+        {
+            SexGroup_Any = 0,
+            SexGroup_Male = 1,
+            SexGroup_Female = 2,
+        };
+
+        template <class T>
+        void append(const T& group, const ESM::RefId& id, std::vector<std::uint32_t>& positions)
+        {
+            const auto less = [](const auto& l, const auto& r) { return l.first < r.first; };
+            const std::pair<ESM::RefId, std::uint32_t> key(id, 0);
+            const auto [begin, end] = std::equal_range(group.begin(), group.end(), key, less);
+            for (auto it = begin; it != end; ++it)
+                positions.push_back(it->second);
+        }
+    }
+
+    InfoIndex::InfoIndex(const ESM::Dialogue& dialogue)
+        : mDialogue(&dialogue)
+    {
+        mInfos.reserve(dialogue.mInfo.size());
+
+        for (const ESM::DialInfo& info : dialogue.mInfo)
+        {
+            const auto position = static_cast<std::uint32_t>(mInfos.size());
+            mInfos.push_back(&info);
+
+            // Creatures are filtered out by the empty actor id so all other filters are NPC only
+            if (!info.mActor.empty())
+                mByActor.emplace_back(info.mActor, position);
+            else if (!info.mRace.empty())
+                mByRace.emplace_back(info.mRace, position);
+            else if (!info.mClass.empty())
+                mByClass.emplace_back(info.mClass, position);
+            else if (info.mFactionLess)
+                mByFaction.emplace_back(ESM::RefId(), position);
+            else if (!info.mFaction.empty())
+                mByFaction.emplace_back(info.mFaction, position);
+            else if (info.mData.mGender == ESM::DialInfo::Male)
+                mBySex[SexGroup_Male].push_back(position);
+            else if (info.mData.mGender == ESM::DialInfo::Female)
+                mBySex[SexGroup_Female].push_back(position);
+            else
+                mBySex[SexGroup_Any].push_back(position);
+        }
+
+        for (Group* group : { &mByActor, &mByRace, &mByClass, &mByFaction })
+            std::sort(group->begin(), group->end());
+    }
+
+    void InfoIndex::getCandidates(const Speaker& speaker, std::vector<const ESM::DialInfo*>& candidates) const
+    {
+        std::vector<std::uint32_t> positions;
+
+        append(mByActor, speaker.mId, positions);
+
+        if (!speaker.mIsCreature)
+        {
+            append(mByRace, speaker.mRace, positions);
+            append(mByClass, speaker.mClass, positions);
+            append(mByFaction, speaker.mFaction, positions);
+            const std::vector<std::uint32_t>& any = mBySex[SexGroup_Any];
+            const std::vector<std::uint32_t>& sex = mBySex[speaker.mIsFemale ? SexGroup_Female : SexGroup_Male];
+            positions.insert(positions.end(), any.begin(), any.end());
+            positions.insert(positions.end(), sex.begin(), sex.end());
+        }
+
+        std::sort(positions.begin(), positions.end());
+
+        candidates.clear();
+        candidates.reserve(positions.size());
+        for (const std::uint32_t position : positions)
+            candidates.push_back(mInfos[position]);
+    }
+}
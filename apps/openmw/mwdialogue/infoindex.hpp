@@ -0,0 +1,57 @@
+#ifndef GAME_MWDIALOGUE_INFOINDEX_H
+#define GAME_MWDIALOGUE_INFOINDEX_H
+
+#include <components/esm/refid.hpp>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ESM
+{
+    struct DialInfo;
+    struct Dialogue;
+}
+
+namespace MWDialogue
+{
+    /// @brief Infos of a dialogue grouped by the speaker filters to avoid testing the infos that can't be said by
+    /// a given actor.
+    /// @par Each info is put into a single group by the most selective filter it has: actor id, race, class, faction
+    /// or sex. Candidates are returned in the dialogue order so the first matching info stays the same.
+    class InfoIndex
+    {
+    public:
+        struct Speaker
+        {
+            ESM::RefId mId;
+            ESM::RefId mRace;
+            ESM::RefId mClass;
+            ESM::RefId mFaction;
+            bool mIsCreature = false;
+            bool mIsFemale = false;
+        };
+
+        explicit InfoIndex(const ESM::Dialogue& dialogue);
+
+        const ESM::Dialogue& getDialogue() const { return *mDialogue; }
+
+        /// Replaces content of the candidates with infos which may pass Filter tests for the speaker.
+        void getCandidates(const Speaker& speaker, std::vector<const ESM::DialInfo*>& candidates) const;
+
+    private:
+        using Group = std::vector<std::pair<ESM::RefId, std::uint32_t>>;
+
+        const ESM::Dialogue* mDialogue;
+        std::vector<const ESM::DialInfo*> mInfos;
+        Group mByActor;
+        Group mByRace;
+        Group mByClass;
+        Group mByFaction;
+        // Infos without other speaker filters: any, male and female speaker
+        std::array<std::vector<std::uint32_t>, 3> mBySex;
+    };
+}
+
+#endif
@@ -1,18 +1,25 @@
 #ifndef GAME_MWDIALOGUE_KEYWORDSEARCH_H
 #define GAME_MWDIALOGUE_KEYWORDSEARCH_H
 
-#include <algorithm> // std::reverse
-#include <cctype>
-#include <map>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
-#include <components/misc/strings/algorithm.hpp>
 #include <components/misc/strings/lower.hpp>
+#include <components/misc/utf8stream.hpp>
 
 namespace MWDialogue
 {
-
+    /// @brief Case insensitive search of keywords in UTF-8 text.
+    /// @par Keywords are stored in Aho-Corasick automaton so the text is scanned once regardless of the number of
+    /// keywords. Suffix links have to be rebuilt by buildLinks() after adding keywords, then concurrent searches are
+    /// safe.
     template <typename value_t>
     class KeywordSearch
     {
@@ -26,214 +33,243 @@ namespace MWDialogue
             value_t mValue;
         };
 
+        KeywordSearch() { clear(); }
+
         void seed(std::string_view keyword, value_t value)
         {
             if (keyword.empty())
                 return;
-            seed_impl(keyword, std::move(value), 0, mRoot);
+
+            std::uint32_t node = 0;
+            forEachCharacter(keyword, [&](std::size_t, Char character) {
+                const std::uint32_t next = findChild(node, character);
+                if (next != sNone)
+                {
+                    node = next;
+                    return;
+                }
+                const auto child = static_cast<std::uint32_t>(mNodes.size());
+                const std::uint32_t depth = mNodes[node].mDepth + 1;
+                mNodes.emplace_back().mDepth = depth;
+                auto& children = mNodes[node].mChildren;
+                children.insert(std::upper_bound(children.begin(), children.end(), std::pair(character, child)),
+                    std::pair(character, child));
+                node = child;
+            });
+
+            if (mNodes[node].mKeyword != sNone)
+                throw std::runtime_error("duplicate keyword inserted");
+
+            mNodes[node].mKeyword = static_cast<std::uint32_t>(mValues.size());
+            mValues.push_back(std::move(value));
+            mLinksValid = false;
         }
 
         void clear()
         {
-            mRoot.mChildren.clear();
-            mRoot.mKeyword.clear();
+            mNodes.clear();
+            mNodes.emplace_back();
+            mValues.clear();
+            mLinks.assign(1, Links{});
+            mLinksValid = true;
         }
 
-        bool containsKeyword(std::string_view keyword, value_t& value)
+        /// Prepare the automaton for searching. Must be called after seeding keywords, highlightKeywords throws
+        /// otherwise.
+        void buildLinks()
         {
-            auto it = keyword.begin();
-            auto current = mRoot.mChildren.find(Misc::StringUtils::toLower(*it));
-            if (current == mRoot.mChildren.end())
-                return false;
-            else if (Misc::StringUtils::ciEqual(current->second.mKeyword, keyword))
-            {
-                value = current->second.mValue;
-                return true;
-            }
+            if (mLinksValid)
+                return;
+
+            mLinks.assign(mNodes.size(), Links{});
 
-            for (++it; it != keyword.end(); ++it)
+            // Breadth first order guarantees links of shorter paths to be ready
+            std::vector<std::uint32_t> queue;
+            queue.reserve(mNodes.size());
+            for (const auto& [character, child] : mNodes[0].mChildren)
+                queue.push_back(child);
+
+            for (std::size_t i = 0; i < queue.size(); ++i)
             {
-                auto next = current->second.mChildren.find(Misc::StringUtils::toLower(*it));
-                if (next == current->second.mChildren.end())
-                    return false;
-                if (Misc::StringUtils::ciEqual(next->second.mKeyword, keyword))
+                const std::uint32_t node = queue[i];
+                for (const auto& [character, child] : mNodes[node].mChildren)
                 {
-                    value = next->second.mValue;
-                    return true;
+                    const std::uint32_t suffix = step(mLinks[node].mSuffix, character);
+                    mLinks[child].mSuffix = suffix;
+                    mLinks[child].mOutput = mNodes[suffix].mKeyword != sNone ? suffix : mLinks[suffix].mOutput;
+                    queue.push_back(child);
                 }
-                current = next;
             }
-            return false;
+
+            mLinksValid = true;
+        }
+
+        bool containsKeyword(std::string_view keyword, value_t& value) const
+        {
+            std::uint32_t node = 0;
+            forEachCharacter(keyword, [&](std::size_t, Char character) {
+                if (node != sNone)
+                    node = findChild(node, character);
+            });
+            if (node == sNone || mNodes[node].mKeyword == sNone)
+                return false;
+            value = mValues[mNodes[node].mKeyword];
+            return true;
         }
 
         static bool sortMatches(const Match& left, const Match& right) { return left.mBeg < right.mBeg; }
 
+        /// Find the longest keyword starting at each character and append non overlapping matches preferring longer
+        /// keywords to the output sorted by position.
         void highlightKeywords(Point beg, Point end, std::vector<Match>& out) const
         {
+            if (!mLinksValid)
+                throw std::logic_error("keyword search links are not built");
+
+            const std::string_view text(std::to_address(beg), static_cast<std::size_t>(end - beg));
+
+            // Offsets of the characters in the text and the end of the last one
+            std::vector<std::size_t> offsets;
+            // Longest keyword found for each starting character as the end character index and the node
+            std::vector<std::pair<std::size_t, std::uint32_t>> longest;
+
+            std::uint32_t node = 0;
+            forEachCharacter(text, [&](std::size_t offset, Char character) {
+                offsets.push_back(offset);
+                longest.emplace_back(0, sNone);
+                node = step(node, character);
+                for (std::uint32_t found = mNodes[node].mKeyword != sNone ? node : mLinks[node].mOutput;
+                     found != sNone; found = mLinks[found].mOutput)
+                {
+                    const std::size_t last = offsets.size() - 1;
+                    const std::size_t first = last + 1 - mNodes[found].mDepth;
+                    // Keywords ending later are longer than the ones found before for the same start
+                    longest[first] = { last + 1, found };
+                }
+            });
+            offsets.push_back(text.size());
+
             std::vector<Match> matches;
-            for (Point i = beg; i != end; ++i)
+            for (std::size_t i = 0; i < longest.size(); ++i)
             {
-                // check first character
-                typename Entry::childen_t::const_iterator candidate
-                    = mRoot.mChildren.find(Misc::StringUtils::toLower(*i));
-
-                // no match, on to next character
-                if (candidate == mRoot.mChildren.end())
+                const auto [last, found] = longest[i];
+                if (found == sNone)
                     continue;
+                matches.push_back(Match{ beg + offsets[i], beg + offsets[last], mValues[mNodes[found].mKeyword] });
+            }
 
-                // see how far the match goes
-                Point j = i;
+            resolveOverlaps(matches, out);
 
-                // some keywords might be longer variations of other keywords, so we definitely need a list of
-                // candidates the first element in the pair is length of the match, i.e. depth from the first character
-                // on
-                std::vector<typename std::pair<std::ptrdiff_t, typename Entry::childen_t::const_iterator>> candidates;
+            std::sort(out.begin(), out.end(), sortMatches);
+        }
 
-                while ((j + 1) != end)
-                {
-                    typename Entry::childen_t::const_iterator next
-                        = candidate->second.mChildren.find(Misc::StringUtils::toLower(*++j));
+    private:
+        using Char = Utf8Stream::UnicodeChar;
 
-                    if (next == candidate->second.mChildren.end())
-                    {
-                        if (candidate->second.mKeyword.size() > 0)
-                            candidates.push_back(std::make_pair((j - i), candidate));
-                        break;
-                    }
+        static constexpr std::uint32_t sNone = std::numeric_limits<std::uint32_t>::max();
 
-                    candidate = next;
+        struct Node
+        {
+            // Sorted by character
+            std::vector<std::pair<Char, std::uint32_t>> mChildren;
+            std::uint32_t mKeyword = sNone;
+            std::uint32_t mDepth = 0;
+        };
 
-                    if (candidate->second.mKeyword.size() > 0)
-                        candidates.push_back(std::make_pair((j - i), candidate));
-                }
+        struct Links
+        {
+            // Node for the longest proper suffix of the node path
+            std::uint32_t mSuffix = 0;
+            // Nearest node with a keyword reachable by suffix links
+            std::uint32_t mOutput = sNone;
+        };
 
-                if (candidates.empty())
-                    continue; // didn't match enough to disambiguate, on to next character
+        std::vector<Node> mNodes;
+        std::vector<value_t> mValues;
+        std::vector<Links> mLinks;
+        bool mLinksValid = true;
 
-                // shorter candidates will be added to the vector first. however, we want to check against longer
-                // candidates first
-                std::reverse(candidates.begin(), candidates.end());
+        static Char toLower(Char character)
+        {
+            if (character < 0x80)
+                return static_cast<unsigned char>(Misc::StringUtils::toLower(static_cast<char>(character)));
+            return Utf8Stream::toLowerUtf8(character);
+        }
 
-                for (const auto& [pos, c] : candidates)
+        // Invalid UTF-8 sequences are matched by bytes
+        template <class Function>
+        static void forEachCharacter(std::string_view text, Function&& function)
+        {
+            const auto begin = reinterpret_cast<Utf8Stream::Point>(text.data());
+            const auto end = begin + text.size();
+            for (Utf8Stream::Point it = begin; it != end;)
+            {
+                const auto [character, next] = Utf8Stream::decode(it, end);
+                const std::size_t offset = static_cast<std::size_t>(it - begin);
+                if (character == Utf8Stream::sBadChar())
                 {
-                    candidate = c;
-                    // try to match the rest of the keyword
-                    Point k = i + pos;
-                    Point t = candidate->second.mKeyword.begin() + (k - i);
-
-                    while (k != end && t != candidate->second.mKeyword.end())
-                    {
-                        if (Misc::StringUtils::toLower(*k) != Misc::StringUtils::toLower(*t))
-                            break;
+                    function(offset, Char(0x80000000) | *it);
+                    ++it;
+                    continue;
+                }
+                function(offset, toLower(character));
+                it = next;
+            }
+        }
 
-                        ++k, ++t;
-                    }
+        std::uint32_t findChild(std::uint32_t node, Char character) const
+        {
+            const auto& children = mNodes[node].mChildren;
+            const auto it = std::lower_bound(children.begin(), children.end(), std::pair(character, std::uint32_t(0)));
+            if (it == children.end() || it->first != character)
+                return sNone;
+            return it->second;
+        }
 
-                    // didn't match full keyword, try the next candidate
-                    if (t != candidate->second.mKeyword.end())
-                        continue;
-
-                    // found a keyword, but there might still be longer keywords that start somewhere _within_ this
-                    // keyword we will resolve these overlapping keywords later, choosing the longest one in case of
-                    // conflict
-                    Match match;
-                    match.mValue = candidate->second.mValue;
-                    match.mBeg = i;
-                    match.mEnd = k;
-                    matches.push_back(match);
-                    break;
-                }
+        std::uint32_t step(std::uint32_t node, Char character) const
+        {
+            while (true)
+            {
+                const std::uint32_t next = findChild(node, character);
+                if (next != sNone)
+                    return next;
+                if (node == 0)
+                    return 0;
+                node = mLinks[node].mSuffix;
             }
+        }
 
-            // resolve overlapping keywords
+        // Matches are sorted by the beginning and each starts at a different position. Take the longest match from
+        // each chain of overlapping matches, drop everything it overlaps and repeat.
+        static void resolveOverlaps(std::vector<Match>& matches, std::vector<Match>& out)
+        {
             while (!matches.empty())
             {
                 std::size_t longestKeywordSize = 0;
-                typename std::vector<Match>::iterator longestKeyword = matches.begin();
-                for (typename std::vector<Match>::iterator it = matches.begin(); it != matches.end(); ++it)
+                auto longestKeyword = matches.begin();
+                for (auto it = matches.begin(); it != matches.end(); ++it)
                 {
-                    std::size_t size = it->mEnd - it->mBeg;
+                    const std::size_t size = it->mEnd - it->mBeg;
                     if (size > longestKeywordSize)
                     {
                         longestKeywordSize = size;
                         longestKeyword = it;
                     }
 
-                    typename std::vector<Match>::iterator next = it;
-                    ++next;
+                    const auto next = std::next(it);
 
-                    if (next == matches.end())
-                        break;
-
-                    if (it->mEnd <= next->mBeg)
-                    {
+                    if (next == matches.end() || it->mEnd <= next->mBeg)
                         break; // no overlap
-                    }
                 }
 
-                Match keyword = *longestKeyword;
-                matches.erase(longestKeyword);
+                const Match keyword = *longestKeyword;
                 out.push_back(keyword);
                 // erase anything that overlaps with the keyword we just added to the output
-                for (typename std::vector<Match>::iterator it = matches.begin(); it != matches.end();)
-                {
-                    if (it->mBeg < keyword.mEnd && it->mEnd > keyword.mBeg)
-                        it = matches.erase(it);
-                    else
-                        ++it;
-                }
-            }
-
-            std::sort(out.begin(), out.end(), sortMatches);
-        }
-
-    private:
-        struct Entry
-        {
-            typedef std::map<wchar_t, Entry> childen_t;
-
-            std::string mKeyword;
-            value_t mValue;
-            childen_t mChildren;
-        };
-
-        void seed_impl(std::string_view keyword, value_t value, size_t depth, Entry& entry)
-        {
-            auto ch = Misc::StringUtils::toLower(keyword.at(depth));
-
-            typename Entry::childen_t::iterator j = entry.mChildren.find(ch);
-
-            if (j == entry.mChildren.end())
-            {
-                entry.mChildren[ch].mValue = std::move(value);
-                entry.mChildren[ch].mKeyword = keyword;
-            }
-            else
-            {
-                if (j->second.mKeyword.size() > 0)
-                {
-                    if (keyword == j->second.mKeyword)
-                        throw std::runtime_error("duplicate keyword inserted");
-
-                    const auto& pushKeyword = j->second.mKeyword;
-
-                    if (depth >= pushKeyword.size())
-                        throw std::runtime_error("unexpected");
-
-                    if (depth + 1 < pushKeyword.size())
-                    {
-                        seed_impl(pushKeyword, j->second.mValue, depth + 1, j->second);
-                        j->second.mKeyword.clear();
-                    }
-                }
-                if (depth + 1 == keyword.size())
-                    j->second.mKeyword = value;
-                else // depth+1 < keyword.size()
-                    seed_impl(keyword, std::move(value), depth + 1, j->second);
+                matches.erase(std::remove_if(matches.begin(), matches.end(),
+                                  [&](const Match& v) { return v.mBeg < keyword.mEnd && v.mEnd > keyword.mBeg; }),
+                    matches.end());
             }
         }
-
-        Entry mRoot;
     };
 
 }
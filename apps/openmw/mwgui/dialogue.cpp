@@ -598,6 +598,7 @@ namespace MWGui
             t->eventTopicActivated += MyGUI::newDelegate(this, &DialogueWindow::onTopicActivated);
             mTopicLinks[topicId] = std::move(t);
         }
+        mKeywordSearch.buildLinks();
 
         redrawTopicsList();
         updateHistory();
@@ -58,6 +58,7 @@ namespace MWGui
 
                 for (MWBase::Journal::TTopicIter i = journal->topicBegin(); i != journal->topicEnd(); ++i)
                     mKeywordSearch.seed(i->second.getName(), intptr_t(&i->second));
+                mKeywordSearch.buildLinks();
 
                 mKeywordSearchLoaded = true;
             }
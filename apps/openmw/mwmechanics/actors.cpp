@@ -10,6 +10,7 @@
 #include <components/misc/mathutil.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/rng.hpp>
+#include <components/misc/taskgraphworkers.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/settings/values.hpp>
 
@@ -117,8 +118,8 @@ namespace
     }
 
     template <class T>
-    void forEachFollowingPackage(
-        const std::list<MWMechanics::Actor>& actors, const MWWorld::Ptr& actorPtr, const MWWorld::Ptr& player, T&& func)
+    void forEachFollowingPackage(const MWMechanics::Actors::Storage& actors, const MWWorld::Ptr& actorPtr,
+        const MWWorld::Ptr& player, T&& func)
     {
         for (const MWMechanics::Actor& actor : actors)
         {
@@ -316,7 +317,7 @@ namespace MWMechanics
         }
 
         void updateHeadTracking(
-            const MWWorld::Ptr& ptr, const std::list<Actor>& actors, bool isPlayer, CharacterController& ctrl)
+            const MWWorld::Ptr& ptr, const Actors::Storage& actors, bool isPlayer, CharacterController& ctrl)
         {
             float sqrHeadTrackDistance = std::numeric_limits<float>::max();
             MWWorld::Ptr headTrackTarget;
@@ -405,6 +406,14 @@ namespace MWMechanics
         }
     }
 
+    Actors::Actors()
+        : mThinkWorkers(
+            std::make_unique<Misc::TaskGraphWorkers>(static_cast<std::size_t>(Settings::game().mAiThinkNumThreads)))
+    {
+    }
+
+    Actors::~Actors() = default;
+
     void Actors::updateActor(const MWWorld::Ptr& ptr, float duration) const
     {
         // magic effects
@@ -933,26 +942,26 @@ namespace MWMechanics
 
     bool Actors::isAttackPreparing(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return false;
-        return it->second->getCharacterController().isAttackPreparing();
+        return actor->getCharacterController().isAttackPreparing();
     }
 
     bool Actors::isRunning(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return false;
-        return it->second->getCharacterController().isRunning();
+        return actor->getCharacterController().isRunning();
     }
 
     bool Actors::isSneaking(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return false;
-        return it->second->getCharacterController().isSneaking();
+        return actor->getCharacterController().isSneaking();
     }
 
     static void updateDrowning(const MWWorld::Ptr& ptr, float duration, bool isKnockedOut, bool isPlayer)
@@ -1196,11 +1205,16 @@ namespace MWMechanics
         MWRender::Animation* anim = MWBase::Environment::get().getWorld()->getAnimation(ptr);
         if (!anim)
             return;
-        const auto it = mActors.emplace(mActors.end(), ptr, anim);
-        mIndex.emplace(ptr.mRef, it);
+        const ActorHandle handle = mActors.emplace(ptr.mRef, ptr, anim);
+        Actor& actor = *mActors.get(handle);
+        const std::size_t index = mActors.getIndex(handle);
+        mHotData.resize(mActors.getDenseSize());
+        // Actor may be added during the update so its data have to be valid for the rest of the frame
+        updateHotData(index, ptr, getPlayer().getRefData().getPosition().asVec3(),
+            Settings::game().mActorsProcessingRange);
 
         if (updateImmediately)
-            it->getCharacterController().update(0);
+            actor.getCharacterController().update(0);
 
         // We should initially hide actors outside of processing range.
         // Note: since we update player after other actors, distance will be incorrect during teleportation.
@@ -1208,7 +1222,53 @@ namespace MWMechanics
         if (MWBase::Environment::get().getWorld()->getPlayer().wasTeleported())
             return;
 
-        updateVisibility(ptr, it->getCharacterController());
+        updateVisibility(ptr, actor.getCharacterController());
+    }
+
+    void Actors::HotData::resize(std::size_t size)
+    {
+        mPositions.resize(size);
+        mFlags.resize(size);
+        mRotationsZ.resize(size);
+        mMaxSpeeds.resize(size);
+        mVelocities.resize(size);
+        mHalfExtents.resize(size);
+    }
+
+    void Actors::HotData::move(std::size_t from, std::size_t to)
+    {
+        mPositions[to] = mPositions[from];
+        mFlags[to] = mFlags[from];
+        mRotationsZ[to] = mRotationsZ[from];
+        mMaxSpeeds[to] = mMaxSpeeds[from];
+        mVelocities[to] = mVelocities[from];
+        mHalfExtents[to] = mHalfExtents[from];
+    }
+
+    void Actors::compactActors()
+    {
+        mActors.compact([&](std::size_t from, std::size_t to) { mHotData.move(from, to); });
+        mHotData.resize(mActors.getDenseSize());
+    }
+
+    void Actors::updateHotData(
+        std::size_t index, const MWWorld::Ptr& ptr, const osg::Vec3f& playerPos, int actorsProcessingRange)
+    {
+        const osg::Vec3f position = ptr.getRefData().getPosition().asVec3();
+        const float distSqr = (playerPos - position).length2();
+        std::uint8_t flags = 0;
+        if (ptr.getClass().getCreatureStats(ptr).isDead())
+            flags |= HotFlag_Dead;
+        if (distSqr <= actorsProcessingRange * actorsProcessingRange)
+            flags |= HotFlag_InProcessingRange;
+        mHotData.mPositions[index] = position;
+        mHotData.mFlags[index] = flags;
+    }
+
+    void Actors::updateHotData(const osg::Vec3f& playerPos, int actorsProcessingRange)
+    {
+        for (auto it = mActors.begin(); it != mActors.end(); ++it)
+            updateHotData(it.getIndex(), it->getPtr(), playerPos, actorsProcessingRange);
     }
 
     void Actors::updateVisibility(const MWWorld::Ptr& ptr, CharacterController& ctrl) const
@@ -1243,21 +1303,19 @@ namespace MWMechanics
 
     void Actors::removeActor(const MWWorld::Ptr& ptr, bool keepActive)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
+        if (const Actor* const actor = mActors.find(ptr.mRef))
         {
             if (!keepActive)
-                removeTemporaryEffects(iter->second->getPtr());
-            mActors.erase(iter->second);
-            mIndex.erase(iter);
+                removeTemporaryEffects(actor->getPtr());
+            actor->getPtr().getClass().getCreatureStats(actor->getPtr()).getAiSequence().finishThink();
+            mActors.erase(ptr.mRef);
         }
     }
 
     void Actors::castSpell(const MWWorld::Ptr& ptr, const ESM::RefId& spellId, bool scriptedSpell) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().castSpell(spellId, scriptedSpell);
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            actor->getCharacterController().castSpell(spellId, scriptedSpell);
     }
 
     bool Actors::isActorDetected(const MWWorld::Ptr& actor, const MWWorld::Ptr& observer) const
@@ -1293,31 +1351,55 @@ namespace MWMechanics
 
     void Actors::updateActor(const MWWorld::Ptr& old, const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(old.mRef);
-        if (iter != mIndex.end())
-            iter->second->updatePtr(ptr);
+        if (Actor* const actor = mActors.find(old.mRef))
+            actor->updatePtr(ptr);
     }
 
     void Actors::dropActors(const MWWorld::CellStore* cellStore, const MWWorld::Ptr& ignore)
     {
-        for (auto iter = mActors.begin(); iter != mActors.end();)
+        for (const Actor& actor : mActors)
         {
-            if ((iter->getPtr().isInCell() && iter->getPtr().getCell() == cellStore) && iter->getPtr() != ignore)
+            const MWWorld::Ptr& ptr = actor.getPtr();
+            if ((ptr.isInCell() && ptr.getCell() == cellStore) && ptr != ignore)
             {
-                removeTemporaryEffects(iter->getPtr());
-                mIndex.erase(iter->getPtr().mRef);
-                iter = mActors.erase(iter);
+                removeTemporaryEffects(ptr);
+                ptr.getClass().getCreatureStats(ptr).getAiSequence().finishThink();
+                // Leaves a hole in mActors so the loop can continue
+                mActors.erase(ptr.mRef);
             }
+        }
+    }
+
+    void Actors::updateActorsGrid()
+    {
+        const MWBase::World* const world = MWBase::Environment::get().getWorld();
+        mActorsGrid.clear();
+        for (auto it = mActors.begin(); it != mActors.end(); ++it)
+        {
+            const std::size_t index = it.getIndex();
+            const MWWorld::Ptr& ptr = it->getPtr();
+            const ESM::Position& position = ptr.getRefData().getPosition();
+            const float maxSpeed = ptr.getClass().getMaxSpeed(ptr);
+            mHotData.mPositions[index] = position.asVec3();
+            mHotData.mRotationsZ[index] = position.rot[2];
+            mHotData.mMaxSpeeds[index] = maxSpeed;
+            mHotData.mVelocities[index] = ptr.getClass().getMovementSettings(ptr).asVec3() * maxSpeed;
+            mHotData.mHalfExtents[index] = world->getHalfExtents(ptr);
+            if (ptr.getClass().getCreatureStats(ptr).isDead())
+                mHotData.mFlags[index] |= HotFlag_Dead;
             else
-                ++iter;
+                mHotData.mFlags[index] &= ~HotFlag_Dead;
+            mActorsGrid.add(mHotData.mPositions[index], index);
         }
     }
 
-    void Actors::predictAndAvoidCollisions(float duration) const
+    void Actors::predictAndAvoidCollisions(float duration)
     {
         if (!MWBase::Environment::get().getMechanicsManager()->isAIActive())
             return;
 
+        updateActorsGrid();
+
         const float minGap = 10.f;
         const float maxDistForPartialAvoiding = 200.f;
         const float maxDistForStrictAvoiding = 100.f;
@@ -1325,14 +1407,14 @@ namespace MWMechanics
         const bool giveWayWhenIdle = Settings::game().mNPCsGiveWay;
 
         const MWWorld::Ptr player = getPlayer();
-        const MWBase::World* const world = MWBase::Environment::get().getWorld();
-        for (const Actor& actor : mActors)
+        for (auto it = mActors.begin(); it != mActors.end(); ++it)
         {
-            const MWWorld::Ptr& ptr = actor.getPtr();
+            const std::size_t index = it.getIndex();
+            const MWWorld::Ptr& ptr = it->getPtr();
             if (ptr == player)
                 continue; // Don't interfere with player controls.
 
-            const float maxSpeed = ptr.getClass().getMaxSpeed(ptr);
+            const float maxSpeed = mHotData.mMaxSpeeds[index];
             if (maxSpeed == 0.0)
                 continue; // Can't move, so there is no sense to predict collisions.
 
@@ -1375,9 +1457,9 @@ namespace MWMechanics
                 continue;
 
             const osg::Vec2f baseSpeed = origMovement * maxSpeed;
-            const osg::Vec3f basePos = ptr.getRefData().getPosition().asVec3();
-            const float baseRotZ = ptr.getRefData().getPosition().rot[2];
-            const osg::Vec3f halfExtents = world->getHalfExtents(ptr);
+            const osg::Vec3f basePos = mHotData.mPositions[index];
+            const float baseRotZ = mHotData.mRotationsZ[index];
+            const osg::Vec3f halfExtents = mHotData.mHalfExtents[index];
             const float maxDistToCheck = isMoving ? maxDistForPartialAvoiding : maxDistForStrictAvoiding;
 
             float timeToCheck = maxTimeToCheck;
@@ -1389,15 +1471,17 @@ namespace MWMechanics
             osg::Vec2f movementCorrection(0, 0);
             float angleToApproachingActor = 0;
 
-            // Iterate through all other actors and predict collisions.
-            for (const Actor& otherActor : mActors)
+            // Iterate through all other actors nearby and predict collisions.
+            mNeighbours.clear();
+            mActorsGrid.forEachInRange(
+                basePos, maxDistToCheck, [&](std::size_t otherIndex) { mNeighbours.push_back(otherIndex); });
+            for (const std::size_t otherIndex : mNeighbours)
             {
-                const MWWorld::Ptr& otherPtr = otherActor.getPtr();
-                if (otherPtr == ptr || otherPtr == currentTarget)
+                if (otherIndex == index)
                     continue;
 
-                const osg::Vec3f otherHalfExtents = world->getHalfExtents(otherPtr);
-                const osg::Vec3f deltaPos = otherPtr.getRefData().getPosition().asVec3() - basePos;
+                const osg::Vec3f otherHalfExtents = mHotData.mHalfExtents[otherIndex];
+                const osg::Vec3f deltaPos = mHotData.mPositions[otherIndex] - basePos;
                 const osg::Vec2f relPos = Misc::rotateVec2f(osg::Vec2f(deltaPos.x(), deltaPos.y()), baseRotZ);
                 const float dist = deltaPos.length();
 
@@ -1409,9 +1493,8 @@ namespace MWMechanics
                 if (deltaPos.z() > halfExtents.z() * 2 || deltaPos.z() < -otherHalfExtents.z() * 2)
                     continue;
 
-                const osg::Vec3f speed = otherPtr.getClass().getMovementSettings(otherPtr).asVec3()
-                    * otherPtr.getClass().getMaxSpeed(otherPtr);
-                const float rotZ = otherPtr.getRefData().getPosition().rot[2];
+                const osg::Vec3f& speed = mHotData.mVelocities[otherIndex];
+                const float rotZ = mHotData.mRotationsZ[otherIndex];
                 const osg::Vec2f relSpeed
                     = Misc::rotateVec2f(osg::Vec2f(speed.x(), speed.y()), baseRotZ - rotZ) - baseSpeed;
 
@@ -1429,6 +1512,10 @@ namespace MWMechanics
                 if (t < 0 || t > timeToCollision)
                     continue;
 
+                const MWWorld::Ptr& otherPtr = mActors.getAt(otherIndex)->getPtr();
+                if (otherPtr == currentTarget)
+                    continue;
+
                 // Check visibility and awareness last as it's expensive.
                 if (!MWBase::Environment::get().getWorld()->getLOS(otherPtr, ptr))
                     continue;
@@ -1444,7 +1531,7 @@ namespace MWMechanics
                         (maxDistForPartialAvoiding - dist) / (maxDistForPartialAvoiding - maxDistForStrictAvoiding),
                         0.f, 1.f);
                 movementCorrection = posAtT * coef;
-                if (otherPtr.getClass().getCreatureStats(otherPtr).isDead())
+                if (mHotData.mFlags[otherIndex] & HotFlag_Dead)
                     // In case of dead body still try to go around (it looks natural), but reduce the correction twice.
                     movementCorrection.y() *= 0.5f;
             }
@@ -1461,14 +1548,68 @@ namespace MWMechanics
                     newMovement *= origMovement.length(); // Keep the original speed.
                 movement.mPosition[0] = newMovement.x();
                 movement.mPosition[1] = newMovement.y();
+                // Actors processed later predict collisions with the corrected movement
+                mHotData.mVelocities[index] = movement.asVec3() * maxSpeed;
                 if (shouldTurnToApproachingActor)
                     zTurn(ptr, angleToApproachingActor);
             }
         }
     }
 
+    void Actors::think(float duration, const MWWorld::Ptr& player)
+    {
+        // Same conditions as for AiSequence::execute in update, caches are filled on the main thread
+        mThinkingActors.clear();
+        for (auto it = mActors.begin(); it != mActors.end(); ++it)
+        {
+            if (!(mHotData.mFlags[it.getIndex()] & HotFlag_InProcessingRange))
+                continue;
+
+            const MWWorld::Ptr& ptr = it->getPtr();
+            if (ptr == player || !isConscious(ptr))
+                continue;
+
+            const MWBase::LuaManager::ActorControls* luaControls
+                = MWBase::Environment::get().getLuaManager()->getActorControls(ptr);
+            if (luaControls != nullptr && luaControls->mDisableAI)
+                continue;
+
+            if (ptr.getClass().getCreatureStats(ptr).getAiSequence().prepareThink(ptr))
+                mThinkingActors.push_back(ptr.mRef);
+        }
+
+        if (mThinkingActors.empty())
+            return;
+
+        mThinkGraph.clear();
+        mThinkGraph.addTask(
+            [&](std::size_t index) {
+                const MWWorld::Ptr& ptr = mActors.find(mThinkingActors[index])->getPtr();
+                ptr.getClass().getCreatureStats(ptr).getAiSequence().think(ptr, duration);
+            },
+            mThinkingActors.size());
+        mThinkGraph.start();
+        mThinkWorkers->run(mThinkGraph);
+    }
+
+    void Actors::finishThink()
+    {
+        // Actors removed during the update drop their results in removeActor and dropActors
+        for (const MWWorld::LiveCellRefBase* ref : mThinkingActors)
+        {
+            if (const Actor* const actor = mActors.find(ref))
+            {
+                const MWWorld::Ptr& ptr = actor->getPtr();
+                ptr.getClass().getCreatureStats(ptr).getAiSequence().finishThink();
+            }
+        }
+        mThinkingActors.clear();
+    }
+
     void Actors::update(float duration, bool paused)
     {
+        compactActors();
+
         if (!paused)
         {
             const float updateEquippedLightInterval = 1.0f;
@@ -1507,17 +1648,22 @@ namespace MWMechanics
             }
             const int actorsProcessingRange = Settings::game().mActorsProcessingRange;
 
+            updateHotData(playerPos, actorsProcessingRange);
+
+            if (aiActive)
+                think(duration, player);
+
             // AI and magic effects update
-            for (Actor& actor : mActors)
+            for (auto it = mActors.begin(); it != mActors.end(); ++it)
             {
+                Actor& actor = *it;
                 const bool isPlayer = actor.getPtr() == player;
                 CharacterController& ctrl = actor.getCharacterController();
                 MWBase::LuaManager::ActorControls* luaControls
                     = MWBase::Environment::get().getLuaManager()->getActorControls(actor.getPtr());
 
-                const float distSqr = (playerPos - actor.getPtr().getRefData().getPosition().asVec3()).length2();
                 // AI processing is only done within given distance to the player.
-                const bool inProcessingRange = distSqr <= actorsProcessingRange * actorsProcessingRange;
+                const bool inProcessingRange = (mHotData.mFlags[it.getIndex()] & HotFlag_InProcessingRange) != 0;
 
                 // If dead or no longer in combat, no longer store any actors who attempted to hit us. Also remove for
                 // the player.
@@ -1559,6 +1705,7 @@ namespace MWMechanics
 
                     if (!cellChanged && worldScene->hasCellChanged())
                     {
+                        finishThink();
                         return; // for now abort update of the old cell when cell changes by teleportation magic effect
                                 // a better solution might be to apply cell changes at the end of the frame
                     }
@@ -1616,6 +1763,8 @@ namespace MWMechanics
                 }
             }
 
+            finishThink();
+
             if (Settings::game().mNPCsAvoidCollisions)
                 predictAndAvoidCollisions(duration);
 
@@ -1626,9 +1775,9 @@ namespace MWMechanics
 
             // Animation/movement update
             CharacterController* playerCharacter = nullptr;
-            for (Actor& actor : mActors)
+            for (auto it = mActors.begin(); it != mActors.end(); ++it)
             {
-                const float dist = (playerPos - actor.getPtr().getRefData().getPosition().asVec3()).length();
+                Actor& actor = *it;
                 const bool isPlayer = actor.getPtr() == player;
                 CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
                 // Actors with active AI should be able to move.
@@ -1638,7 +1787,8 @@ namespace MWMechanics
                     MWMechanics::AiSequence& seq = stats.getAiSequence();
                     alwaysActive = !seq.isEmpty() && seq.getActivePackage().alwaysActive();
                 }
-                const bool inRange = isPlayer || dist <= actorsProcessingRange || alwaysActive;
+                const bool inRange = isPlayer || (mHotData.mFlags[it.getIndex()] & HotFlag_InProcessingRange) != 0
+                    || alwaysActive;
                 const int activeFlag = isPlayer ? 2 : 1; // Can be changed back to '2' to keep updating bounding boxes
                                                          // off screen (more accurate, but slower)
                 const int active = inRange ? activeFlag : 0;
@@ -1728,14 +1878,13 @@ namespace MWMechanics
 
     void Actors::resurrect(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
+        if (Actor* const actor = mActors.find(ptr.mRef))
         {
-            if (iter->second->getCharacterController().isDead())
+            if (actor->getCharacterController().isDead())
             {
                 // Actor has been resurrected. Notify the CharacterController and re-enable collision.
-                MWBase::Environment::get().getWorld()->enableActorCollision(iter->second->getPtr(), true);
-                iter->second->getCharacterController().resurrect();
+                MWBase::Environment::get().getWorld()->enableActorCollision(actor->getPtr(), true);
+                actor->getCharacterController().resurrect();
             }
         }
     }
@@ -1983,18 +2132,16 @@ namespace MWMechanics
 
     void Actors::forceStateUpdate(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().forceStateUpdate();
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            actor->getCharacterController().forceStateUpdate();
     }
 
     bool Actors::playAnimationGroup(
         const MWWorld::Ptr& ptr, std::string_view groupName, int mode, uint32_t number, bool scripted) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
+        if (Actor* const actor = mActors.find(ptr.mRef))
         {
-            return iter->second->getCharacterController().playGroup(groupName, mode, number, scripted);
+            return actor->getCharacterController().playGroup(groupName, mode, number, scripted);
         }
         else
         {
@@ -2007,40 +2154,35 @@ namespace MWMechanics
     bool Actors::playAnimationGroupLua(const MWWorld::Ptr& ptr, std::string_view groupName, uint32_t loops, float speed,
         std::string_view startKey, std::string_view stopKey, bool forceLoop)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            return iter->second->getCharacterController().playGroupLua(
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            return actor->getCharacterController().playGroupLua(
                 groupName, speed, startKey, stopKey, loops, forceLoop);
         return false;
     }
 
     void Actors::enableLuaAnimations(const MWWorld::Ptr& ptr, bool enable)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().enableLuaAnimations(enable);
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            actor->getCharacterController().enableLuaAnimations(enable);
     }
 
     void Actors::skipAnimation(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().skipAnim();
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            actor->getCharacterController().skipAnim();
     }
 
     bool Actors::checkAnimationPlaying(const MWWorld::Ptr& ptr, const std::string& groupName) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            return iter->second->getCharacterController().isAnimPlaying(groupName);
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            return actor->getCharacterController().isAnimPlaying(groupName);
         return false;
     }
 
     bool Actors::checkScriptedAnimationPlaying(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            return iter->second->getCharacterController().isScriptedAnimPlaying();
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            return actor->getCharacterController().isScriptedAnimPlaying();
         return false;
     }
 
@@ -2052,9 +2194,8 @@ namespace MWMechanics
 
     void Actors::clearAnimationQueue(const MWWorld::Ptr& ptr, bool clearScripted)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().clearAnimQueue(clearScripted);
+        if (Actor* const actor = mActors.find(ptr.mRef))
+            actor->getCharacterController().clearAnimQueue(clearScripted);
     }
 
     void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out) const
@@ -2275,8 +2416,8 @@ namespace MWMechanics
 
     void Actors::clear()
     {
-        mIndex.clear();
         mActors.clear();
+        mHotData.resize(0);
         mDeathCount.clear();
     }
 
@@ -2287,65 +2428,65 @@ namespace MWMechanics
 
     bool Actors::isReadyToBlock(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return false;
 
-        return it->second->getCharacterController().isReadyToBlock();
+        return actor->getCharacterController().isReadyToBlock();
     }
 
     bool Actors::isCastingSpell(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return false;
 
-        return it->second->getCharacterController().isCastingSpell();
+        return actor->getCharacterController().isCastingSpell();
     }
 
     bool Actors::isAttackingOrSpell(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return false;
 
-        return it->second->getCharacterController().isAttackingOrSpell();
+        return actor->getCharacterController().isAttackingOrSpell();
     }
 
     int Actors::getGreetingTimer(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return 0;
 
-        return it->second->getGreetingTimer();
+        return actor->getGreetingTimer();
     }
 
     float Actors::getAngleToPlayer(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return 0.f;
 
-        return it->second->getAngleToPlayer();
+        return actor->getAngleToPlayer();
     }
 
     GreetingState Actors::getGreetingState(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return Greet_None;
 
-        return it->second->getGreetingState();
+        return actor->getGreetingState();
     }
 
     bool Actors::isTurningToPlayer(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.find(ptr.mRef);
+        if (actor == nullptr)
             return false;
 
-        return it->second->isTurningToPlayer();
+        return actor->isTurningToPlayer();
     }
 
     void Actors::fastForwardAi() const
@@ -2353,10 +2494,9 @@ namespace MWMechanics
         if (!MWBase::Environment::get().getMechanicsManager()->isAIActive())
             return;
 
-        for (auto it = mActors.begin(); it != mActors.end();)
+        for (const Actor& actor : mActors)
         {
-            const MWWorld::Ptr ptr = it->getPtr();
-            ++it;
+            const MWWorld::Ptr ptr = actor.getPtr();
             if (ptr == getPlayer() || !isConscious(ptr) || ptr.getClass().getCreatureStats(ptr).isParalyzed())
                 continue;
             MWMechanics::AiSequence& seq = ptr.getClass().getCreatureStats(ptr).getAiSequence();
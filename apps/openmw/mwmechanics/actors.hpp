@@ -1,13 +1,18 @@
 #ifndef GAME_MWMECHANICS_ACTORS_H
 #define GAME_MWMECHANICS_ACTORS_H
 
-#include <list>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
+#include <components/misc/spatialhash.hpp>
+#include <components/misc/taskgraph.hpp>
+
 #include "actor.hpp"
+#include "actorstorage.hpp"
 
 namespace ESM
 {
@@ -25,6 +30,11 @@ namespace Loading
     class Listener;
 }
 
+namespace Misc
+{
+    class TaskGraphWorkers;
+}
+
 namespace MWWorld
 {
     class Ptr;
@@ -41,8 +51,14 @@ namespace MWMechanics
     class Actors
     {
     public:
-        std::list<Actor>::const_iterator begin() const { return mActors.begin(); }
-        std::list<Actor>::const_iterator end() const { return mActors.end(); }
+        Actors();
+
+        ~Actors();
+
+        using Storage = ActorStorage<const MWWorld::LiveCellRefBase*, Actor>;
+
+        Storage::ConstIterator begin() const { return mActors.begin(); }
+        Storage::Sentinel end() const { return mActors.end(); }
         std::size_t size() const { return mActors.size(); }
 
         void notifyDied(const MWWorld::Ptr& actor);
@@ -168,9 +184,35 @@ namespace MWMechanics
         bool isTurningToPlayer(const MWWorld::Ptr& ptr) const;
 
     private:
+        enum HotFlag : std::uint8_t
+        {
+            HotFlag_Dead = 1 << 0,
+            HotFlag_InProcessingRange = 1 << 1,
+        };
+
+        /// Per-frame data of the actors addressed by the dense index in mActors so the passes over all actors do
+        /// not have to follow a Ptr for each of them
+        struct HotData
+        {
+            std::vector<osg::Vec3f> mPositions;
+            std::vector<std::uint8_t> mFlags;
+            // Filled for collision prediction only
+            std::vector<float> mRotationsZ;
+            std::vector<float> mMaxSpeeds;
+            std::vector<osg::Vec3f> mVelocities;
+            std::vector<osg::Vec3f> mHalfExtents;
+
+            void resize(std::size_t size);
+
+            void move(std::size_t from, std::size_t to);
+        };
+
         std::map<ESM::RefId, int> mDeathCount;
-        std::list<Actor> mActors;
-        std::map<const MWWorld::LiveCellRefBase*, std::list<Actor>::iterator> mIndex;
+        Storage mActors;
+        HotData mHotData;
+        // Rebuilt for each neighbour search, cell size is close to the largest search radius
+        Misc::SpatialHash<std::size_t> mActorsGrid{ 256.f };
+        std::vector<std::size_t> mNeighbours;
         // We should add a delay between summoned creature death and its corpse despawning
         float mTimerDisposeSummonsCorpses = 0.2f;
         float mTimerUpdateHeadTrack = 0;
@@ -178,6 +220,15 @@ namespace MWMechanics
         float mTimerUpdateHello = 0;
         float mSneakTimer = 0; // Times update of sneak icon
         float mSneakSkillTimer = 0; // Times sneak skill progress from "avoid notice"
+        std::vector<const MWWorld::LiveCellRefBase*> mThinkingActors;
+        Misc::TaskGraph mThinkGraph;
+        std::unique_ptr<Misc::TaskGraphWorkers> mThinkWorkers;
+
+        /// Evaluates AI of the actors in combat in parallel before any of them is updated
+        void think(float duration, const MWWorld::Ptr& player);
+
+        /// Drops results of think not used by the AI update of this frame
+        void finishThink();
 
         void updateVisibility(const MWWorld::Ptr& ptr, CharacterController& ctrl) const;
 
@@ -191,7 +242,18 @@ namespace MWMechanics
 
         void purgeSpellEffects(int casterActorId) const;
 
-        void predictAndAvoidCollisions(float duration) const;
+        /// Removes holes left by erased actors from mActors and mHotData
+        void compactActors();
+
+        void updateHotData(std::size_t index, const MWWorld::Ptr& ptr, const osg::Vec3f& playerPos,
+            int actorsProcessingRange);
+
+        void updateHotData(const osg::Vec3f& playerPos, int actorsProcessingRange);
+
+        /// Fills movement related hot data and rebuilds the grid for collision prediction
+        void updateActorsGrid();
+
+        void predictAndAvoidCollisions(float duration);
 
         /** Start combat between two actors
             @Notes: If againstPlayer = true then actor2 should be the Player.
@@ -0,0 +1,207 @@
+#ifndef OPENMW_MECHANICS_ACTORSTORAGE_H
+#define OPENMW_MECHANICS_ACTORSTORAGE_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MWMechanics
+{
+    struct ActorHandle
+    {
+        std::uint32_t mSlot = 0;
+        std::uint32_t mGeneration = 0;
+    };
+
+    /// @brief Slot map with values referenced by a key or by a handle and iterated in insertion order
+    /// @par Values are allocated separately so references to them stay valid until erase. A handle of an erased value
+    /// is never resolved to a value inserted later into the same slot.
+    /// @par Values can be inserted and erased while iterating. Insertion appends to the dense array so the running loop
+    /// visits new values. Erase leaves a hole which is skipped by iteration and removed by compact(). Dense index of a
+    /// value is changed only by compact() and can be used to address data kept in parallel arrays.
+    template <class Key, class T>
+    class ActorStorage
+    {
+    public:
+        struct Sentinel
+        {
+        };
+
+        template <class Value>
+        class Iterator
+        {
+        public:
+            explicit Iterator(const ActorStorage& storage, std::size_t index)
+                : mStorage(&storage)
+                , mIndex(index)
+            {
+                skipHoles();
+            }
+
+            Value& operator*() const { return *mStorage->mDense[mIndex]; }
+
+            Value* operator->() const { return mStorage->mDense[mIndex]; }
+
+            Iterator& operator++()
+            {
+                ++mIndex;
+                skipHoles();
+                return *this;
+            }
+
+            std::size_t getIndex() const { return mIndex; }
+
+            bool operator==(Sentinel) const { return mIndex >= mStorage->mDense.size(); }
+
+        private:
+            const ActorStorage* mStorage;
+            std::size_t mIndex;
+
+            void skipHoles()
+            {
+                while (mIndex < mStorage->mDense.size() && mStorage->mDense[mIndex] == nullptr)
+                    ++mIndex;
+            }
+        };
+
+        using ConstIterator = Iterator<const T>;
+        using MutableIterator = Iterator<T>;
+
+        std::size_t size() const { return mIndex.size(); }
+
+        bool empty() const { return mIndex.empty(); }
+
+        /// Number of values including holes, upper bound for dense indices
+        std::size_t getDenseSize() const { return mDense.size(); }
+
+        ConstIterator begin() const { return ConstIterator(*this, 0); }
+
+        MutableIterator begin() { return MutableIterator(*this, 0); }
+
+        Sentinel end() const { return Sentinel{}; }
+
+        /// Returns nullptr for a hole
+        T* getAt(std::size_t index) const { return mDense[index]; }
+
+        T* find(const Key& key) const
+        {
+            const auto it = mIndex.find(key);
+            if (it == mIndex.end())
+                return nullptr;
+            return mSlots[it->second.mSlot].mValue.get();
+        }
+
+        T* get(ActorHandle handle) const
+        {
+            if (handle.mSlot >= mSlots.size() || mSlots[handle.mSlot].mGeneration != handle.mGeneration)
+                return nullptr;
+            return mSlots[handle.mSlot].mValue.get();
+        }
+
+        std::size_t getIndex(ActorHandle handle) const
+        {
+            assert(get(handle) != nullptr);
+            return mSlots[handle.mSlot].mIndex;
+        }
+
+        template <class... Args>
+        ActorHandle emplace(const Key& key, Args&&... args)
+        {
+            assert(mIndex.find(key) == mIndex.end());
+            std::uint32_t slotIndex;
+            if (mFreeSlots.empty())
+            {
+                slotIndex = static_cast<std::uint32_t>(mSlots.size());
+                mSlots.emplace_back();
+            }
+            else
+            {
+                slotIndex = mFreeSlots.back();
+                mFreeSlots.pop_back();
+            }
+            Slot& slot = mSlots[slotIndex];
+            slot.mValue = std::make_unique<T>(std::forward<Args>(args)...);
+            slot.mIndex = mDense.size();
+            mDense.push_back(slot.mValue.get());
+            mDenseSlots.push_back(slotIndex);
+            const ActorHandle handle{ slotIndex, slot.mGeneration };
+            mIndex.emplace(key, handle);
+            return handle;
+        }
+
+        bool erase(const Key& key)
+        {
+            const auto it = mIndex.find(key);
+            if (it == mIndex.end())
+                return false;
+            const std::uint32_t slotIndex = it->second.mSlot;
+            // Key may be owned by the value so it's not used after the value is destroyed
+            mIndex.erase(it);
+            Slot& slot = mSlots[slotIndex];
+            mDense[slot.mIndex] = nullptr;
+            ++slot.mGeneration;
+            // Value destructor may access the storage
+            const std::unique_ptr<T> value = std::move(slot.mValue);
+            mFreeSlots.push_back(slotIndex);
+            return true;
+        }
+
+        /// Removes holes preserving the order of values. Calls function with old and new dense index for each moved
+        /// value. Must not be called while iterating.
+        template <class Function>
+        void compact(Function&& function)
+        {
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < mDense.size(); ++i)
+            {
+                if (mDense[i] == nullptr)
+                    continue;
+                if (i != size)
+                {
+                    mDense[size] = mDense[i];
+                    mDenseSlots[size] = mDenseSlots[i];
+                    mSlots[mDenseSlots[size]].mIndex = size;
+                    function(i, size);
+                }
+                ++size;
+            }
+            mDense.resize(size);
+            mDenseSlots.resize(size);
+        }
+
+        void clear()
+        {
+            mIndex.clear();
+            mDense.clear();
+            mDenseSlots.clear();
+            mFreeSlots.clear();
+            for (std::size_t i = 0; i < mSlots.size(); ++i)
+            {
+                if (mSlots[i].mValue != nullptr)
+                    ++mSlots[i].mGeneration;
+                mSlots[i].mValue.reset();
+                mFreeSlots.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            std::unique_ptr<T> mValue;
+            std::uint32_t mGeneration = 0;
+            std::size_t mIndex = 0;
+        };
+
+        std::vector<Slot> mSlots;
+        std::vector<std::uint32_t> mFreeSlots;
+        std::vector<T*> mDense;
+        std::vector<std::uint32_t> mDenseSlots;
+        std::unordered_map<Key, ActorHandle> mIndex;
+    };
+}
+
+#endif
@@ -107,6 +107,9 @@ namespace MWMechanics
         // get or create temporary storage
         AiCombatStorage& storage = state.get<AiCombatStorage>();
 
+        // Action chosen by think is valid only for the current frame
+        ActionChoice nextActionChoice = std::exchange(storage.mNextActionChoice, ActionChoice{});
+
         // General description
         if (actor.getClass().getCreatureStats(actor).isDead())
             return true;
@@ -158,11 +161,34 @@ namespace MWMechanics
         if (storage.mReaction.update(duration) == Misc::TimerStatus::Waiting)
             return false;
 
-        return attack(actor, target, storage, characterController);
+        return attack(actor, target, storage, characterController, std::move(nextActionChoice));
+    }
+
+    void AiCombat::think(const MWWorld::Ptr& actor, AiState& state, float duration) const
+    {
+        AiCombatStorage* storage = state.getPtr<AiCombatStorage>();
+        if (storage == nullptr)
+            return;
+
+        storage->mNextActionChoice = ActionChoice{};
+
+        // Choose only when execute is going to prepare the next action
+        if (storage->mReaction.getNextStatus() == Misc::TimerStatus::Waiting
+            || storage->mActionCooldown - duration > 0)
+            return;
+
+        const MWWorld::Ptr target = getTarget();
+        if (target.isEmpty() || actor == target || !target.getCellRef().getCount() || !target.getRefData().isEnabled()
+            || target.getClass().getCreatureStats(target).isDead())
+            return;
+
+        storage->mNextActionChoice = chooseNextAction(actor, target);
+        storage->mNextActionTargetId = mTargetActorId;
+        storage->mNextActionRevision = actor.getClass().getContainerStore(actor).getRevision();
     }
 
     bool AiCombat::attack(const MWWorld::Ptr& actor, const MWWorld::Ptr& target, AiCombatStorage& storage,
-        CharacterController& characterController)
+        CharacterController& characterController, ActionChoice nextActionChoice)
     {
         const MWWorld::CellStore*& currentCell = storage.mCell;
         bool cellChange = currentCell && (actor.getCell() != currentCell);
@@ -206,7 +232,11 @@ namespace MWMechanics
 
             if (characterController.readyToPrepareAttack())
             {
-                currentAction = prepareNextAction(actor, target);
+                // Items referenced by the chosen action may be gone after the inventory is changed
+                if (nextActionChoice.mAction == nullptr || storage.mNextActionTargetId != mTargetActorId
+                    || storage.mNextActionRevision != actorClass.getContainerStore(actor).getRevision())
+                    nextActionChoice = chooseNextAction(actor, target);
+                currentAction = prepareNextAction(actor, target, std::move(nextActionChoice));
                 actionCooldown = currentAction->getActionCooldown();
             }
         }
@@ -527,6 +557,8 @@ namespace MWMechanics
         , mFleeBlindRunTimer(0.0f)
         , mUseCustomDestination(false)
         , mCustomDestination()
+        , mNextActionTargetId(-1)
+        , mNextActionRevision(0)
     {
     }
 
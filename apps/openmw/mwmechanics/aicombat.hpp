@@ -6,9 +6,12 @@
 
 #include "../mwworld/cellstore.hpp" // for Doors
 
+#include "aicombataction.hpp"
 #include "aitimer.hpp"
 #include "movement.hpp"
 
+#include <cstdint>
+
 namespace ESM
 {
     namespace AiSequence
@@ -19,8 +22,6 @@ namespace ESM
 
 namespace MWMechanics
 {
-    class Action;
-
     /// \brief This class holds the variables AiCombat needs which are deleted if the package becomes inactive.
     struct AiCombatStorage : AiTemporaryBase
     {
@@ -57,6 +58,11 @@ namespace MWMechanics
         bool mUseCustomDestination;
         osg::Vec3f mCustomDestination;
 
+        // Chosen by AiCombat::think for the target and the inventory state
+        ActionChoice mNextActionChoice;
+        int mNextActionTargetId;
+        std::uint32_t mNextActionRevision;
+
         AiCombatStorage();
 
         void startCombatMove(bool isDistantCombat, float distToTarget, float rangeAttack, const MWWorld::Ptr& actor,
@@ -88,6 +94,8 @@ namespace MWMechanics
         bool execute(const MWWorld::Ptr& actor, CharacterController& characterController, AiState& state,
             float duration) override;
 
+        void think(const MWWorld::Ptr& actor, AiState& state, float duration) const override;
+
         static constexpr AiPackageTypeId getTypeId() { return AiPackageTypeId::Combat; }
 
         static constexpr Options makeDefaultOptions()
@@ -107,7 +115,7 @@ namespace MWMechanics
     private:
         /// Returns true if combat should end
         bool attack(const MWWorld::Ptr& actor, const MWWorld::Ptr& target, AiCombatStorage& storage,
-            CharacterController& characterController);
+            CharacterController& characterController, ActionChoice nextActionChoice);
 
         void updateLOS(const MWWorld::Ptr& actor, const MWWorld::Ptr& target, float duration, AiCombatStorage& storage);
 
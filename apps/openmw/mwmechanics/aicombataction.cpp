@@ -162,19 +162,16 @@ namespace MWMechanics
         return mWeapon.get<ESM::Weapon>()->mBase;
     }
 
-    std::unique_ptr<Action> prepareNextAction(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy)
+    ActionChoice chooseNextAction(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy)
     {
-        Spells& spells = actor.getClass().getCreatureStats(actor).getSpells();
+        const Spells& spells = actor.getClass().getCreatureStats(actor).getSpells();
 
         float bestActionRating = 0.f;
         float antiFleeRating = 0.f;
         // Default to hand-to-hand combat
         std::unique_ptr<Action> bestAction = std::make_unique<ActionWeapon>(MWWorld::Ptr());
         if (actor.getClass().isNpc() && actor.getClass().getNpcStats(actor).isWerewolf())
-        {
-            bestAction->prepare(actor);
-            return bestAction;
-        }
+            return ActionChoice{ std::move(bestAction), std::nullopt };
 
         const bool hasInventoryStore = actor.getClass().hasInventoryStore(actor);
         MWWorld::ContainerStore& store = actor.getClass().getContainerStore(actor);
@@ -243,7 +240,14 @@ namespace MWMechanics
             }
         }
 
-        if (makeFleeDecision(actor, enemy, antiFleeRating))
+        return ActionChoice{ std::move(bestAction), antiFleeRating };
+    }
+
+    std::unique_ptr<Action> prepareNextAction(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy, ActionChoice choice)
+    {
+        std::unique_ptr<Action> bestAction = std::move(choice.mAction);
+
+        if (choice.mAntiFleeRating.has_value() && makeFleeDecision(actor, enemy, *choice.mAntiFleeRating))
             bestAction = std::make_unique<ActionFlee>();
 
         if (bestAction.get())
@@ -252,6 +256,11 @@ namespace MWMechanics
         return bestAction;
     }
 
+    std::unique_ptr<Action> prepareNextAction(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy)
+    {
+        return prepareNextAction(actor, enemy, chooseNextAction(actor, enemy));
+    }
+
     float getBestActionRating(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy)
     {
         Spells& spells = actor.getClass().getCreatureStats(actor).getSpells();
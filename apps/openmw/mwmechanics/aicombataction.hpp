@@ -2,6 +2,7 @@
 #define OPENMW_AICOMBAT_ACTION_H
 
 #include <memory>
+#include <optional>
 
 #include "../mwworld/containerstore.hpp"
 #include "../mwworld/ptr.hpp"
@@ -99,6 +100,19 @@ namespace MWMechanics
         const ESM::Weapon* getWeapon() const override;
     };
 
+    /// Action with the best rating among the potions, enchanted items, weapons and spells of the actor
+    struct ActionChoice
+    {
+        std::unique_ptr<Action> mAction;
+        /// Rating of the action to compare with the flee rating, empty if fleeing is not an option
+        std::optional<float> mAntiFleeRating;
+    };
+
+    /// Does not change any state so it's safe to call for different actors in parallel
+    ActionChoice chooseNextAction(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy);
+    /// Decides whether to flee instead of the chosen action and prepares the result
+    std::unique_ptr<Action> prepareNextAction(
+        const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy, ActionChoice choice);
     std::unique_ptr<Action> prepareNextAction(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy);
     float getBestActionRating(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy);
 
@@ -160,6 +160,21 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
     const bool isDestReached = (distToTarget <= destTolerance);
     const bool actorCanMoveByZ = canActorMoveByZAxis(actor);
 
+    const auto buildLimitedPath
+        = [&](DetourNavigator::Flags navigatorFlags, const DetourNavigator::AreaCosts& areaCosts) {
+              const ESM::Pathgrid* pathgrid
+                  = world->getStore().get<ESM::Pathgrid>().search(*actor.getCell()->getCell());
+              mPathFinder.buildLimitedPath(actor, position, dest, actor.getCell(), getPathGridGraph(pathgrid),
+                  agentBounds, navigatorFlags, areaCosts, endTolerance, pathType);
+          };
+
+    // Path found by the background threads replaces the current one as soon as it is ready
+    if (mPathFinder.updatePendingPath() == PathFinder::PendingPathStatus::Failed)
+    {
+        const DetourNavigator::Flags navigatorFlags = getNavigatorFlags(actor);
+        buildLimitedPath(navigatorFlags, getAreaCosts(actor, navigatorFlags));
+    }
+
     if (!isDestReached && timerStatus == Misc::TimerStatus::Elapsed)
     {
         if (canOpenDoors(actor))
@@ -176,12 +191,14 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
         {
             if (wasShortcutting || doesPathNeedRecalc(dest, actor)) // if need to rebuild path
             {
-                const ESM::Pathgrid* pathgrid
-                    = world->getStore().get<ESM::Pathgrid>().search(*actor.getCell()->getCell());
                 const DetourNavigator::Flags navigatorFlags = getNavigatorFlags(actor);
                 const DetourNavigator::AreaCosts areaCosts = getAreaCosts(actor, navigatorFlags);
-                mPathFinder.buildLimitedPath(actor, position, dest, actor.getCell(), getPathGridGraph(pathgrid),
-                    agentBounds, navigatorFlags, areaCosts, endTolerance, pathType);
+                // Keep following the current path until the new one is found by the background threads
+                const bool requested = !wasShortcutting && mPathFinder.isPathConstructed()
+                    && mPathFinder.requestLimitedPathByNavMesh(actor, position, dest, actor.getCell(), agentBounds,
+                        navigatorFlags, areaCosts, endTolerance, pathType);
+                if (!requested)
+                    buildLimitedPath(navigatorFlags, areaCosts);
                 mRotateOnTheRunChecks = 3;
 
                 // give priority to go directly on target if there is minimal opportunity
@@ -70,6 +70,10 @@ namespace MWMechanics
             const MWWorld::Ptr& actor, CharacterController& characterController, AiState& state, float duration)
             = 0;
 
+        /// Evaluates the read only part of the next execute and keeps the result in the state. Must not change
+        /// anything else because it's called for different actors in parallel.
+        virtual void think(const MWWorld::Ptr& actor, AiState& state, float duration) const {}
+
         /// Returns the TypeID of the AiPackage
         /// \see enum TypeId
         AiPackageTypeId getTypeId() const { return mTypeId; }
@@ -32,6 +32,7 @@ namespace MWMechanics
         // We need to keep an AiWander storage, if present - it has a state machine.
         // Not sure about another temporary storages
         sequence.mAiState.copy<AiWanderStorage>(mAiState);
+        mCombatTargetRatings.clear();
 
         mNumCombatPackages = sequence.mNumCombatPackages;
         mNumPursuitPackages = sequence.mNumPursuitPackages;
@@ -241,6 +242,101 @@ namespace MWMechanics
         }
     }
 
+    namespace
+    {
+        float getCombatTargetDistance(const osg::Vec3f& actorPos, const MWWorld::Ptr& target, bool isCurrent)
+        {
+            const float distTo = (target.getRefData().getPosition().asVec3() - actorPos).length2();
+
+            // Small threshold for changing target
+            if (isCurrent)
+                return std::max(0.f, distTo - 2500.f);
+
+            return distTo;
+        }
+    }
+
+    bool AiSequence::prepareThink(const MWWorld::Ptr& actor)
+    {
+        mCombatTargetRatings.clear();
+
+        if (mPackages.empty() || mPackages.front()->getTypeId() != AiPackageTypeId::Combat)
+            return false;
+
+        // Rating of burden effects uses cached inventory weight
+        actor.getClass().getContainerStore(actor).getWeight();
+
+        for (const auto& package : mPackages)
+        {
+            if (package->getTypeId() != AiPackageTypeId::Combat)
+                break;
+
+            const MWWorld::Ptr target = package->getTarget();
+            if (!target.isEmpty())
+                target.getClass().getContainerStore(target).getWeight();
+        }
+
+        return true;
+    }
+
+    void AiSequence::think(const MWWorld::Ptr& actor, float duration)
+    {
+        const AiPackage* actualCombat = nullptr;
+        float nearestDist = std::numeric_limits<float>::max();
+        float bestRating = 0.f;
+        const osg::Vec3f vActorPos = actor.getRefData().getPosition().asVec3();
+
+        try
+        {
+            // Same choice as in execute assuming the actor can fight all the targets
+            for (const auto& package : mPackages)
+            {
+                if (package->getTypeId() != AiPackageTypeId::Combat)
+                    break;
+
+                const MWWorld::Ptr target = package->getTarget();
+                if (target.isEmpty())
+                    continue;
+
+                const float rating = MWMechanics::getBestActionRating(actor, target);
+                mCombatTargetRatings.push_back(CombatTargetRating{
+                    package.get(), target.getClass().getCreatureStats(target).getActorId(), rating });
+
+                const float distTo = getCombatTargetDistance(vActorPos, target, package == mPackages.front());
+                if (rating > bestRating || ((distTo < nearestDist) && rating == bestRating))
+                {
+                    nearestDist = distTo;
+                    actualCombat = package.get();
+                    bestRating = rating;
+                }
+            }
+
+            if (actualCombat != nullptr)
+                actualCombat->think(actor, mAiState, duration);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Error during AiSequence::think: " << e.what();
+        }
+    }
+
+    void AiSequence::finishThink()
+    {
+        mCombatTargetRatings.clear();
+        if (AiCombatStorage* const storage = mAiState.getPtr<AiCombatStorage>())
+            storage->mNextActionChoice = ActionChoice{};
+    }
+
+    float AiSequence::getCombatTargetRating(
+        const MWWorld::Ptr& actor, const AiPackage& package, const MWWorld::Ptr& target) const
+    {
+        const int targetActorId = target.getClass().getCreatureStats(target).getActorId();
+        for (const CombatTargetRating& rating : mCombatTargetRatings)
+            if (rating.mPackage == &package && rating.mTargetActorId == targetActorId)
+                return rating.mRating;
+        return MWMechanics::getBestActionRating(actor, target);
+    }
+
     void AiSequence::execute(
         const MWWorld::Ptr& actor, CharacterController& characterController, float duration, bool outOfRange)
     {
@@ -296,15 +392,9 @@ namespace MWMechanics
                 {
                     float rating = 0.f;
                     if (MWMechanics::canFight(actor, target))
-                        rating = MWMechanics::getBestActionRating(actor, target);
+                        rating = getCombatTargetRating(actor, **it, target);
 
-                    const ESM::Position& targetPos = target.getRefData().getPosition();
-
-                    float distTo = (targetPos.asVec3() - vActorPos).length2();
-
-                    // Small threshold for changing target
-                    if (it == mPackages.begin())
-                        distTo = std::max(0.f, distTo - 2500.f);
+                    const float distTo = getCombatTargetDistance(vActorPos, target, it == mPackages.begin());
 
                     // if a target has higher priority than current target or has same priority but closer
                     if (rating > bestRating || ((distTo < nearestDist) && rating == bestRating))
@@ -317,6 +407,8 @@ namespace MWMechanics
                 }
             }
 
+            mCombatTargetRatings.clear();
+
             if (mPackages.empty())
                 return;
 
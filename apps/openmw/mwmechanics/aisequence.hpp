@@ -51,6 +51,19 @@ namespace MWMechanics
         AiPackageTypeId mLastAiPackage;
         AiState mAiState;
 
+        struct CombatTargetRating
+        {
+            const AiPackage* mPackage;
+            int mTargetActorId;
+            float mRating;
+        };
+
+        /// Evaluated by think for the current frame
+        std::vector<CombatTargetRating> mCombatTargetRatings;
+
+        float getCombatTargetRating(
+            const MWWorld::Ptr& actor, const AiPackage& package, const MWWorld::Ptr& target) const;
+
         void onPackageAdded(const AiPackage& package);
         void onPackageRemoved(const AiPackage& package);
 
@@ -145,6 +158,18 @@ namespace MWMechanics
         /// Removes all pursue packages until first non-pursue or stack empty.
         void stopPursuit();
 
+        /// Fill the caches used by think which are not safe to fill in parallel.
+        /// \return Is there anything to think about?
+        bool prepareThink(const MWWorld::Ptr& actor);
+
+        /// Evaluate the read only part of the next execute: best action ratings of the combat targets and the next
+        /// combat action. Can be called for different actors in parallel after prepareThink, nothing but the own
+        /// state of this sequence is changed.
+        void think(const MWWorld::Ptr& actor, float duration);
+
+        /// Drop the results of think, they refer to the packages and the inventory state of the current frame.
+        void finishThink();
+
         /// Execute current package, switching if needed.
         void execute(const MWWorld::Ptr& actor, CharacterController& characterController, float duration,
             bool outOfRange = false);
@@ -23,6 +23,8 @@ namespace MWMechanics
 
         void reset() { mImpl.reset(Misc::Rng::deviate(0, sDeviation, mPrng)); }
 
+        Misc::TimerStatus getNextStatus() const { return mImpl.getNextStatus(); }
+
     private:
         Misc::Rng::Generator& mPrng;
         Misc::DeviatingPeriodicTimer mImpl;
@@ -6,6 +6,7 @@
 #include <osg/io_utils>
 
 #include <components/debug/debuglog.hpp>
+#include <components/detournavigator/asyncpathfinder.hpp>
 #include <components/detournavigator/debug.hpp>
 #include <components/detournavigator/navigatorutils.hpp>
 #include <components/misc/coordinateconverter.hpp>
@@ -114,6 +115,18 @@ namespace
                 && std::abs((position.value() - start).length2() - (end - start).length2()) <= 1;
         }
     };
+
+    osg::Vec3f getLimitedPathEnd(
+        const DetourNavigator::Navigator& navigator, const osg::Vec3f& startPoint, const osg::Vec3f& endPoint)
+    {
+        const auto maxDistance
+            = std::min(navigator.getMaxNavmeshAreaRealRadius(), static_cast<float>(Constants::CellSizeInUnits));
+        const auto startToEnd = endPoint - startPoint;
+        const auto distance = startToEnd.length();
+        if (distance <= maxDistance)
+            return endPoint;
+        return startPoint + startToEnd * maxDistance / distance;
+    }
 }
 
 namespace MWMechanics
@@ -354,6 +367,7 @@ namespace MWMechanics
 
     void PathFinder::buildStraightPath(const osg::Vec3f& endPoint)
     {
+        mPendingPath = nullptr;
         mPath.clear();
         mPath.push_back(endPoint);
         mConstructed = true;
@@ -362,6 +376,7 @@ namespace MWMechanics
     void PathFinder::buildPathByPathgrid(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
         const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph)
     {
+        mPendingPath = nullptr;
         mPath.clear();
         mCell = cell;
 
@@ -374,6 +389,7 @@ namespace MWMechanics
         const osg::Vec3f& endPoint, const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
+        mPendingPath = nullptr;
         mPath.clear();
 
         // If it's not possible to build path over navmesh due to disabled navmesh generation fallback to straight path
@@ -394,6 +410,7 @@ namespace MWMechanics
         const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
+        mPendingPath = nullptr;
         mPath.clear();
         mCell = cell;
 
@@ -456,14 +473,57 @@ namespace MWMechanics
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
         const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
-        const auto maxDistance
-            = std::min(navigator->getMaxNavmeshAreaRealRadius(), static_cast<float>(Constants::CellSizeInUnits));
-        const auto startToEnd = endPoint - startPoint;
-        const auto distance = startToEnd.length();
-        if (distance <= maxDistance)
-            return buildPath(actor, startPoint, endPoint, cell, pathgridGraph, agentBounds, flags, areaCosts,
-                endTolerance, pathType);
-        const auto end = startPoint + startToEnd * maxDistance / distance;
-        buildPath(actor, startPoint, end, cell, pathgridGraph, agentBounds, flags, areaCosts, endTolerance, pathType);
+        buildPath(actor, startPoint, getLimitedPathEnd(*navigator, startPoint, endPoint), cell, pathgridGraph,
+            agentBounds, flags, areaCosts, endTolerance, pathType);
+    }
+
+    bool PathFinder::requestLimitedPathByNavMesh(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const DetourNavigator::AgentBounds& agentBounds,
+        const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts, float endTolerance,
+        PathType pathType)
+    {
+        if (actor.getClass().isPureWaterCreature(actor) || actor.getClass().isPureFlyingCreature(actor))
+            return false;
+
+        const auto world = MWBase::Environment::get().getWorld();
+        DetourNavigator::AsyncPathFinder* const asyncPathFinder = world->getAsyncPathFinder();
+        if (asyncPathFinder == nullptr)
+            return false;
+
+        mPendingPath = asyncPathFinder->enqueue(DetourNavigator::PathQuery{
+            .mAgentBounds = agentBounds,
+            .mStart = startPoint,
+            .mEnd = getLimitedPathEnd(*world->getNavigator(), startPoint, endPoint),
+            .mIncludeFlags = flags,
+            .mAreaCosts = areaCosts,
+            .mEndTolerance = endTolerance,
+        });
+        mPendingPathCell = cell;
+        mPendingPathType = pathType;
+        return true;
+    }
+
+    PathFinder::PendingPathStatus PathFinder::updatePendingPath()
+    {
+        if (mPendingPath == nullptr)
+            return PendingPathStatus::None;
+
+        if (!mPendingPath->isReady())
+            return PendingPathStatus::Waiting;
+
+        const std::shared_ptr<const DetourNavigator::PendingPath> pendingPath = std::move(mPendingPath);
+
+        const DetourNavigator::PathQueryResult& result = pendingPath->getResult();
+        const bool found = result.mStatus == DetourNavigator::Status::Success
+            || (mPendingPathType == PathType::Partial && result.mStatus == DetourNavigator::Status::PartialPath);
+
+        // Fallbacks are applied by building the path again synchronously
+        if (!found || result.mPath.empty())
+            return PendingPathStatus::Failed;
+
+        mPath.assign(result.mPath.begin(), result.mPath.end());
+        mCell = mPendingPathCell;
+        mConstructed = true;
+        return PendingPathStatus::Applied;
     }
 }
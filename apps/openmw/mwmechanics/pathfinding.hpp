@@ -4,6 +4,7 @@
 #include <cassert>
 #include <deque>
 #include <iterator>
+#include <memory>
 
 #include <components/detournavigator/areatype.hpp>
 #include <components/detournavigator/flags.hpp>
@@ -21,6 +22,7 @@ namespace MWWorld
 namespace DetourNavigator
 {
     struct AgentBounds;
+    class PendingPath;
 }
 
 namespace MWMechanics
@@ -93,11 +95,20 @@ namespace MWMechanics
 
         PathFinder() = default;
 
+        enum class PendingPathStatus
+        {
+            None,
+            Waiting,
+            Applied,
+            Failed,
+        };
+
         void clearPath()
         {
             mConstructed = false;
             mPath.clear();
             mCell = nullptr;
+            mPendingPath = nullptr;
         }
 
         void buildStraightPath(const osg::Vec3f& endPoint);
@@ -120,6 +131,17 @@ namespace MWMechanics
             const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
             const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType);
 
+        /// Requests the same path as buildLimitedPath to be found over navmesh by the background threads. The current
+        /// path is kept until updatePendingPath replaces it. Returns false if the request can't be made.
+        bool requestLimitedPathByNavMesh(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+            const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const DetourNavigator::AgentBounds& agentBounds,
+            const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts, float endTolerance,
+            PathType pathType);
+
+        /// Replaces the path by the requested one once it is found. Failed means the path is not found over navmesh
+        /// and has to be built by buildLimitedPath to use the fallbacks.
+        PendingPathStatus updatePendingPath();
+
         /// Remove front point if exist and within tolerance
         void update(const osg::Vec3f& position, float pointTolerance, float destinationTolerance,
             UpdateFlags updateFlags, const DetourNavigator::AgentBounds& agentBounds, DetourNavigator::Flags pathFlags);
@@ -204,6 +226,9 @@ namespace MWMechanics
         bool mConstructed = false;
         std::deque<osg::Vec3f> mPath;
         const MWWorld::CellStore* mCell = nullptr;
+        std::shared_ptr<const DetourNavigator::PendingPath> mPendingPath;
+        const MWWorld::CellStore* mPendingPathCell = nullptr;
+        PathType mPendingPathType = PathType::Full;
 
         void buildPathByPathgridImpl(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
             const PathgridGraph& pathgridGraph, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
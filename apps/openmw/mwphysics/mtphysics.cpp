@@ -16,7 +16,6 @@
 
 #include "components/debug/debuglog.hpp"
 #include "components/misc/convert.hpp"
-#include <components/misc/barrier.hpp>
 #include <components/settings/values.hpp>
 
 #include "../mwmechanics/actorutil.hpp"
@@ -436,12 +435,6 @@ namespace MWPhysics
         {
             mLOSCacheExpiry = 0;
         }
-
-        mPreStepBarrier = std::make_unique<Misc::Barrier>(mNumThreads);
-
-        mPostStepBarrier = std::make_unique<Misc::Barrier>(mNumThreads);
-
-        mPostSimBarrier = std::make_unique<Misc::Barrier>(mNumThreads);
     }
 
     PhysicsTaskScheduler::~PhysicsTaskScheduler()
@@ -560,6 +553,8 @@ namespace MWPhysics
         if (mAdvanceSimulation)
             mBudgetCursor += 1;
 
+        buildTaskGraph();
+
         if (mNumThreads == 0)
         {
             doSimulation();
@@ -752,6 +747,53 @@ namespace MWPhysics
         });
     }
 
+    void PhysicsTaskScheduler::buildTaskGraph()
+    {
+        // Each worker thread drains the shared job counter so there is one batch per thread
+        const std::size_t batches = std::max(mNumThreads, 1u);
+
+        mTaskGraph.clear();
+
+        // Always run at least one pre step to apply pending aabb updates
+        std::optional<Misc::TaskGraph::TaskId> lastStep;
+        for (int step = 0; step < std::max(mRemainingSteps, 1); ++step)
+        {
+            const auto preStep = mTaskGraph.addTask([this](std::size_t) { afterPreStep(); });
+            if (lastStep.has_value())
+                mTaskGraph.addDependency(preStep, *lastStep);
+            lastStep = preStep;
+
+            if (mRemainingSteps == 0)
+                break;
+
+            const auto move = mTaskGraph.addTask([this](std::size_t) { moveActors(); }, batches);
+            mTaskGraph.addDependency(move, preStep);
+
+            const auto postStep = mTaskGraph.addTask([this](std::size_t) { afterPostStep(); });
+            mTaskGraph.addDependency(postStep, move);
+            lastStep = postStep;
+        }
+
+        // Line of sight is checked after the last simulation step to see the final actor positions instead of a mix
+        // of positions from different steps
+        const auto refreshLOS = mTaskGraph.addTask([this](std::size_t) { refreshLOSCache(); }, batches);
+        mTaskGraph.addDependency(refreshLOS, *lastStep);
+
+        const auto postSim = mTaskGraph.addTask([this](std::size_t) { afterPostSim(); });
+        mTaskGraph.addDependency(postSim, refreshLOS);
+
+        mTaskGraph.start();
+    }
+
+    void PhysicsTaskScheduler::moveActors()
+    {
+        int job = 0;
+        const Visitors::Move impl{ mPhysicsDt, mCollisionWorld, *mWorldFrameData };
+        const Visitors::WithLockedPtr<Visitors::Move, MaybeLock> vis{ impl, mCollisionWorldMutex, mLockingPolicy };
+        while ((job = mNextJob.fetch_add(1, std::memory_order_relaxed)) < mNumJobs)
+            std::visit(vis, (*mSimulations)[job]);
+    }
+
     void PhysicsTaskScheduler::updateActorsPositions()
     {
         const Visitors::UpdatePosition impl{ mCollisionWorld };
@@ -780,20 +822,7 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::doSimulation()
     {
-        while (mRemainingSteps)
-        {
-            mPreStepBarrier->wait([this] { afterPreStep(); });
-            int job = 0;
-            const Visitors::Move impl{ mPhysicsDt, mCollisionWorld, *mWorldFrameData };
-            const Visitors::WithLockedPtr<Visitors::Move, MaybeLock> vis{ impl, mCollisionWorldMutex, mLockingPolicy };
-            while ((job = mNextJob.fetch_add(1, std::memory_order_relaxed)) < mNumJobs)
-                std::visit(vis, (*mSimulations)[job]);
-
-            mPostStepBarrier->wait([this] { afterPostStep(); });
-        }
-
-        refreshLOSCache();
-        mPostSimBarrier->wait([this] { afterPostSim(); });
+        mTaskGraph.run();
     }
 
     void PhysicsTaskScheduler::updateStats(osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
@@ -15,14 +15,10 @@
 #include <osg/Timer>
 
 #include "components/misc/budgetmeasurement.hpp"
+#include "components/misc/taskgraph.hpp"
 #include "physicssystem.hpp"
 #include "ptrholder.hpp"
 
-namespace Misc
-{
-    class Barrier;
-}
-
 namespace MWRender
 {
     class DebugDrawer;
@@ -75,8 +71,10 @@ namespace MWPhysics
     private:
         class WorkersSync;
 
+        void buildTaskGraph();
         void doSimulation();
         void worker();
+        void moveActors();
         void updateActorsPositions();
         bool hasLineOfSight(const Actor* actor1, const Actor* actor2);
         void refreshLOSCache();
@@ -103,10 +101,9 @@ namespace MWPhysics
         std::vector<LOSRequest> mLOSCache;
         std::set<std::weak_ptr<PtrHolder>, std::owner_less<std::weak_ptr<PtrHolder>>> mUpdateAabb;
 
-        // TODO: use std::experimental::flex_barrier or std::barrier once it becomes a thing
-        std::unique_ptr<Misc::Barrier> mPreStepBarrier;
-        std::unique_ptr<Misc::Barrier> mPostStepBarrier;
-        std::unique_ptr<Misc::Barrier> mPostSimBarrier;
+        // Simulation steps are chained one after another and followed by line of sight cache refresh, stages don't
+        // overlap. Tasks within a stage are split into batches between the threads.
+        Misc::TaskGraph mTaskGraph;
 
         LockingPolicy mLockingPolicy;
         unsigned mNumThreads;
@@ -258,6 +258,7 @@ namespace MWRender
         explicit WritePng(osg::ref_ptr<const osg::Image> overlayImage)
             : mOverlayImage(std::move(overlayImage))
         {
+            setCategory(SceneUtil::WorkCategory::Io);
         }
 
         void doWork() override { mImageData = writePng(*mOverlayImage); }
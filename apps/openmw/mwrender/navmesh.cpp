@@ -187,6 +187,7 @@ namespace MWRender
         explicit DeallocateCreateNavMeshTileGroups(osg::ref_ptr<NavMesh::CreateNavMeshTileGroups>&& workItem)
             : mWorkItem(std::move(workItem))
         {
+            setCategory(SceneUtil::WorkCategory::NavMesh);
         }
     };
 
@@ -313,6 +314,7 @@ namespace MWRender
 
         osg::ref_ptr<CreateNavMeshTileGroups> workItem = new CreateNavMeshTileGroups(
             id, version, navMesh, mGroupStateSet, mDebugDrawStateSet, settings, mTiles, mMode);
+        workItem->setCategory(SceneUtil::WorkCategory::NavMesh);
         mWorkQueue->addWorkItem(workItem);
         mWorkItems.push_back(std::move(workItem));
     }
@@ -1,5 +1,6 @@
 #include "objectpaging.hpp"
 
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -13,6 +14,7 @@
 #include <osgParticle/ParticleSystemUpdater>
 #include <osgUtil/IncrementalCompileOperation>
 
+#include <components/esm/exteriorcelllocation.hpp>
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/loadacti.hpp>
 #include <components/esm3/loadcell.hpp>
@@ -20,9 +22,16 @@
 #include <components/esm3/loaddoor.hpp>
 #include <components/esm3/loadstat.hpp>
 #include <components/esm3/readerscache.hpp>
+#include <components/esm4/loadacti.hpp>
+#include <components/esm4/loadcell.hpp>
+#include <components/esm4/loaddoor.hpp>
+#include <components/esm4/loadrefr.hpp>
+#include <components/esm4/loadstat.hpp>
+#include <components/misc/hash.hpp>
 #include <components/misc/pathhelpers.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/rng.hpp>
+#include <components/misc/strings/algorithm.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/sceneutil/lightmanager.hpp>
 #include <components/sceneutil/morphgeometry.hpp>
@@ -36,6 +45,7 @@
 
 #include "apps/openmw/mwbase/environment.hpp"
 #include "apps/openmw/mwbase/world.hpp"
+#include "apps/openmw/mwclass/esm4base.hpp"
 #include "apps/openmw/mwworld/esmstore.hpp"
 
 #include "vismask.hpp"
@@ -51,6 +61,9 @@ namespace MWRender
                 case ESM::REC_STAT:
                 case ESM::REC_ACTI:
                 case ESM::REC_DOOR:
+                case ESM::REC_STAT4:
+                case ESM::REC_ACTI4:
+                case ESM::REC_DOOR4:
                     return true;
                 case ESM::REC_CONT:
                     return !far;
@@ -60,6 +73,13 @@ namespace MWRender
             }
         }
 
+        std::string getESM4Model(std::string_view model)
+        {
+            if (MWClass::ESM4Impl::isHiddenModel(model))
+                return {};
+            return std::string(model);
+        }
+
         std::string getModel(int type, ESM::RefId id, const MWWorld::ESMStore& store)
         {
             switch (type)
@@ -72,6 +92,12 @@ namespace MWRender
                     return store.get<ESM::Door>().searchStatic(id)->mModel;
                 case ESM::REC_CONT:
                     return store.get<ESM::Container>().searchStatic(id)->mModel;
+                case ESM::REC_STAT4:
+                    return getESM4Model(store.get<ESM4::Static>().searchStatic(id)->mModel);
+                case ESM::REC_ACTI4:
+                    return getESM4Model(store.get<ESM4::Activator>().searchStatic(id)->mModel);
+                case ESM::REC_DOOR4:
+                    return getESM4Model(store.get<ESM4::Door>().searchStatic(id)->mModel);
                 default:
                     return {};
             }
@@ -458,20 +484,6 @@ namespace MWRender
         };
     }
 
-    ObjectPaging::ObjectPaging(Resource::SceneManager* sceneManager, ESM::RefId worldspace)
-        : GenericResourceManager<ChunkId>(nullptr, Settings::cells().mCacheExpiryDelay)
-        , Terrain::QuadTreeWorld::ChunkManager(worldspace)
-        , mSceneManager(sceneManager)
-        , mActiveGrid(Settings::terrain().mObjectPagingActiveGrid)
-        , mDebugBatches(Settings::terrain().mDebugChunks)
-        , mMergeFactor(Settings::terrain().mObjectPagingMergeFactor)
-        , mMinSize(Settings::terrain().mObjectPagingMinSize)
-        , mMinSizeMergeFactor(Settings::terrain().mObjectPagingMinSizeMergeFactor)
-        , mMinSizeCostMultiplier(Settings::terrain().mObjectPagingMinSizeCostMultiplier)
-        , mRefTrackerLocked(false)
-    {
-    }
-
     namespace
     {
         struct PagedCellRef
@@ -481,9 +493,11 @@ namespace MWRender
             osg::Vec3f mPosition;
             osg::Vec3f mRotation;
             float mScale;
+            int mType; // 0 for deleted moved references, they remove a reference of any type
+            bool mDeleted;
         };
 
-        PagedCellRef makePagedCellRef(const ESM::CellRef& value)
+        PagedCellRef makePagedCellRef(const ESM::CellRef& value, int type, bool deleted)
         {
             return PagedCellRef{
                 .mRefId = value.mRefID,
@@ -491,71 +505,160 @@ namespace MWRender
                 .mPosition = value.mPos.asVec3(),
                 .mRotation = value.mPos.asRotationVec3(),
                 .mScale = value.mScale,
+                .mType = type,
+                .mDeleted = deleted,
+            };
+        }
+
+        PagedCellRef makePagedCellRef(const ESM4::Reference& value, int type)
+        {
+            return PagedCellRef{
+                .mRefId = value.mBaseObj,
+                .mRefNum = value.mId,
+                .mPosition = value.mPos.asVec3(),
+                .mRotation = value.mPos.asRotationVec3(),
+                .mScale = value.mScale,
+                .mType = type,
+                .mDeleted = false,
             };
         }
 
-        std::map<ESM::RefNum, PagedCellRef> collectESM3References(
-            float size, const osg::Vec2i& startCell, const MWWorld::ESMStore& store)
+        struct CellPositionHash
+        {
+            std::size_t operator()(const osg::Vec2i& value) const { return Misc::hash2dCoord(value.x(), value.y()); }
+        };
+
+        void collectESM3References(const ESM::Cell& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers,
+            std::vector<PagedCellRef>& refs)
+        {
+            for (size_t i = 0; i < cell.mContextList.size(); ++i)
+            {
+                try
+                {
+                    const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+                    const ESM::ReadersCache::BusyItem reader = readers.get(index);
+                    cell.restore(*reader, i);
+                    ESM::CellRef ref;
+                    ESM::MovedCellRef cMRef;
+                    bool deleted = false;
+                    bool moved = false;
+                    while (ESM::Cell::getNextRef(
+                        *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
+                    {
+                        if (moved)
+                            continue;
+
+                        if (std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum)
+                            != cell.mMovedRefs.end())
+                            continue;
+
+                        const int type = store.findStatic(ref.mRefID);
+                        if (!typeFilter(type, false))
+                            continue;
+                        refs.push_back(makePagedCellRef(ref, type, deleted));
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    Log(Debug::Warning) << "Failed to collect references from cell \"" << cell.getDescription()
+                                        << "\": " << e.what();
+                    continue;
+                }
+            }
+            for (const auto& [ref, deleted] : cell.mLeasedRefs)
+            {
+                const int type = deleted ? 0 : store.findStatic(ref.mRefID);
+                if (!deleted && !typeFilter(type, false))
+                    continue;
+                refs.push_back(makePagedCellRef(ref, type, deleted));
+            }
+        }
+    }
+
+    /// References of paged types from all exterior cells of the default worldspace in the content files order.
+    /// Deleted references are kept to remove the same references from other cells when a chunk is collected.
+    class PagedRefsIndex
+    {
+    public:
+        explicit PagedRefsIndex(const MWWorld::ESMStore& store)
         {
-            std::map<ESM::RefNum, PagedCellRef> refs;
             ESM::ReadersCache readers;
+            store.get<ESM::Cell>().forEachStaticExt([&](const ESM::Cell& cell) {
+                const std::size_t begin = mRefs.size();
+                collectESM3References(cell, store, readers, mRefs);
+                if (mRefs.size() != begin)
+                    mCells.emplace(osg::Vec2i(cell.getGridX(), cell.getGridY()), std::pair(begin, mRefs.size()));
+            });
+            mRefs.shrink_to_fit();
+        }
+
+        std::span<const PagedCellRef> getCellRefs(int x, int y) const
+        {
+            const auto it = mCells.find(osg::Vec2i(x, y));
+            if (it == mCells.end())
+                return {};
+            return std::span(mRefs).subspan(it->second.first, it->second.second - it->second.first);
+        }
+
+        std::size_t size() const { return mRefs.size(); }
+
+    private:
+        std::vector<PagedCellRef> mRefs;
+        std::unordered_map<osg::Vec2i, std::pair<std::size_t, std::size_t>, CellPositionHash> mCells;
+    };
+
+    namespace
+    {
+        std::map<ESM::RefNum, const PagedCellRef*> collectESM3References(
+            float size, const osg::Vec2i& startCell, const PagedRefsIndex& index)
+        {
+            std::map<ESM::RefNum, const PagedCellRef*> refs;
             for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
             {
                 for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
                 {
-                    const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellX, cellY);
-                    if (!cell)
-                        continue;
-                    for (size_t i = 0; i < cell->mContextList.size(); ++i)
+                    for (const PagedCellRef& ref : index.getCellRefs(cellX, cellY))
                     {
-                        try
+                        if (ref.mDeleted)
                         {
-                            const std::size_t index = static_cast<std::size_t>(cell->mContextList[i].index);
-                            const ESM::ReadersCache::BusyItem reader = readers.get(index);
-                            cell->restore(*reader, i);
-                            ESM::CellRef ref;
-                            ESM::MovedCellRef cMRef;
-                            bool deleted = false;
-                            bool moved = false;
-                            while (ESM::Cell::getNextRef(
-                                *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                            {
-                                if (moved)
-                                    continue;
-
-                                if (std::find(cell->mMovedRefs.begin(), cell->mMovedRefs.end(), ref.mRefNum)
-                                    != cell->mMovedRefs.end())
-                                    continue;
-
-                                int type = store.findStatic(ref.mRefID);
-                                if (!typeFilter(type, size >= 2))
-                                    continue;
-                                if (deleted)
-                                {
-                                    refs.erase(ref.mRefNum);
-                                    continue;
-                                }
-                                refs.insert_or_assign(ref.mRefNum, makePagedCellRef(ref));
-                            }
-                        }
-                        catch (const std::exception& e)
-                        {
-                            Log(Debug::Warning) << "Failed to collect references from cell \"" << cell->getDescription()
-                                                << "\": " << e.what();
+                            if (ref.mType == 0 || typeFilter(ref.mType, size >= 2))
+                                refs.erase(ref.mRefNum);
                             continue;
                         }
+                        if (typeFilter(ref.mType, size >= 2))
+                            refs.insert_or_assign(ref.mRefNum, &ref);
                     }
-                    for (const auto& [ref, deleted] : cell->mLeasedRefs)
+                }
+            }
+            return refs;
+        }
+    }
+
+    namespace
+    {
+        std::vector<PagedCellRef> collectESM4References(
+            float size, const osg::Vec2i& startCell, ESM::RefId worldspace, const MWWorld::ESMStore& store)
+        {
+            std::vector<PagedCellRef> refs;
+            for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
+            {
+                for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
+                {
+                    const ESM4::Cell* cell
+                        = store.get<ESM4::Cell>().searchExterior(ESM::ExteriorCellLocation(cellX, cellY, worldspace));
+                    if (cell == nullptr)
+                        continue;
+                    for (const ESM4::Reference* ref : store.get<ESM4::Reference>().getByCell(cell->mId))
                     {
-                        if (deleted)
-                        {
-                            refs.erase(ref.mRefNum);
+                        if (ref->mFlags & (ESM4::Rec_Deleted | ESM4::Rec_Disabled))
                             continue;
-                        }
-                        int type = store.findStatic(ref.mRefID);
+                        // State of the enable parent is resolved by CellStore, keep such references out of chunks
+                        if (!ref->mEsp.parent.isZeroOrUnset())
+                            continue;
+                        const int type = store.findStatic(ref->mBaseObj);
                         if (!typeFilter(type, size >= 2))
                             continue;
-                        refs.insert_or_assign(ref.mRefNum, makePagedCellRef(ref));
+                        refs.push_back(makePagedCellRef(*ref, type));
                     }
                 }
             }
@@ -563,6 +666,30 @@ namespace MWRender
         }
     }
 
+    ObjectPaging::ObjectPaging(Resource::SceneManager* sceneManager, ESM::RefId worldspace)
+        : GenericResourceManager<ChunkId>(nullptr, Settings::cells().mCacheExpiryDelay)
+        , Terrain::QuadTreeWorld::ChunkManager(worldspace)
+        , mSceneManager(sceneManager)
+        , mActiveGrid(Settings::terrain().mObjectPagingActiveGrid)
+        , mDebugBatches(Settings::terrain().mDebugChunks)
+        , mMergeFactor(Settings::terrain().mObjectPagingMergeFactor)
+        , mMinSize(Settings::terrain().mObjectPagingMinSize)
+        , mMinSizeMergeFactor(Settings::terrain().mObjectPagingMinSizeMergeFactor)
+        , mMinSizeCostMultiplier(Settings::terrain().mObjectPagingMinSizeCostMultiplier)
+        , mRefTrackerLocked(false)
+    {
+        // Content files are loaded before rendering is initialized, so references are indexed once here instead of
+        // by the threads creating chunks
+        if (worldspace == ESM::Cell::sDefaultWorldspaceId)
+        {
+            mPagedRefsIndex
+                = std::make_unique<const PagedRefsIndex>(MWBase::Environment::get().getWorld()->getStore());
+            Log(Debug::Verbose) << "Indexed " << mPagedRefsIndex->size() << " paged references";
+        }
+    }
+
+    ObjectPaging::~ObjectPaging() = default;
+
     osg::ref_ptr<osg::Node> ObjectPaging::createChunk(float size, const osg::Vec2f& center, bool activeGrid,
         const osg::Vec3f& viewPoint, bool compile, unsigned char lod)
     {
@@ -570,15 +697,18 @@ namespace MWRender
         const MWBase::World& world = *MWBase::Environment::get().getWorld();
         const MWWorld::ESMStore& store = world.getStore();
 
-        std::map<ESM::RefNum, PagedCellRef> refs;
+        std::map<ESM::RefNum, const PagedCellRef*> refs;
+        std::vector<PagedCellRef> esm4Refs;
 
         if (mWorldspace == ESM::Cell::sDefaultWorldspaceId)
         {
-            refs = collectESM3References(size, startCell, store);
+            refs = collectESM3References(size, startCell, *mPagedRefsIndex);
         }
         else
         {
-            // TODO
+            esm4Refs = collectESM4References(size, startCell, mWorldspace, store);
+            for (const PagedCellRef& ref : esm4Refs)
+                refs.emplace(ref.mRefNum, &ref);
         }
 
         if (activeGrid && !refs.empty())
@@ -623,8 +753,9 @@ namespace MWRender
 
         AnalyzeVisitor analyzeVisitor(copyMask);
         const float minSize = mMinSizeMergeFactor ? mMinSize * mMinSizeMergeFactor : mMinSize;
-        for (const auto& [refNum, ref] : refs)
+        for (const auto& [refNum, refPtr] : refs)
         {
+            const PagedCellRef& ref = *refPtr;
             if (size < 1.f)
             {
                 const osg::Vec3f cellPos = ref.mPosition / cellSize;
@@ -647,13 +778,13 @@ namespace MWRender
             if (Misc::ResourceHelpers::isHiddenMarker(ref.mRefId))
                 continue;
 
-            const int type = store.findStatic(ref.mRefId);
+            const int type = ref.mType;
             VFS::Path::Normalized model = getModel(type, ref.mRefId, store);
             if (model.empty())
                 continue;
             model = Misc::ResourceHelpers::correctMeshPath(model);
 
-            if (activeGrid && type != ESM::REC_STAT)
+            if (activeGrid && type != ESM::REC_STAT && type != ESM::REC_STAT4)
             {
                 model = Misc::ResourceHelpers::correctActorModelPath(model, mSceneManager->getVFS());
                 if (Misc::getFileExtension(model) == "nif")
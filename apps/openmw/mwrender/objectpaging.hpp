@@ -5,6 +5,7 @@
 #include <components/resource/resourcemanager.hpp>
 #include <components/terrain/quadtreeworld.hpp>
 
+#include <memory>
 #include <mutex>
 
 namespace Resource
@@ -14,6 +15,7 @@ namespace Resource
 
 namespace MWRender
 {
+    class PagedRefsIndex;
 
     typedef std::tuple<osg::Vec2f, float, bool> ChunkId; // Center, Size, ActiveGrid
 
@@ -21,7 +23,7 @@ namespace MWRender
     {
     public:
         ObjectPaging(Resource::SceneManager* sceneManager, ESM::RefId worldspace);
-        ~ObjectPaging() = default;
+        ~ObjectPaging();
 
         osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags,
             bool activeGrid, const osg::Vec3f& viewPoint, bool compile) override;
@@ -77,6 +79,9 @@ namespace MWRender
         typedef std::map<ESM::RefNum, float> SizeCache;
         SizeCache mSizeCache;
 
+        // Built on construction for the default worldspace, then shared read only by all threads creating chunks
+        std::unique_ptr<const PagedRefsIndex> mPagedRefsIndex;
+
         std::mutex mLODNameCacheMutex;
         typedef std::pair<std::string, unsigned char> LODNameCacheKey; // Key: mesh name, lod level
         using LODNameCache = std::map<LODNameCacheKey, VFS::Path::Normalized>; // Cache: key, mesh name to use
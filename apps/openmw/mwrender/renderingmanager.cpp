@@ -277,6 +277,7 @@ namespace MWRender
         PreloadCommonAssetsWorkItem(Resource::ResourceSystem* resourceSystem)
             : mResourceSystem(resourceSystem)
         {
+            setCategory(SceneUtil::WorkCategory::Preload);
         }
 
         void doWork() override
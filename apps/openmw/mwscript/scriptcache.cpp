@@ -0,0 +1,325 @@
+#include "scriptcache.hpp"
+
+#include <components/compiler/locals.hpp>
+#include <components/debug/debuglog.hpp>
+#include <components/esm/refid.hpp>
+#include <components/files/conversion.hpp>
+#include <components/files/temporarypath.hpp>
+#include <components/serialization/binaryreader.hpp>
+#include <components/serialization/binarywriter.hpp>
+#include <components/serialization/format.hpp>
+#include <components/serialization/sizeaccumulator.hpp>
+
+#include <extern/smhasher/MurmurHash3.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace MWScript
+{
+    namespace
+    {
+        constexpr char scriptCacheMagic[] = { 's', 'c', 'p', 't' };
+        constexpr std::uint32_t scriptCacheVersion = 1;
+
+        constexpr char localTypes[] = { 's', 'l', 'f' };
+
+        template <Serialization::Mode mode>
+        struct Format : Serialization::Format<mode, Format<mode>>
+        {
+            using Serialization::Format<mode, Format<mode>>::operator();
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, std::string>>
+            {
+                if constexpr (mode == Serialization::Mode::Write)
+                    visitor(*this, static_cast<std::uint64_t>(value.size()));
+                else
+                {
+                    static_assert(mode == Serialization::Mode::Read);
+                    std::uint64_t size = 0;
+                    visitor(*this, size);
+                    value.resize(static_cast<std::size_t>(size));
+                }
+                visitor(*this, value.data(), value.size());
+            }
+
+            template <class Visitor, class Value>
+            void operator()(Visitor&& visitor, const std::map<std::string, Value, std::less<>>& value) const
+            {
+                static_assert(mode == Serialization::Mode::Write);
+                visitor(*this, static_cast<std::uint64_t>(value.size()));
+                for (const auto& [k, v] : value)
+                {
+                    visitor(*this, k);
+                    visitor(*this, v);
+                }
+            }
+
+            template <class Visitor, class Value>
+            void operator()(Visitor&& visitor, std::map<std::string, Value, std::less<>>& value) const
+            {
+                static_assert(mode == Serialization::Mode::Read);
+                std::uint64_t size = 0;
+                visitor(*this, size);
+                for (std::uint64_t i = 0; i < size; ++i)
+                {
+                    std::string key;
+                    visitor(*this, key);
+                    visitor(*this, value[std::move(key)]);
+                }
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, ScriptDependencies::Global>>
+            {
+                visitor(*this, value.mName);
+                visitor(*this, value.mType);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, ScriptDependencies::Member>>
+            {
+                visitor(*this, value.mName);
+                visitor(*this, value.mId);
+                visitor(*this, value.mType);
+                visitor(*this, value.mReference);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, ScriptDependencies::Id>>
+            {
+                visitor(*this, value.mId);
+                visitor(*this, value.mExists);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, ScriptDependencies>>
+            {
+                visitor(*this, value.mGlobals);
+                visitor(*this, value.mMembers);
+                visitor(*this, value.mIds);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, Interpreter::Program>>
+            {
+                visitor(*this, value.mInstructions);
+                visitor(*this, value.mIntegers);
+                visitor(*this, value.mFloats);
+                visitor(*this, value.mStrings);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, CachedScript>>
+            {
+                visitor(*this, value.mTextDigest);
+                visitor(*this, value.mProgram);
+                for (auto& names : value.mLocals)
+                    visitor(*this, names);
+                visitor(*this, value.mDependencies);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, ScriptCache>>
+            {
+                if constexpr (mode == Serialization::Mode::Write)
+                {
+                    visitor(*this, scriptCacheMagic);
+                    visitor(*this, scriptCacheVersion);
+                }
+                else
+                {
+                    static_assert(mode == Serialization::Mode::Read);
+                    char magic[std::size(scriptCacheMagic)];
+                    visitor(*this, magic);
+                    if (std::memcmp(magic, scriptCacheMagic, sizeof(magic)) != 0)
+                        throw std::runtime_error("Bad script cache magic");
+                    std::uint32_t version = 0;
+                    visitor(*this, version);
+                    if (version != scriptCacheVersion)
+                        throw std::runtime_error("Bad script cache version");
+                }
+                visitor(*this, value.mExtensionsDigest);
+                visitor(*this, value.mScripts);
+            }
+        };
+
+        std::optional<std::unique_lock<std::mutex>> makeLock(std::mutex* mutex)
+        {
+            if (mutex == nullptr)
+                return std::nullopt;
+            return std::unique_lock(*mutex);
+        }
+    }
+
+    RecordingCompilerContext::RecordingCompilerContext(const Compiler::Context& context, std::mutex* mutex)
+        : mContext(context)
+        , mMutex(mutex)
+    {
+        setExtensions(context.getExtensions());
+    }
+
+    bool RecordingCompilerContext::canDeclareLocals() const
+    {
+        return mContext.canDeclareLocals();
+    }
+
+    char RecordingCompilerContext::getGlobalType(const std::string& name) const
+    {
+        const auto guard = makeLock(mMutex);
+        const char result = mContext.getGlobalType(name);
+        if (mDependencies != nullptr)
+        {
+            auto& globals = mDependencies->mGlobals;
+            if (std::none_of(globals.begin(), globals.end(), [&](const auto& v) { return v.mName == name; }))
+                globals.push_back(ScriptDependencies::Global{ name, result });
+        }
+        return result;
+    }
+
+    std::pair<char, bool> RecordingCompilerContext::getMemberType(const std::string& name, const ESM::RefId& id) const
+    {
+        const auto guard = makeLock(mMutex);
+        const std::pair<char, bool> result = mContext.getMemberType(name, id);
+        if (mDependencies != nullptr)
+        {
+            std::string serializedId = id.serializeText();
+            auto& members = mDependencies->mMembers;
+            if (std::none_of(members.begin(), members.end(),
+                    [&](const auto& v) { return v.mName == name && v.mId == serializedId; }))
+                members.push_back(
+                    ScriptDependencies::Member{ name, std::move(serializedId), result.first, result.second });
+        }
+        return result;
+    }
+
+    bool RecordingCompilerContext::isId(const ESM::RefId& name) const
+    {
+        const auto guard = makeLock(mMutex);
+        const bool result = mContext.isId(name);
+        if (mDependencies != nullptr)
+        {
+            std::string serializedId = name.serializeText();
+            auto& ids = mDependencies->mIds;
+            if (std::none_of(ids.begin(), ids.end(), [&](const auto& v) { return v.mId == serializedId; }))
+                ids.push_back(ScriptDependencies::Id{ std::move(serializedId), result });
+        }
+        return result;
+    }
+
+    bool checkDependencies(const ScriptDependencies& dependencies, const Compiler::Context& context)
+    {
+        for (const ScriptDependencies::Global& global : dependencies.mGlobals)
+            if (context.getGlobalType(global.mName) != global.mType)
+                return false;
+
+        for (const ScriptDependencies::Id& id : dependencies.mIds)
+            if (context.isId(ESM::RefId::deserializeText(id.mId)) != id.mExists)
+                return false;
+
+        for (const ScriptDependencies::Member& member : dependencies.mMembers)
+            if (context.getMemberType(member.mName, ESM::RefId::deserializeText(member.mId))
+                != std::make_pair(member.mType, member.mReference))
+                return false;
+
+        return true;
+    }
+
+    std::uint64_t getScriptTextDigest(std::string_view text)
+    {
+        const std::array<std::uint64_t, 2> seed{ 0, 0 };
+        std::array<std::uint64_t, 2> result{ 0, 0 };
+        MurmurHash3_x64_128(text.data(), static_cast<int>(text.size()), seed.data(), result.data());
+        return result[0];
+    }
+
+    std::array<std::vector<std::string>, 3> getLocalNames(const Compiler::Locals& locals)
+    {
+        std::array<std::vector<std::string>, 3> result;
+        for (std::size_t i = 0; i < std::size(localTypes); ++i)
+            result[i] = locals.get(localTypes[i]);
+        return result;
+    }
+
+    void declareLocals(const std::array<std::vector<std::string>, 3>& names, Compiler::Locals& locals)
+    {
+        for (std::size_t i = 0; i < std::size(localTypes); ++i)
+            for (const std::string& name : names[i])
+                locals.declare(localTypes[i], name);
+    }
+
+    bool removeUnusedScripts(ScriptCache& cache, const std::set<std::string, std::less<>>& used)
+    {
+        return std::erase_if(cache.mScripts, [&](const auto& v) { return !used.contains(v.first); }) > 0;
+    }
+
+    ScriptCache readScriptCache(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios_base::binary);
+        if (!stream.is_open())
+            return {};
+
+        try
+        {
+            std::vector<char> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+            const std::byte* const begin = reinterpret_cast<const std::byte*>(data.data());
+            ScriptCache result;
+            constexpr Format<Serialization::Mode::Read> format;
+            format(Serialization::BinaryReader(begin, begin + data.size()), result);
+            return result;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read script cache " << path << ": " << e.what();
+            return {};
+        }
+    }
+
+    void writeScriptCache(const ScriptCache& cache, const std::filesystem::path& path)
+    {
+        constexpr Format<Serialization::Mode::Write> format;
+        Serialization::SizeAccumulator sizeAccumulator;
+        format(sizeAccumulator, cache);
+        std::vector<std::byte> data(sizeAccumulator.value());
+        format(Serialization::BinaryWriter(data.data(), data.data() + data.size()), cache);
+
+        std::filesystem::create_directories(path.parent_path());
+
+        // Several instances of the game may update the cache at the same time
+        const std::filesystem::path temporaryPath = Files::makeTemporaryPath(path);
+
+        try
+        {
+            {
+                std::ofstream stream(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+                stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+                if (!stream.good())
+                    throw std::runtime_error(
+                        "Failed to write script cache " + Files::pathToUnicodeString(temporaryPath));
+            }
+
+            std::filesystem::rename(temporaryPath, path);
+        }
+        catch (...)
+        {
+            std::error_code ec;
+            std::filesystem::remove(temporaryPath, ec);
+            throw;
+        }
+    }
+}
@@ -0,0 +1,118 @@
+#ifndef GAME_SCRIPT_SCRIPTCACHE_H
+#define GAME_SCRIPT_SCRIPTCACHE_H
+
+#include <components/compiler/context.hpp>
+#include <components/interpreter/program.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Compiler
+{
+    class Locals;
+}
+
+namespace MWScript
+{
+    inline constexpr std::string_view scriptCacheFileName = "scriptcache.bin";
+
+    /// @brief Answers of the compiler context to the queries made while compiling a script.
+    /// @par Compiled code depends only on the script text, compiler extensions and these answers. Ids are stored as
+    /// ESM::RefId::serializeText.
+    struct ScriptDependencies
+    {
+        struct Global
+        {
+            std::string mName;
+            char mType;
+        };
+
+        struct Member
+        {
+            std::string mName;
+            std::string mId;
+            char mType;
+            bool mReference;
+        };
+
+        struct Id
+        {
+            std::string mId;
+            bool mExists;
+        };
+
+        std::vector<Global> mGlobals;
+        std::vector<Member> mMembers;
+        std::vector<Id> mIds;
+    };
+
+    /// @brief Forwards queries to another compiler context and records the answers.
+    class RecordingCompilerContext : public Compiler::Context
+    {
+    public:
+        /// @param mutex when not null is locked for each query to share the context between threads
+        explicit RecordingCompilerContext(const Compiler::Context& context, std::mutex* mutex = nullptr);
+
+        /// Start recording into the dependencies or stop when nullptr.
+        void setDependencies(ScriptDependencies* dependencies) { mDependencies = dependencies; }
+
+        bool canDeclareLocals() const override;
+
+        char getGlobalType(const std::string& name) const override;
+
+        std::pair<char, bool> getMemberType(const std::string& name, const ESM::RefId& id) const override;
+
+        bool isId(const ESM::RefId& name) const override;
+
+    private:
+        const Compiler::Context& mContext;
+        std::mutex* mMutex;
+        ScriptDependencies* mDependencies = nullptr;
+    };
+
+    /// Check whether the context gives the same answers as recorded.
+    bool checkDependencies(const ScriptDependencies& dependencies, const Compiler::Context& context);
+
+    struct CachedScript
+    {
+        std::uint64_t mTextDigest = 0;
+        Interpreter::Program mProgram;
+        // Names of short, long and float local variables
+        std::array<std::vector<std::string>, 3> mLocals;
+        ScriptDependencies mDependencies;
+    };
+
+    std::uint64_t getScriptTextDigest(std::string_view text);
+
+    std::array<std::vector<std::string>, 3> getLocalNames(const Compiler::Locals& locals);
+
+    void declareLocals(const std::array<std::vector<std::string>, 3>& names, Compiler::Locals& locals);
+
+    /// @brief Compiled scripts stored between runs.
+    /// @par Keys are script ids stored as ESM::RefId::serializeText.
+    struct ScriptCache
+    {
+        std::uint64_t mExtensionsDigest = 0;
+        std::map<std::string, CachedScript, std::less<>> mScripts;
+    };
+
+    /// Remove scripts with ids not present in used. Returns true if anything is removed.
+    bool removeUnusedScripts(ScriptCache& cache, const std::set<std::string, std::less<>>& used);
+
+    /// Returns empty cache if the file doesn't exist or can't be read.
+    ScriptCache readScriptCache(const std::filesystem::path& path);
+
+    /// Replaces the file atomically to avoid partially written cache.
+    void writeScriptCache(const ScriptCache& cache, const std::filesystem::path& path);
+}
+
+#endif
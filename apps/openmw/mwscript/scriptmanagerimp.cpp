@@ -1,9 +1,14 @@
 #include "scriptmanagerimp.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <exception>
+#include <mutex>
+#include <optional>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include <components/debug/debuglog.hpp>
 
@@ -14,6 +19,7 @@
 
 #include <components/compiler/context.hpp>
 #include <components/compiler/exception.hpp>
+#include <components/compiler/extensions.hpp>
 #include <components/compiler/quickfileparser.hpp>
 #include <components/compiler/scanner.hpp>
 
@@ -24,37 +30,25 @@
 
 namespace MWScript
 {
-    ScriptManager::ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode)
-        : mErrorHandler()
-        , mStore(store)
-        , mCompilerContext(compilerContext)
-        , mParser(mErrorHandler, mCompilerContext)
-        , mGlobalScripts(store)
-    {
-        installOpcodes(mInterpreter);
-
-        mErrorHandler.setWarningsMode(warningsMode);
-    }
-
-    bool ScriptManager::compile(const ESM::RefId& name)
+    namespace
     {
-        mParser.reset();
-        mErrorHandler.reset();
-
-        if (const ESM::Script* script = mStore.get<ESM::Script>().find(name))
+        bool compileScript(const ESM::Script& script, Compiler::StreamErrorHandler& errorHandler,
+            Compiler::FileParser& parser, const Compiler::Extensions& extensions)
         {
-            mErrorHandler.setContext(script->mId.getRefIdString());
+            parser.reset();
+            errorHandler.reset();
+            errorHandler.setContext(script.mId.getRefIdString());
 
             bool Success = true;
             try
             {
-                std::istringstream input(script->mScriptText);
+                std::istringstream input(script.mScriptText);
 
-                Compiler::Scanner scanner(mErrorHandler, input, mCompilerContext.getExtensions());
+                Compiler::Scanner scanner(errorHandler, input, &extensions);
 
-                scanner.scan(mParser);
+                scanner.scan(parser);
 
-                if (!mErrorHandler.isGood())
+                if (!errorHandler.isGood())
                     Success = false;
             }
             catch (const Compiler::SourceException&)
@@ -70,20 +64,111 @@ namespace MWScript
 
             if (!Success)
             {
-                Log(Debug::Error) << "Error: script compiling failed: " << name;
+                Log(Debug::Error) << "Error: script compiling failed: " << script.mId;
             }
 
-            if (Success)
-            {
-                mScripts.emplace(name, CompiledScript(mParser.getProgram(), mParser.getLocals()));
+            return Success;
+        }
+    }
 
-                return true;
+    ScriptManager::ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode,
+        const std::filesystem::path& cachePath)
+        : mErrorHandler()
+        , mStore(store)
+        , mCompilerContext(compilerContext)
+        , mWarningsMode(warningsMode)
+        , mRecordingContext(compilerContext)
+        , mParser(mErrorHandler, mRecordingContext)
+        , mGlobalScripts(store)
+        , mCachePath(cachePath)
+    {
+        installOpcodes(mInterpreter);
+
+        mErrorHandler.setWarningsMode(warningsMode);
+
+        if (!mCachePath.empty())
+        {
+            const std::uint64_t extensionsDigest = getExtensions().getDigest();
+            mCache = readScriptCache(mCachePath);
+            if (mCache.mExtensionsDigest != extensionsDigest)
+            {
+                mCache = ScriptCache{};
+                mCache.mExtensionsDigest = extensionsDigest;
             }
         }
+    }
+
+    ScriptManager::~ScriptManager()
+    {
+        saveCache();
+    }
+
+    bool ScriptManager::compile(const ESM::RefId& name)
+    {
+        if (const ESM::Script* script = mStore.get<ESM::Script>().find(name))
+            return compile(*script, true);
 
         return false;
     }
 
+    bool ScriptManager::compile(const ESM::Script& script, bool useCache)
+    {
+        if (useCache && loadCached(script))
+            return true;
+
+        ScriptDependencies dependencies;
+        mRecordingContext.setDependencies(&dependencies);
+        const bool success = compileScript(script, mErrorHandler, mParser, getExtensions());
+        mRecordingContext.setDependencies(nullptr);
+
+        if (!success)
+            return false;
+
+        Interpreter::Program program = mParser.getProgram();
+        addToCache(script, program, mParser.getLocals(), std::move(dependencies));
+        mScripts.emplace(script.mId, CompiledScript(std::move(program), mParser.getLocals()));
+
+        return true;
+    }
+
+    bool ScriptManager::loadCached(const ESM::Script& script)
+    {
+        if (mCachePath.empty())
+            return false;
+
+        const auto it = mCache.mScripts.find(script.mId.serializeText());
+        if (it == mCache.mScripts.end())
+            return false;
+
+        const CachedScript& cached = it->second;
+        if (cached.mTextDigest != getScriptTextDigest(script.mScriptText)
+            || !checkDependencies(cached.mDependencies, mCompilerContext))
+            return false;
+
+        Compiler::Locals locals;
+        declareLocals(cached.mLocals, locals);
+        mScripts.emplace(script.mId, CompiledScript(Interpreter::Program(cached.mProgram), locals));
+        mCacheUsed.insert(it->first);
+
+        return true;
+    }
+
+    void ScriptManager::addToCache(const ESM::Script& script, const Interpreter::Program& program,
+        const Compiler::Locals& locals, ScriptDependencies&& dependencies)
+    {
+        if (mCachePath.empty())
+            return;
+
+        std::string id = script.mId.serializeText();
+        CachedScript& cached = mCache.mScripts[id];
+        mCacheUsed.insert(std::move(id));
+        cached.mTextDigest = getScriptTextDigest(script.mScriptText);
+        cached.mProgram = program;
+        cached.mLocals = getLocalNames(locals);
+        cached.mDependencies = std::move(dependencies);
+        mCacheChanged = true;
+    }
+
     bool ScriptManager::run(const ESM::RefId& name, Interpreter::Context& interpreterContext)
     {
         // compile script
@@ -145,13 +230,106 @@ namespace MWScript
         {
             ++count;
 
-            if (compile(script.mId))
+            if (compile(script, false))
                 ++success;
         }
 
         return std::make_pair(count, success);
     }
 
+    std::pair<int, int> ScriptManager::precompile(std::size_t numThreads)
+    {
+        int count = 0;
+        int success = 0;
+
+        std::vector<const ESM::Script*> scripts;
+
+        for (const ESM::Script& script : mStore.get<ESM::Script>())
+        {
+            if (mScripts.contains(script.mId))
+                continue;
+
+            ++count;
+
+            if (loadCached(script))
+                ++success;
+            else
+                scripts.push_back(&script);
+        }
+
+        struct Result
+        {
+            Interpreter::Program mProgram;
+            Compiler::Locals mLocals;
+            ScriptDependencies mDependencies;
+        };
+
+        std::vector<std::optional<Result>> results(scripts.size());
+        std::atomic_size_t next{ 0 };
+        std::mutex mutex;
+
+        const auto compileScripts = [&] {
+            Compiler::StreamErrorHandler errorHandler;
+            errorHandler.setWarningsMode(mWarningsMode);
+            RecordingCompilerContext context(mCompilerContext, &mutex);
+            Compiler::FileParser parser(errorHandler, context);
+
+            for (std::size_t i = next++; i < scripts.size(); i = next++)
+            {
+                ScriptDependencies dependencies;
+                context.setDependencies(&dependencies);
+                if (compileScript(*scripts[i], errorHandler, parser, getExtensions()))
+                    results[i] = Result{ parser.getProgram(), parser.getLocals(), std::move(dependencies) };
+                context.setDependencies(nullptr);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < std::min(numThreads, scripts.size()); ++i)
+            threads.emplace_back(compileScripts);
+        compileScripts();
+        for (std::thread& thread : threads)
+            thread.join();
+
+        for (std::size_t i = 0; i < scripts.size(); ++i)
+        {
+            if (!results[i].has_value())
+                continue;
+
+            ++success;
+
+            Result& result = *results[i];
+            addToCache(*scripts[i], result.mProgram, result.mLocals, std::move(result.mDependencies));
+            mScripts.emplace(scripts[i]->mId, CompiledScript(std::move(result.mProgram), result.mLocals));
+        }
+
+        saveCache();
+
+        return std::make_pair(count, success);
+    }
+
+    void ScriptManager::saveCache()
+    {
+        if (mCachePath.empty())
+            return;
+
+        if (removeUnusedScripts(mCache, mCacheUsed))
+            mCacheChanged = true;
+
+        if (!mCacheChanged)
+            return;
+
+        try
+        {
+            writeScriptCache(mCache, mCachePath);
+            mCacheChanged = false;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to save script cache: " << e.what();
+        }
+    }
+
     const Compiler::Locals& ScriptManager::getLocals(const ESM::RefId& name)
     {
         {
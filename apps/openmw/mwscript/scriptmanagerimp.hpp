@@ -1,6 +1,8 @@
 #ifndef GAME_SCRIPT_SCRIPTMANAGER_H
 #define GAME_SCRIPT_SCRIPTMANAGER_H
 
+#include <cstddef>
+#include <filesystem>
 #include <map>
 #include <set>
 #include <string>
@@ -16,6 +18,12 @@
 #include "../mwbase/scriptmanager.hpp"
 
 #include "globalscripts.hpp"
+#include "scriptcache.hpp"
+
+namespace ESM
+{
+    class Script;
+}
 
 namespace MWWorld
 {
@@ -40,6 +48,8 @@ namespace MWScript
         Compiler::StreamErrorHandler mErrorHandler;
         const MWWorld::ESMStore& mStore;
         Compiler::Context& mCompilerContext;
+        int mWarningsMode;
+        RecordingCompilerContext mRecordingContext;
         Compiler::FileParser mParser;
         Interpreter::Interpreter mInterpreter;
 
@@ -59,9 +69,25 @@ namespace MWScript
         std::unordered_map<ESM::RefId, CompiledScript> mScripts;
         GlobalScripts mGlobalScripts;
         std::unordered_map<ESM::RefId, Compiler::Locals> mOtherLocals;
+        std::filesystem::path mCachePath;
+        ScriptCache mCache;
+        // Ids of the cached scripts loaded or compiled in this run, others are removed on save
+        std::set<std::string, std::less<>> mCacheUsed;
+        bool mCacheChanged = false;
+
+        bool compile(const ESM::Script& script, bool useCache);
+
+        bool loadCached(const ESM::Script& script);
+
+        void addToCache(const ESM::Script& script, const Interpreter::Program& program, const Compiler::Locals& locals,
+            ScriptDependencies&& dependencies);
 
     public:
-        ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode);
+        /// @param cachePath file to keep compiled scripts between runs, empty to not use it
+        ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode,
+            const std::filesystem::path& cachePath = {});
+
+        ~ScriptManager() override;
 
         void clear() override;
 
@@ -76,6 +102,14 @@ namespace MWScript
         ///< Compile all scripts
         /// \return count, success
 
+        std::pair<int, int> precompile(std::size_t numThreads);
+        ///< Compile all not yet compiled scripts using cached code when it's still valid and the given number of
+        /// threads for the rest. Compiled scripts are written to the cache.
+        /// \return count, success
+
+        void saveCache();
+        ///< Write cache file if any script was compiled since the last save. Failures are logged.
+
         const Compiler::Locals& getLocals(const ESM::RefId& name) override;
         ///< Return locals for script \a name.
 
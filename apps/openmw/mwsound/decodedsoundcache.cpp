@@ -0,0 +1,100 @@
+#include "decodedsoundcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+
+#include <osg/Stats>
+
+#include <lz4.h>
+
+namespace MWSound
+{
+    std::shared_ptr<const CompressedSound> compressSound(const DecodedSound& sound)
+    {
+        if (sound.mData.empty() || sound.mData.size() > LZ4_MAX_INPUT_SIZE)
+            return nullptr;
+
+        auto result = std::make_shared<CompressedSound>();
+        result->mSize = sound.mData.size();
+        result->mSampleRate = sound.mSampleRate;
+        result->mChannels = sound.mChannels;
+        result->mType = sound.mType;
+        result->mData.resize(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(sound.mData.size()))));
+
+        const int size = LZ4_compress_default(sound.mData.data(), result->mData.data(),
+            static_cast<int>(sound.mData.size()), static_cast<int>(result->mData.size()));
+        if (size <= 0)
+            return nullptr;
+
+        result->mData.resize(static_cast<std::size_t>(size));
+        result->mData.shrink_to_fit();
+        return result;
+    }
+
+    DecodedSound decompressSound(const CompressedSound& sound)
+    {
+        DecodedSound result;
+        result.mSampleRate = sound.mSampleRate;
+        result.mChannels = sound.mChannels;
+        result.mType = sound.mType;
+        result.mData.resize(sound.mSize);
+
+        const int size = LZ4_decompress_safe(sound.mData.data(), result.mData.data(),
+            static_cast<int>(sound.mData.size()), static_cast<int>(result.mData.size()));
+        if (size < 0 || static_cast<std::size_t>(size) != sound.mSize)
+        {
+            Log(Debug::Error) << "Failed to decompress cached sound data";
+            result.mData.clear();
+        }
+
+        return result;
+    }
+
+    std::shared_ptr<const CompressedSound> DecodedSoundCache::get(VFS::Path::NormalizedView path)
+    {
+        if (!isEnabled())
+            return nullptr;
+
+        ++mGetCount;
+
+        const auto it = mIndex.find(path);
+        if (it == mIndex.end())
+            return nullptr;
+
+        ++mHitCount;
+
+        mItems.splice(mItems.begin(), mItems, it->second);
+        return it->second->mSound;
+    }
+
+    void DecodedSoundCache::put(VFS::Path::NormalizedView path, std::shared_ptr<const CompressedSound> sound)
+    {
+        if (sound == nullptr || sound->mData.size() > mMaxSize || mIndex.contains(path))
+            return;
+
+        while (!mItems.empty() && mSize + sound->mData.size() > mMaxSize)
+        {
+            mSize -= mItems.back().mSound->mData.size();
+            mIndex.erase(mItems.back().mPath);
+            mItems.pop_back();
+        }
+
+        mSize += sound->mData.size();
+        mItems.push_front(Item{ VFS::Path::Normalized(path), std::move(sound) });
+        mIndex.emplace(mItems.front().mPath, mItems.begin());
+    }
+
+    void DecodedSoundCache::clear()
+    {
+        mIndex.clear();
+        mItems.clear();
+        mSize = 0;
+    }
+
+    void DecodedSoundCache::reportStats(unsigned int frameNumber, osg::Stats& stats) const
+    {
+        stats.setAttribute(frameNumber, "Sound DecodedCache Count", mItems.size());
+        stats.setAttribute(frameNumber, "Sound DecodedCache Size", mSize);
+        stats.setAttribute(frameNumber, "Sound DecodedCache Get", mGetCount);
+        stats.setAttribute(frameNumber, "Sound DecodedCache Hit", mHitCount);
+    }
+}
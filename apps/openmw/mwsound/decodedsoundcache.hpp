@@ -0,0 +1,77 @@
+#ifndef GAME_SOUND_DECODEDSOUNDCACHE_H
+#define GAME_SOUND_DECODEDSOUNDCACHE_H
+
+#include "sound_decoder.hpp"
+
+#include <components/vfs/pathutil.hpp>
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace osg
+{
+    class Stats;
+}
+
+namespace MWSound
+{
+    /// LZ4 compressed PCM data of a decoded sound.
+    struct CompressedSound
+    {
+        std::string mData;
+        std::size_t mSize = 0;
+        int mSampleRate = 0;
+        ChannelConfig mChannels = ChannelConfig_Mono;
+        SampleType mType = SampleType_UInt8;
+    };
+
+    std::shared_ptr<const CompressedSound> compressSound(const DecodedSound& sound);
+
+    DecodedSound decompressSound(const CompressedSound& sound);
+
+    /// @brief Second tier cache for sounds which output buffers were unloaded by SoundBufferPool.
+    /// @par Keeps compressed PCM data of the least recently used sounds up to the given size to avoid decoding them
+    /// again. Is not thread safe, compression is supposed to be done by the caller on a worker thread when a buffer is
+    /// unloaded.
+    class DecodedSoundCache
+    {
+    public:
+        explicit DecodedSoundCache(std::size_t maxSize)
+            : mMaxSize(maxSize)
+        {
+        }
+
+        bool isEnabled() const { return mMaxSize > 0; }
+
+        std::shared_ptr<const CompressedSound> get(VFS::Path::NormalizedView path);
+
+        /// Unlike get() doesn't affect the order of eviction and stats.
+        bool contains(VFS::Path::NormalizedView path) const { return mIndex.contains(path); }
+
+        void put(VFS::Path::NormalizedView path, std::shared_ptr<const CompressedSound> sound);
+
+        void clear();
+
+        void reportStats(unsigned int frameNumber, osg::Stats& stats) const;
+
+    private:
+        struct Item
+        {
+            VFS::Path::Normalized mPath;
+            std::shared_ptr<const CompressedSound> mSound;
+        };
+
+        std::size_t mMaxSize;
+        std::size_t mSize = 0;
+        std::size_t mGetCount = 0;
+        std::size_t mHitCount = 0;
+        // NOTE: items are stored in front-newest order.
+        std::list<Item> mItems;
+        std::map<VFS::Path::Normalized, std::list<Item>::iterator, std::less<>> mIndex;
+    };
+}
+
+#endif
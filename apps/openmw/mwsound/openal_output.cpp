@@ -13,7 +13,6 @@
 
 #include <components/debug/debuglog.hpp>
 #include <components/misc/constants.hpp>
-#include <components/misc/resourcehelpers.hpp>
 #include <components/misc/thread.hpp>
 #include <components/vfs/manager.hpp>
 
@@ -1032,43 +1031,29 @@ namespace MWSound
         return ret;
     }
 
-    std::pair<Sound_Handle, size_t> OpenAL_Output::loadSound(VFS::Path::NormalizedView fname)
+    std::pair<Sound_Handle, size_t> OpenAL_Output::loadSound(const DecodedSound& sound)
     {
         getALError();
 
-        std::vector<char> data;
         ALenum format = AL_NONE;
-        int srate = 0;
+        if (!sound.mData.empty())
+            format = getALFormat(sound.mChannels, sound.mType);
 
-        try
-        {
-            DecoderPtr decoder = mManager.getDecoder();
-            decoder->open(Misc::ResourceHelpers::correctSoundPath(fname, *decoder->mResourceMgr));
-
-            ChannelConfig chans;
-            SampleType type;
-            decoder->getInfo(&srate, &chans, &type);
-            format = getALFormat(chans, type);
-            if (format)
-                decoder->readAll(data);
-        }
-        catch (std::exception& e)
-        {
-            Log(Debug::Error) << "Failed to load audio from " << fname << ": " << e.what();
-        }
-
-        if (data.empty())
+        const std::vector<char>* data = &sound.mData;
+        int srate = sound.mSampleRate;
+        if (format == AL_NONE)
         {
             // If we failed to get any usable audio, substitute with silence.
+            static const std::vector<char> silence(8000, -128);
             format = AL_FORMAT_MONO8;
             srate = 8000;
-            data.assign(8000, -128);
+            data = &silence;
         }
 
         ALint size;
         ALuint buf = 0;
         alGenBuffers(1, &buf);
-        alBufferData(buf, format, data.data(), data.size(), srate);
+        alBufferData(buf, format, data->data(), data->size(), srate);
         alGetBufferi(buf, AL_SIZE, &size);
         if (getALError() != AL_NO_ERROR)
         {
@@ -87,7 +87,7 @@ namespace MWSound
 
         std::vector<std::string> enumerateHrtf() override;
 
-        std::pair<Sound_Handle, size_t> loadSound(VFS::Path::NormalizedView fname) override;
+        std::pair<Sound_Handle, size_t> loadSound(const DecodedSound& sound) override;
         size_t unloadSound(Sound_Handle data) override;
 
         bool playSound(Sound* sound, Sound_Handle data, float offset) override;
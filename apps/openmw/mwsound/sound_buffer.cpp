@@ -6,11 +6,20 @@
 #include <components/debug/debuglog.hpp>
 #include <components/esm3/loadsoun.hpp>
 #include <components/misc/resourcehelpers.hpp>
+#include <components/sceneutil/workqueue.hpp>
 #include <components/settings/values.hpp>
 #include <components/vfs/pathutil.hpp>
 
+#include "sound_decoder.hpp"
+#include "soundmanagerimp.hpp"
+
+#include <osg/Stats>
+
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <limits>
+#include <optional>
 
 namespace MWSound
 {
@@ -33,13 +42,88 @@ namespace MWSound
             params.mAudioMaxDistanceMult = settings.find("fAudioMaxDistanceMult")->mValue.getFloat();
             return params;
         }
+
+        // Sounds requested to be played are decoded before any preloading
+        constexpr int playPriority = std::numeric_limits<int>::max();
+
+        // Filling the decoded sounds cache is the least urgent work
+        constexpr int compressPriority = -1;
     }
 
-    SoundBufferPool::SoundBufferPool(Sound_Output& output)
+    /// Worker thread item: decode a sound file into memory or restore it from the decoded sounds cache to upload it
+    /// to the output on the main thread.
+    class DecodeSoundWorkItem final : public SceneUtil::WorkItem
+    {
+    public:
+        explicit DecodeSoundWorkItem(
+            DecoderPtr decoder, VFS::Path::NormalizedView fileName, std::shared_ptr<const CompressedSound> cached)
+            : mDecoder(std::move(decoder))
+            , mFileName(fileName)
+            , mCached(std::move(cached))
+        {
+            setCategory(SceneUtil::WorkCategory::Io);
+        }
+
+        void doWork() override
+        {
+            if (mCached != nullptr)
+            {
+                mSound = decompressSound(*mCached);
+                return;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            mSound = decodeSound(*mDecoder, mFileName);
+            mDecodeTime = std::chrono::steady_clock::now() - start;
+            mDecoder = nullptr;
+        }
+
+        /// Results to be used after the item is done.
+        const DecodedSound& getSound() const { return mSound; }
+
+        const std::optional<std::chrono::steady_clock::duration>& getDecodeTime() const { return mDecodeTime; }
+
+    private:
+        DecoderPtr mDecoder;
+        VFS::Path::Normalized mFileName;
+        std::shared_ptr<const CompressedSound> mCached;
+        DecodedSound mSound;
+        std::optional<std::chrono::steady_clock::duration> mDecodeTime;
+    };
+
+    /// Worker thread item: decode a sound file which buffer was unloaded and compress it for the decoded sounds cache.
+    class CompressSoundWorkItem final : public SceneUtil::WorkItem
+    {
+    public:
+        explicit CompressSoundWorkItem(DecoderPtr decoder, VFS::Path::NormalizedView fileName)
+            : mDecoder(std::move(decoder))
+            , mFileName(fileName)
+        {
+            setCategory(SceneUtil::WorkCategory::Io);
+        }
+
+        void doWork() override
+        {
+            mCompressed = compressSound(decodeSound(*mDecoder, mFileName));
+            mDecoder = nullptr;
+        }
+
+        /// Result to be used after the item is done.
+        const std::shared_ptr<const CompressedSound>& getCompressed() const { return mCompressed; }
+
+    private:
+        DecoderPtr mDecoder;
+        VFS::Path::Normalized mFileName;
+        std::shared_ptr<const CompressedSound> mCompressed;
+    };
+
+    SoundBufferPool::SoundBufferPool(Sound_Output& output, SceneUtil::WorkQueue* workQueue)
         : mOutput(&output)
+        , mWorkQueue(workQueue)
         , mBufferCacheMax(Settings::sound().mBufferCacheMax * 1024 * 1024)
         , mBufferCacheMin(
               std::min(static_cast<std::size_t>(Settings::sound().mBufferCacheMin) * 1024 * 1024, mBufferCacheMax))
+        , mDecodedCache(static_cast<std::size_t>(Settings::sound().mDecodedCacheMax) * 1024 * 1024)
     {
     }
 
@@ -54,7 +138,7 @@ namespace MWSound
         if (it != mBufferNameMap.end())
         {
             Sound_Buffer* sfx = it->second;
-            if (sfx->getHandle() != nullptr)
+            if (sfx->getHandle() != nullptr || sfx->mUses > 0)
                 return sfx;
         }
         return nullptr;
@@ -66,7 +150,7 @@ namespace MWSound
         if (it != mBufferFileNameMap.end())
         {
             Sound_Buffer* sfx = it->second;
-            if (sfx->getHandle() != nullptr)
+            if (sfx->getHandle() != nullptr || sfx->mUses > 0)
                 return sfx;
         }
         return nullptr;
@@ -77,7 +161,54 @@ namespace MWSound
         if (sfx->getHandle() != nullptr)
             return sfx;
 
-        auto [handle, size] = mOutput->loadSound(sfx->getResourceName());
+        const osg::ref_ptr<DecodeSoundWorkItem> item = makeDecodeItem(*sfx);
+        item->doWork();
+        return finishLoading(sfx, *item);
+    }
+
+    osg::ref_ptr<DecodeSoundWorkItem> SoundBufferPool::makeDecodeItem(const Sound_Buffer& sfx)
+    {
+        std::shared_ptr<const CompressedSound> cached = mDecodedCache.get(sfx.getResourceName());
+        DecoderPtr decoder = cached == nullptr ? mOutput->mManager.getDecoder() : nullptr;
+        return new DecodeSoundWorkItem(std::move(decoder), sfx.getResourceName(), std::move(cached));
+    }
+
+    Sound_Buffer* SoundBufferPool::loadSfxAsync(Sound_Buffer* sfx, int priority)
+    {
+        if (sfx->getHandle() != nullptr)
+            return sfx;
+
+        if (mWorkQueue == nullptr)
+            return loadSfx(sfx);
+
+        if (sfx->isLoading())
+        {
+            for (const auto& [buffer, item] : mLoadingBuffers)
+                if (buffer == sfx && item->getPriority() < priority)
+                    item->setPriority(priority);
+            return sfx;
+        }
+
+        osg::ref_ptr<DecodeSoundWorkItem> item = makeDecodeItem(*sfx);
+        item->setPriority(priority);
+        mWorkQueue->addWorkItem(item);
+        mLoadingBuffers.emplace_back(sfx, std::move(item));
+        sfx->mLoading = true;
+
+        return sfx;
+    }
+
+    Sound_Buffer* SoundBufferPool::finishLoading(Sound_Buffer* sfx, const DecodeSoundWorkItem& item)
+    {
+        sfx->mLoading = false;
+
+        if (const auto& decodeTime = item.getDecodeTime())
+        {
+            ++mDecodedCount;
+            mDecodeTime += *decodeTime;
+        }
+
+        auto [handle, size] = mOutput->loadSound(item.getSound());
         if (handle == nullptr)
             return {};
 
@@ -90,12 +221,14 @@ namespace MWSound
             if (!mUnusedBuffers.empty() && mBufferCacheSize > mBufferCacheMax)
                 Log(Debug::Warning) << "No unused sound buffers to free, using " << mBufferCacheSize << " bytes!";
         }
-        mUnusedBuffers.push_front(sfx);
+        // Sounds waiting for the buffer to be loaded are already using it
+        if (sfx->mUses == 0)
+            mUnusedBuffers.push_front(sfx);
 
         return sfx;
     }
 
-    Sound_Buffer* SoundBufferPool::load(const ESM::RefId& soundId)
+    Sound_Buffer* SoundBufferPool::getOrInsert(const ESM::RefId& soundId)
     {
         if (mBufferNameMap.empty())
         {
@@ -103,37 +236,82 @@ namespace MWSound
                 insertSound(sound.mId, sound);
         }
 
-        Sound_Buffer* sfx;
         const auto it = mBufferNameMap.find(soundId);
         if (it != mBufferNameMap.end())
-            sfx = it->second;
-        else
-        {
-            const ESM::Sound* sound = MWBase::Environment::get().getESMStore()->get<ESM::Sound>().search(soundId);
-            if (sound == nullptr)
-                return {};
-            sfx = insertSound(soundId, *sound);
-        }
+            return it->second;
 
-        return loadSfx(sfx);
+        const ESM::Sound* sound = MWBase::Environment::get().getESMStore()->get<ESM::Sound>().search(soundId);
+        if (sound == nullptr)
+            return {};
+        return insertSound(soundId, *sound);
     }
 
-    Sound_Buffer* SoundBufferPool::load(std::string_view fileName)
+    Sound_Buffer* SoundBufferPool::getOrInsert(std::string_view fileName)
     {
-        Sound_Buffer* sfx;
         const auto it = mBufferFileNameMap.find(std::string(fileName));
         if (it != mBufferFileNameMap.end())
-            sfx = it->second;
-        else
+            return it->second;
+        return insertSound(fileName);
+    }
+
+    Sound_Buffer* SoundBufferPool::loadAsync(const ESM::RefId& soundId)
+    {
+        Sound_Buffer* sfx = getOrInsert(soundId);
+        if (sfx == nullptr)
+            return {};
+        return loadSfxAsync(sfx, playPriority);
+    }
+
+    Sound_Buffer* SoundBufferPool::loadAsync(std::string_view fileName)
+    {
+        return loadSfxAsync(getOrInsert(fileName), playPriority);
+    }
+
+    void SoundBufferPool::preload(const ESM::RefId& soundId)
+    {
+        if (Sound_Buffer* sfx = getOrInsert(soundId))
+            loadSfxAsync(sfx, 0);
+    }
+
+    void SoundBufferPool::update()
+    {
+        for (auto it = mLoadingBuffers.begin(); it != mLoadingBuffers.end();)
         {
-            sfx = insertSound(fileName);
+            if (!it->second->isDone())
+            {
+                ++it;
+                continue;
+            }
+            const auto [sfx, item] = std::move(*it);
+            it = mLoadingBuffers.erase(it);
+            finishLoading(sfx, *item);
         }
 
-        return loadSfx(sfx);
+        for (auto it = mCompressingSounds.begin(); it != mCompressingSounds.end();)
+        {
+            if (!it->second->isDone())
+            {
+                ++it;
+                continue;
+            }
+            mDecodedCache.put(it->first, it->second->getCompressed());
+            it = mCompressingSounds.erase(it);
+        }
     }
 
     void SoundBufferPool::clear()
     {
+        for (const auto& [sfx, item] : mLoadingBuffers)
+        {
+            item->cancel();
+            sfx->mLoading = false;
+        }
+        mLoadingBuffers.clear();
+
+        for (const auto& [path, item] : mCompressingSounds)
+            item->cancel();
+        mCompressingSounds.clear();
+
         for (auto& sfx : mSoundBuffers)
         {
             if (sfx.mHandle)
@@ -144,6 +322,35 @@ namespace MWSound
         mBufferFileNameMap.clear();
         mBufferNameMap.clear();
         mUnusedBuffers.clear();
+        mDecodedCache.clear();
+    }
+
+    void SoundBufferPool::compressUnloaded(const Sound_Buffer& sfx)
+    {
+        // Output buffer data can't be read back, so the file is decoded again. It's done on a worker to never add
+        // decoding or compression to the main thread.
+        if (!mDecodedCache.isEnabled() || mWorkQueue == nullptr || mDecodedCache.contains(sfx.getResourceName()))
+            return;
+
+        if (std::any_of(mCompressingSounds.begin(), mCompressingSounds.end(),
+                [&](const auto& v) { return v.first == sfx.getResourceName(); }))
+            return;
+
+        osg::ref_ptr<CompressSoundWorkItem> item
+            = new CompressSoundWorkItem(mOutput->mManager.getDecoder(), sfx.getResourceName());
+        item->setPriority(compressPriority);
+        mWorkQueue->addWorkItem(item);
+        mCompressingSounds.emplace_back(sfx.getResourceName(), std::move(item));
+    }
+
+    void SoundBufferPool::reportStats(unsigned int frameNumber, osg::Stats& stats) const
+    {
+        stats.setAttribute(frameNumber, "Sound Loading", mLoadingBuffers.size());
+        stats.setAttribute(frameNumber, "Sound Compressing", mCompressingSounds.size());
+        stats.setAttribute(frameNumber, "Sound Decoded", mDecodedCount);
+        stats.setAttribute(frameNumber, "Sound Decode Time",
+            std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(mDecodeTime).count());
+        mDecodedCache.reportStats(frameNumber, stats);
     }
 
     Sound_Buffer* SoundBufferPool::insertSound(std::string_view fileName)
@@ -199,6 +406,8 @@ namespace MWSound
             mBufferCacheSize -= mOutput->unloadSound(unused->getHandle());
             unused->mHandle = nullptr;
 
+            compressUnloaded(*unused);
+
             mUnusedBuffers.pop_back();
         }
     }
@@ -2,10 +2,16 @@
 #define GAME_SOUND_SOUND_BUFFER_H
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <osg/ref_ptr>
+
+#include "decodedsoundcache.hpp"
 #include "sound_output.hpp"
 #include <components/esm/refid.hpp>
 
@@ -19,9 +25,21 @@ namespace VFS
     class Manager;
 }
 
+namespace osg
+{
+    class Stats;
+}
+
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWSound
 {
     class SoundBufferPool;
+    class DecodeSoundWorkItem;
+    class CompressSoundWorkItem;
 
     class Sound_Buffer
     {
@@ -45,6 +63,9 @@ namespace MWSound
 
         float getMaxDist() const noexcept { return mMaxDist; }
 
+        /// Sound data is being decoded in background, handle is not available yet.
+        bool isLoading() const noexcept { return mLoading; }
+
     private:
         VFS::Path::Normalized mResourceName;
         float mVolume;
@@ -52,6 +73,7 @@ namespace MWSound
         float mMaxDist;
         Sound_Handle mHandle = nullptr;
         std::size_t mUses = 0;
+        bool mLoading = false;
 
         friend class SoundBufferPool;
     };
@@ -59,26 +81,32 @@ namespace MWSound
     class SoundBufferPool
     {
     public:
-        SoundBufferPool(Sound_Output& output);
+        SoundBufferPool(Sound_Output& output, SceneUtil::WorkQueue* workQueue);
 
         SoundBufferPool(const SoundBufferPool&) = delete;
 
         ~SoundBufferPool();
 
         /// Lookup a soundId for its sound data (resource name, local volume,
-        /// minRange, and maxRange)
+        /// minRange, and maxRange). Returns buffers still loading for the sounds waiting for them as well.
         Sound_Buffer* lookup(const ESM::RefId& soundId) const;
 
         /// Lookup a sound by file name for its sound data (resource name, local volume,
-        /// minRange, and maxRange)
+        /// minRange, and maxRange). Returns buffers still loading for the sounds waiting for them as well.
         Sound_Buffer* lookup(std::string_view fileName) const;
 
-        /// Lookup a soundId for its sound data (resource name, local volume,
-        /// minRange, and maxRange), and ensure it's ready for use.
-        Sound_Buffer* load(const ESM::RefId& soundId);
+        /// Lookup a soundId for its sound data and start decoding it in background if it's not loaded yet.
+        /// Returned buffer has no handle until update() finishes the loading.
+        Sound_Buffer* loadAsync(const ESM::RefId& soundId);
+
+        /// Lookup for a sound by file name and start decoding it in background if it's not loaded yet.
+        Sound_Buffer* loadAsync(std::string_view fileName);
 
-        // Lookup for a sound by file name, and ensure it's ready for use.
-        Sound_Buffer* load(std::string_view fileName);
+        /// Start decoding a sound in background with lower priority than loadAsync to have it ready when played.
+        void preload(const ESM::RefId& soundId);
+
+        /// Upload decoded sounds to the output. Called from the main thread every frame.
+        void update();
 
         void use(Sound_Buffer& sfx)
         {
@@ -92,16 +120,26 @@ namespace MWSound
 
         void release(Sound_Buffer& sfx)
         {
-            if (--sfx.mUses == 0)
+            if (--sfx.mUses == 0 && sfx.mHandle != nullptr)
                 mUnusedBuffers.push_front(&sfx);
         }
 
         void clear();
 
+        void reportStats(unsigned int frameNumber, osg::Stats& stats) const;
+
     private:
         Sound_Buffer* loadSfx(Sound_Buffer* sfx);
+        Sound_Buffer* loadSfxAsync(Sound_Buffer* sfx, int priority);
+        Sound_Buffer* finishLoading(Sound_Buffer* sfx, const DecodeSoundWorkItem& item);
+        osg::ref_ptr<DecodeSoundWorkItem> makeDecodeItem(const Sound_Buffer& sfx);
+        void compressUnloaded(const Sound_Buffer& sfx);
+
+        Sound_Buffer* getOrInsert(const ESM::RefId& soundId);
+        Sound_Buffer* getOrInsert(std::string_view fileName);
 
         Sound_Output* mOutput;
+        SceneUtil::WorkQueue* mWorkQueue;
         std::deque<Sound_Buffer> mSoundBuffers;
         std::unordered_map<ESM::RefId, Sound_Buffer*> mBufferNameMap;
         std::unordered_map<std::string, Sound_Buffer*> mBufferFileNameMap;
@@ -110,6 +148,11 @@ namespace MWSound
         std::size_t mBufferCacheSize = 0;
         // NOTE: unused buffers are stored in front-newest order.
         std::deque<Sound_Buffer*> mUnusedBuffers;
+        std::vector<std::pair<Sound_Buffer*, osg::ref_ptr<DecodeSoundWorkItem>>> mLoadingBuffers;
+        std::vector<std::pair<VFS::Path::Normalized, osg::ref_ptr<CompressSoundWorkItem>>> mCompressingSounds;
+        DecodedSoundCache mDecodedCache;
+        std::size_t mDecodedCount = 0;
+        std::chrono::steady_clock::duration mDecodeTime{};
 
         inline Sound_Buffer* insertSound(const ESM::RefId& soundId, const ESM::Sound& sound);
         inline Sound_Buffer* insertSound(std::string_view fileName);
@@ -58,6 +58,18 @@ namespace MWSound
         Sound_Decoder(const Sound_Decoder& rhs);
         Sound_Decoder& operator=(const Sound_Decoder& rhs);
     };
+
+    struct DecodedSound
+    {
+        std::vector<char> mData;
+        int mSampleRate = 0;
+        ChannelConfig mChannels = ChannelConfig_Mono;
+        SampleType mType = SampleType_UInt8;
+    };
+
+    /// Read the whole file into memory. Data is empty if the file can't be decoded.
+    /// @note Does not use the sound output, so may be called from any thread with own decoder.
+    DecodedSound decodeSound(Sound_Decoder& decoder, VFS::Path::NormalizedView fileName);
 }
 
 #endif
@@ -13,6 +13,7 @@
 namespace MWSound
 {
     class SoundManager;
+    struct DecodedSound;
     struct Sound_Decoder;
     class Sound;
     class Stream;
@@ -40,7 +41,7 @@ namespace MWSound
 
         virtual std::vector<std::string> enumerateHrtf() = 0;
 
-        virtual std::pair<Sound_Handle, size_t> loadSound(VFS::Path::NormalizedView fname) = 0;
+        virtual std::pair<Sound_Handle, size_t> loadSound(const DecodedSound& sound) = 0;
         virtual size_t unloadSound(Sound_Handle data) = 0;
 
         virtual bool playSound(Sound* sound, Sound_Handle data, float offset) = 0;
@@ -109,11 +109,11 @@ namespace MWSound
         return static_cast<int>(a) | static_cast<int>(b);
     }
 
-    SoundManager::SoundManager(const VFS::Manager* vfs, bool useSound)
+    SoundManager::SoundManager(const VFS::Manager* vfs, SceneUtil::WorkQueue* workQueue, bool useSound)
         : mVFS(vfs)
         , mOutput(std::make_unique<OpenAL_Output>(*this))
         , mWaterSoundUpdater(makeWaterSoundUpdaterSettings())
-        , mSoundBuffers(*mOutput)
+        , mSoundBuffers(*mOutput, workQueue)
         , mMusicType(MWSound::MusicType::Normal)
         , mListenerUnderwater(false)
         , mListenerPos(0, 0, 0)
@@ -476,7 +476,7 @@ namespace MWSound
             params.mFlags = mode | type | Play_2D;
             return params;
         }());
-        if (!mOutput->playSound(sound.get(), sfx->getHandle(), offset))
+        if (!startSound(*sound, *sfx, offset))
             return nullptr;
 
         Sound* result = sound.get();
@@ -495,7 +495,7 @@ namespace MWSound
         if (!mVFS->exists(normalizedName))
             return nullptr;
 
-        Sound_Buffer* sfx = mSoundBuffers.load(normalizedName);
+        Sound_Buffer* sfx = mSoundBuffers.loadAsync(normalizedName);
         if (!sfx)
             return nullptr;
 
@@ -508,7 +508,7 @@ namespace MWSound
         if (!mOutput->isInitialized())
             return nullptr;
 
-        Sound_Buffer* sfx = mSoundBuffers.load(soundId);
+        Sound_Buffer* sfx = mSoundBuffers.loadAsync(soundId);
         if (!sfx)
             return nullptr;
 
@@ -539,7 +539,7 @@ namespace MWSound
                 params.mFlags = mode | type | Play_2D;
                 return params;
             }());
-            played = mOutput->playSound(sound.get(), sfx->getHandle(), offset);
+            played = startSound(*sound, *sfx, offset);
         }
         else
         {
@@ -555,7 +555,7 @@ namespace MWSound
                 params.mFlags = mode | type | Play_3D;
                 return params;
             }());
-            played = mOutput->playSound3D(sound.get(), sfx->getHandle(), offset);
+            played = startSound(*sound, *sfx, offset);
         }
         if (!played)
             return nullptr;
@@ -576,7 +576,7 @@ namespace MWSound
             return nullptr;
 
         // Look up the sound in the ESM data
-        Sound_Buffer* sfx = mSoundBuffers.load(soundId);
+        Sound_Buffer* sfx = mSoundBuffers.loadAsync(soundId);
         if (!sfx)
             return nullptr;
 
@@ -594,7 +594,7 @@ namespace MWSound
         if (!mVFS->exists(normalizedName))
             return nullptr;
 
-        Sound_Buffer* sfx = mSoundBuffers.load(normalizedName);
+        Sound_Buffer* sfx = mSoundBuffers.loadAsync(normalizedName);
         if (!sfx)
             return nullptr;
 
@@ -608,7 +608,7 @@ namespace MWSound
             return nullptr;
 
         // Look up the sound in the ESM data
-        Sound_Buffer* sfx = mSoundBuffers.load(soundId);
+        Sound_Buffer* sfx = mSoundBuffers.loadAsync(soundId);
         if (!sfx)
             return nullptr;
 
@@ -627,7 +627,7 @@ namespace MWSound
             params.mFlags = mode | type | Play_3D;
             return params;
         }());
-        if (!mOutput->playSound3D(sound.get(), sfx->getHandle(), offset))
+        if (!startSound(*sound, *sfx, offset))
             return nullptr;
 
         Sound* result = sound.get();
@@ -636,10 +636,49 @@ namespace MWSound
         return result;
     }
 
+    bool SoundManager::startSound(Sound& sound, const Sound_Buffer& sfx, float offset)
+    {
+        if (sfx.isLoading())
+        {
+            // Playback is started by updateSounds once the buffer is ready
+            mPendingSounds.emplace(&sound, PendingSound{ .mOffset = offset });
+            return true;
+        }
+
+        if (sound.getIs3D())
+            return mOutput->playSound3D(&sound, sfx.getHandle(), offset);
+        return mOutput->playSound(&sound, sfx.getHandle(), offset);
+    }
+
+    void SoundManager::startPendingSound(Sound& sound, const Sound_Buffer& sfx)
+    {
+        const auto it = mPendingSounds.find(&sound);
+        if (it == mPendingSounds.end() || it->second.mPaused || sfx.isLoading())
+            return;
+
+        const float offset = it->second.mOffset;
+        mPendingSounds.erase(it);
+
+        // Failed to load buffer leaves the sound stopped to be removed by the caller
+        if (sfx.getHandle() != nullptr)
+            startSound(sound, sfx, offset);
+    }
+
+    void SoundManager::finishSound(Sound* sound)
+    {
+        mPendingSounds.erase(sound);
+        mOutput->finishSound(sound);
+    }
+
+    bool SoundManager::isSoundPlaying(Sound* sound) const
+    {
+        return mPendingSounds.contains(sound) || mOutput->isSoundPlaying(sound);
+    }
+
     void SoundManager::stopSound(Sound* sound)
     {
         if (sound)
-            mOutput->finishSound(sound);
+            finishSound(sound);
     }
 
     void SoundManager::stopSound(Sound_Buffer* sfx, const MWWorld::ConstPtr& ptr)
@@ -650,7 +689,7 @@ namespace MWSound
             for (SoundBufferRefPair& snd : snditer->second.mList)
             {
                 if (snd.second == sfx)
-                    mOutput->finishSound(snd.first.get());
+                    finishSound(snd.first.get());
             }
         }
     }
@@ -686,7 +725,7 @@ namespace MWSound
         if (snditer != mActiveSounds.end())
         {
             for (SoundBufferRefPair& snd : snditer->second.mList)
-                mOutput->finishSound(snd.first.get());
+                finishSound(snd.first.get());
         }
         SaySoundMap::iterator sayiter = mSaySoundsQueue.find(ptr.mRef);
         if (sayiter != mSaySoundsQueue.end())
@@ -703,7 +742,7 @@ namespace MWSound
             if (ref != nullptr && ref != MWMechanics::getPlayer().mRef && sound.mCell == cell)
             {
                 for (SoundBufferRefPair& sndbuf : sound.mList)
-                    mOutput->finishSound(sndbuf.first.get());
+                    finishSound(sndbuf.first.get());
             }
         }
 
@@ -736,6 +775,14 @@ namespace MWSound
         }
     }
 
+    void SoundManager::preloadSound(const ESM::RefId& soundId)
+    {
+        if (!mOutput->isInitialized())
+            return;
+
+        mSoundBuffers.preload(soundId);
+    }
+
     bool SoundManager::getSoundPlaying(const MWWorld::ConstPtr& ptr, std::string_view fileName) const
     {
         std::string normalizedName = VFS::Path::normalizeFilename(fileName);
@@ -749,7 +796,7 @@ namespace MWSound
 
             return std::find_if(snditer->second.mList.cbegin(), snditer->second.mList.cend(),
                        [this, sfx](const SoundBufferRefPair& snd) -> bool {
-                           return snd.second == sfx && mOutput->isSoundPlaying(snd.first.get());
+                           return snd.second == sfx && isSoundPlaying(snd.first.get());
                        })
                 != snditer->second.mList.cend();
         }
@@ -767,7 +814,7 @@ namespace MWSound
 
             return std::find_if(snditer->second.mList.cbegin(), snditer->second.mList.cend(),
                        [this, sfx](const SoundBufferRefPair& snd) -> bool {
-                           return snd.second == sfx && mOutput->isSoundPlaying(snd.first.get());
+                           return snd.second == sfx && isSoundPlaying(snd.first.get());
                        })
                 != snditer->second.mList.cend();
         }
@@ -784,6 +831,10 @@ namespace MWSound
             types = types & Type::Mask;
             mOutput->pauseSounds(types);
             mPausedSoundTypes[blocker] = types;
+
+            for (auto& [sound, pending] : mPendingSounds)
+                if (types & sound->getPlayType())
+                    pending.mPaused = true;
         }
     }
 
@@ -800,6 +851,10 @@ namespace MWSound
             }
 
             mOutput->resumeSounds(types);
+
+            for (auto& [sound, pending] : mPendingSounds)
+                if (types & sound->getPlayType())
+                    pending.mPaused = false;
         }
     }
 
@@ -829,7 +884,7 @@ namespace MWSound
 
         if (!cell->isExterior() && !cell->isQuasiExterior())
             return;
-        if (mCurrentRegionSound && mOutput->isSoundPlaying(mCurrentRegionSound))
+        if (mCurrentRegionSound && isSoundPlaying(mCurrentRegionSound))
             return;
 
         ESM::RefId next = mRegionSoundSelector.getNextRandom(duration, cell->getRegion());
@@ -862,7 +917,7 @@ namespace MWSound
                 break;
             case WaterSoundAction::PlaySound:
                 if (mNearWaterSound)
-                    mOutput->finishSound(mNearWaterSound);
+                    finishSound(mNearWaterSound);
                 mNearWaterSound = playSound(update.mId, update.mVolume, 1.0f, Type::Sfx, PlayMode::Loop);
                 break;
         }
@@ -955,7 +1010,7 @@ namespace MWSound
             env = Env_Underwater;
         else if (mUnderwaterSound)
         {
-            mOutput->finishSound(mUnderwaterSound);
+            finishSound(mUnderwaterSound);
             mUnderwaterSound = nullptr;
         }
 
@@ -964,6 +1019,8 @@ namespace MWSound
 
         updateMusic(duration);
 
+        mSoundBuffers.update();
+
         // Check if any sounds are finished playing, and trash them
         SoundMap::iterator snditer = mActiveSounds.begin();
         while (snditer != mActiveSounds.end())
@@ -982,9 +1039,11 @@ namespace MWSound
                     cull3DSound(sound);
                 }
 
-                if (!sound->updateFade(duration) || !mOutput->isSoundPlaying(sound))
+                startPendingSound(*sound, *sndidx->second);
+
+                if (!sound->updateFade(duration) || !isSoundPlaying(sound))
                 {
-                    mOutput->finishSound(sound);
+                    finishSound(sound);
                     if (sound == mUnderwaterSound)
                         mUnderwaterSound = nullptr;
                     if (sound == mNearWaterSound)
@@ -994,7 +1053,8 @@ namespace MWSound
                 }
                 else
                 {
-                    mOutput->updateSound(sound);
+                    if (!mPendingSounds.contains(sound))
+                        mOutput->updateSound(sound);
                     ++sndidx;
                 }
             }
@@ -1182,6 +1242,23 @@ namespace MWSound
         output.resize(total);
     }
 
+    DecodedSound decodeSound(Sound_Decoder& decoder, VFS::Path::NormalizedView fileName)
+    {
+        DecodedSound result;
+        try
+        {
+            decoder.open(Misc::ResourceHelpers::correctSoundPath(fileName, *decoder.mResourceMgr));
+            decoder.getInfo(&result.mSampleRate, &result.mChannels, &result.mType);
+            decoder.readAll(result.mData);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Failed to load audio from " << fileName << ": " << e.what();
+            result.mData.clear();
+        }
+        return result;
+    }
+
     const char* getSampleTypeName(SampleType type)
     {
         switch (type)
@@ -1263,11 +1340,12 @@ namespace MWSound
         {
             for (SoundBufferRefPair& sndbuf : snd.second.mList)
             {
-                mOutput->finishSound(sndbuf.first.get());
+                finishSound(sndbuf.first.get());
                 mSoundBuffers.release(*sndbuf.second);
             }
         }
         mActiveSounds.clear();
+        mPendingSounds.clear();
         mUnderwaterSound = nullptr;
         mNearWaterSound = nullptr;
 
@@ -1285,4 +1363,9 @@ namespace MWSound
         mPlaybackPaused = false;
         std::fill(std::begin(mPausedSoundTypes), std::end(mPausedSoundTypes), 0);
     }
+
+    void SoundManager::reportStats(unsigned int frameNumber, osg::Stats& stats) const
+    {
+        mSoundBuffers.reportStats(frameNumber, stats);
+    }
 }
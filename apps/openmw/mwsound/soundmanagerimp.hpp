@@ -35,6 +35,11 @@ namespace MWWorld
     class Cell;
 }
 
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWSound
 {
     class Sound_Output;
@@ -72,6 +77,16 @@ namespace MWSound
         typedef std::map<const MWWorld::LiveCellRefBase*, ActiveSound> SoundMap;
         SoundMap mActiveSounds;
 
+        struct PendingSound
+        {
+            float mOffset;
+            // Paused by pauseSounds after the sound was requested, starts only when resumed
+            bool mPaused = false;
+        };
+
+        // Active sounds waiting for their buffers to be loaded
+        std::unordered_map<const Sound*, PendingSound> mPendingSounds;
+
         struct SaySound
         {
             const MWWorld::CellStore* mCell;
@@ -131,6 +146,12 @@ namespace MWSound
         Sound* playSound3D(const MWWorld::ConstPtr& ptr, Sound_Buffer* sfx, float volume, float pitch, Type type,
             PlayMode mode, float offset);
 
+        // Starts playback or defers it until the buffer is loaded
+        bool startSound(Sound& sound, const Sound_Buffer& sfx, float offset);
+        void startPendingSound(Sound& sound, const Sound_Buffer& sfx);
+        void finishSound(Sound* sound);
+        bool isSoundPlaying(Sound* sound) const;
+
         void updateSounds(float duration);
         void updateRegionSound(float duration);
         void updateWaterSound();
@@ -153,12 +174,13 @@ namespace MWSound
     protected:
         DecoderPtr getDecoder();
         friend class OpenAL_Output;
+        friend class SoundBufferPool;
 
         void stopSound(Sound_Buffer* sfx, const MWWorld::ConstPtr& ptr);
         ///< Stop the given object from playing given sound buffer.
 
     public:
-        SoundManager(const VFS::Manager* vfs, bool useSound);
+        SoundManager(const VFS::Manager* vfs, SceneUtil::WorkQueue* workQueue, bool useSound);
         ~SoundManager() override;
 
         void processChangedSettings(const Settings::CategorySettingVector& settings) override;
@@ -263,6 +285,9 @@ namespace MWSound
         ///< @param soundId ID of the sound to fade out.
         ///< @param duration Time until volume reaches 0.
 
+        void preloadSound(const ESM::RefId& soundId) override;
+        ///< Start loading the given sound in background, so it can be played without delay later.
+
         bool getSoundPlaying(const MWWorld::ConstPtr& reference, const ESM::RefId& soundId) const override;
         ///< Is the given sound currently playing on the given object?
 
@@ -286,6 +311,8 @@ namespace MWSound
         void updatePtr(const MWWorld::ConstPtr& old, const MWWorld::ConstPtr& updated) override;
 
         void clear() override;
+
+        void reportStats(unsigned int frameNumber, osg::Stats& stats) const override;
     };
 }
 
@@ -70,9 +70,14 @@ void MWState::Character::addSlot(const ESM::SavedGame& profile)
     const std::string ext = ".omwsave";
     slot.mPath = mPath / (stream.str() + ext);
 
-    // Append an index if necessary to ensure a unique file
+    // Append an index if necessary to ensure a unique file. Slots are checked too because their files may be not
+    // written yet.
+    const auto isUsed = [&](const std::filesystem::path& path) {
+        return std::filesystem::exists(path)
+            || std::any_of(mSlots.begin(), mSlots.end(), [&](const Slot& v) { return v.mPath == path; });
+    };
     int i = 0;
-    while (std::filesystem::exists(slot.mPath))
+    while (isUsed(slot.mPath))
     {
         const std::string test = stream.str() + " - " + std::to_string(++i);
         slot.mPath = mPath / (test + ext);
@@ -0,0 +1,106 @@
+#include "savewriter.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/esm3/savecompression.hpp>
+#include <components/files/temporarypath.hpp>
+
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    void writeFile(const std::filesystem::path& path, const std::string& data)
+    {
+        const std::filesystem::path temporaryPath = Files::makeTemporaryPath(path);
+
+        try
+        {
+            std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+            stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+            stream.close();
+            if (stream.fail())
+                throw std::runtime_error("Write operation failed (file stream)");
+
+            std::filesystem::rename(temporaryPath, path);
+        }
+        catch (...)
+        {
+            std::error_code ec;
+            std::filesystem::remove(temporaryPath, ec);
+            throw;
+        }
+    }
+}
+
+MWState::SaveWriter::~SaveWriter()
+{
+    if (!mThread)
+        return;
+    {
+        std::lock_guard lock(mMutex);
+        mStop = true;
+    }
+    mHasRequest.notify_all();
+    mThread->join();
+}
+
+void MWState::SaveWriter::write(const std::filesystem::path& path, std::string&& data, bool compress)
+{
+    {
+        std::lock_guard lock(mMutex);
+        mRequests.push_back(Request{ path, std::move(data), compress });
+    }
+    if (!mThread)
+        mThread = std::thread([this] { run(); });
+    mHasRequest.notify_all();
+}
+
+void MWState::SaveWriter::wait()
+{
+    std::unique_lock lock(mMutex);
+    mIsDone.wait(lock, [&] { return mRequests.empty() && !mWriting; });
+}
+
+std::vector<MWState::SaveWriter::Failure> MWState::SaveWriter::takeFailures()
+{
+    std::lock_guard lock(mMutex);
+    return std::exchange(mFailures, {});
+}
+
+void MWState::SaveWriter::run() noexcept
+{
+    std::unique_lock lock(mMutex);
+    while (true)
+    {
+        // Pending requests are finished before stopping to not lose saved games on exit
+        mHasRequest.wait(lock, [&] { return !mRequests.empty() || mStop; });
+        if (mRequests.empty())
+            return;
+
+        Request request = std::move(mRequests.front());
+        mRequests.pop_front();
+        mWriting = true;
+        lock.unlock();
+
+        std::optional<Failure> failure;
+        try
+        {
+            if (request.mCompress)
+                request.mData = ESM::compressSaveGame(request.mData);
+            writeFile(request.mPath, request.mData);
+            Log(Debug::Info) << "Saved game is written to " << request.mPath;
+        }
+        catch (const std::exception& e)
+        {
+            failure = Failure{ std::move(request.mPath), e.what() };
+        }
+
+        lock.lock();
+        if (failure.has_value())
+            mFailures.push_back(std::move(*failure));
+        mWriting = false;
+        if (mRequests.empty())
+            mIsDone.notify_all();
+    }
+}
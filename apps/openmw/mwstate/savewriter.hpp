@@ -0,0 +1,63 @@
+#ifndef GAME_STATE_SAVEWRITER_H
+#define GAME_STATE_SAVEWRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MWState
+{
+    /// Compresses and writes saved games to disk on a background thread in the order they were requested.
+    /// @par Only the already serialized data is handed over. Serialization of the records still happens on the main
+    /// thread because it reads the live game state, so the frame is blocked for that part of saving.
+    class SaveWriter
+    {
+    public:
+        struct Failure
+        {
+            std::filesystem::path mPath;
+            std::string mError;
+        };
+
+        SaveWriter() = default;
+
+        ~SaveWriter();
+        ///< Waits for all queued writes to finish.
+
+        void write(const std::filesystem::path& path, std::string&& data, bool compress);
+        ///< Replace the file at \a path with \a data, compressed if \a compress is set. The file is written next to
+        /// the destination first and then renamed, so an existing save is never left partially overwritten.
+
+        void wait();
+        ///< Block until all queued writes are finished.
+
+        std::vector<Failure> takeFailures();
+        ///< Return failures of the finished writes since the last call.
+
+    private:
+        struct Request
+        {
+            std::filesystem::path mPath;
+            std::string mData;
+            bool mCompress;
+        };
+
+        void run() noexcept;
+
+        std::mutex mMutex;
+        std::condition_variable mHasRequest;
+        std::condition_variable mIsDone;
+        std::deque<Request> mRequests;
+        bool mWriting = false;
+        bool mStop = false;
+        std::vector<Failure> mFailures;
+        std::optional<std::thread> mThread;
+    };
+}
+
+#endif
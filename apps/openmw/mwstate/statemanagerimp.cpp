@@ -281,7 +281,10 @@ void MWState::StateManager::saveGame(std::string_view description, const Slot* s
         for (const std::string& contentFile : MWBase::Environment::get().getWorld()->getContentFiles())
             writer.addMaster(contentFile, 0); // not using the size information anyway -> use value of 0
 
-        writer.setFormatVersion(ESM::CurrentSaveGameFormatVersion);
+        // Uncompressed saves keep the previous format version so older versions can still load them
+        const bool compress = Settings::saves().mCompress;
+        writer.setFormatVersion(
+            compress ? ESM::CurrentSaveGameFormatVersion : ESM::MaxUncompressedSaveGameFormatVersion);
 
         // all unused
         writer.setVersion(0);
@@ -334,19 +337,15 @@ void MWState::StateManager::saveGame(std::string_view description, const Slot* s
         if (stream.fail())
             throw std::runtime_error("Write operation failed (memory stream)");
 
-        // All good, write to file
-        std::ofstream filestream(slot->mPath, std::ios::binary);
-        filestream << stream.rdbuf();
-
-        if (filestream.fail())
-            throw std::runtime_error("Write operation failed (file stream)");
+        // All good, write to file. Game state is already serialized so the disk I/O doesn't need to block the frame.
+        mSaveWriter.write(slot->mPath, std::move(stream).str(), compress);
 
         Settings::saves().mCharacter.set(Files::pathToUnicodeString(slot->mPath.parent_path().filename()));
         mLastSavegame = slot->mPath;
 
         const auto finish = std::chrono::steady_clock::now();
 
-        Log(Debug::Info) << '\'' << description << "' is saved in "
+        Log(Debug::Info) << '\'' << description << "' is serialized in "
                          << std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(finish - start).count()
                          << "ms";
     }
@@ -361,6 +360,9 @@ void MWState::StateManager::saveGame(std::string_view description, const Slot* s
         buttons.emplace_back("#{Interface:OK}");
         MWBase::Environment::get().getWindowManager()->interactiveMessageBox(error.str(), buttons);
 
+        // Previous write into the same slot may be still in progress
+        mSaveWriter.wait();
+
         // If no file was written, clean up the slot
         if (character && slot && !std::filesystem::exists(slot->mPath))
         {
@@ -452,6 +454,9 @@ struct SaveVersionTooNewError : SaveFormatVersionError
 
 void MWState::StateManager::loadGame(const Character* character, const std::filesystem::path& filepath)
 {
+    mSaveWriter.wait();
+    handleSaveFailures();
+
     try
     {
         cleanup();
@@ -705,6 +710,8 @@ void MWState::StateManager::quickLoad()
 
 void MWState::StateManager::deleteGame(const MWState::Character* character, const MWState::Slot* slot)
 {
+    mSaveWriter.wait();
+
     const std::filesystem::path savePath = slot->mPath;
     mCharacterManager.deleteSlot(character, slot);
     if (mLastSavegame == savePath)
@@ -731,8 +738,42 @@ MWState::StateManager::CharacterIterator MWState::StateManager::characterEnd()
     return mCharacterManager.end();
 }
 
+void MWState::StateManager::handleSaveFailures()
+{
+    for (const SaveWriter::Failure& failure : mSaveWriter.takeFailures())
+    {
+        const std::string error = "Failed to save game: " + failure.mError;
+
+        Log(Debug::Error) << error;
+
+        std::vector<std::string> buttons;
+        buttons.emplace_back("#{Interface:OK}");
+        MWBase::Environment::get().getWindowManager()->interactiveMessageBox(error, buttons);
+
+        if (mLastSavegame == failure.mPath)
+            mLastSavegame.clear();
+
+        // If no file was written, clean up the slot
+        if (std::filesystem::exists(failure.mPath))
+            continue;
+
+        const auto [character, slot] = [&]() -> std::pair<const Character*, const Slot*> {
+            for (const Character& character : mCharacterManager)
+                for (const Slot& slot : character)
+                    if (slot.mPath == failure.mPath)
+                        return { &character, &slot };
+            return { nullptr, nullptr };
+        }();
+
+        if (slot != nullptr)
+            mCharacterManager.deleteSlot(character, slot);
+    }
+}
+
 void MWState::StateManager::update(float duration)
 {
+    handleSaveFailures();
+
     mTimePlayed += duration;
 
     // Note: It would be nicer to trigger this from InputManager, i.e. the very beginning of the frame update.
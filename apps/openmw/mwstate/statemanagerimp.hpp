@@ -7,6 +7,7 @@
 #include "../mwbase/statemanager.hpp"
 
 #include "charactermanager.hpp"
+#include "savewriter.hpp"
 
 namespace MWState
 {
@@ -20,10 +21,14 @@ namespace MWState
         CharacterManager mCharacterManager;
         double mTimePlayed;
         std::filesystem::path mLastSavegame;
+        SaveWriter mSaveWriter;
 
     private:
         void cleanup(bool force = false);
 
+        void handleSaveFailures();
+        ///< Report failed background writes and remove slots that have no file.
+
         void printSavegameFormatError(const std::string& exceptionText, const std::string& messageBoxText);
 
         bool confirmLoading(const std::vector<std::string_view>& missingFiles) const;
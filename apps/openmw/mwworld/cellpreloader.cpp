@@ -8,7 +8,10 @@
 #include <osg/Stats>
 
 #include <components/debug/debuglog.hpp>
+#include <components/esm/util.hpp>
 #include <components/esm3/loadcell.hpp>
+#include <components/esm3/loadcrea.hpp>
+#include <components/esm3/loadsndg.hpp>
 #include <components/loadinglistener/reporter.hpp>
 #include <components/misc/constants.hpp>
 #include <components/misc/pathhelpers.hpp>
@@ -23,10 +26,14 @@
 #include <components/terrain/world.hpp>
 #include <components/vfs/manager.hpp>
 
+#include "../mwbase/environment.hpp"
+#include "../mwbase/soundmanager.hpp"
+
 #include "../mwrender/landmanager.hpp"
 
 #include "cellstore.hpp"
 #include "class.hpp"
+#include "esmstore.hpp"
 
 namespace MWWorld
 {
@@ -48,6 +55,35 @@ namespace MWWorld
             const auto predicate = [&](const PositionCellGrid& v) { return contains(container, v, tolerance); };
             return std::ranges::all_of(contained, predicate);
         }
+
+        /// Start loading sound generators of the creatures in the cell to not decode them on the first attack.
+        void preloadCreatureSounds(const CellStore& cell)
+        {
+            std::vector<ESM::RefId> creatures;
+            cell.forEachConst([&](const ConstPtr& ptr) {
+                if (ptr.getType() == ESM::Creature::sRecordId)
+                {
+                    const ESM::Creature* creature = ptr.get<ESM::Creature>()->mBase;
+                    creatures.push_back(creature->mOriginal.empty() ? creature->mId : creature->mOriginal);
+                }
+                return true;
+            });
+
+            if (creatures.empty())
+                return;
+
+            std::sort(creatures.begin(), creatures.end());
+
+            MWBase::SoundManager& soundManager = *MWBase::Environment::get().getSoundManager();
+            const Store<ESM::SoundGenerator>& generators
+                = MWBase::Environment::get().getESMStore()->get<ESM::SoundGenerator>();
+            for (const ESM::SoundGenerator& generator : generators)
+            {
+                if (generator.mCreature.empty()
+                    || std::binary_search(creatures.begin(), creatures.end(), generator.mCreature))
+                    soundManager.preloadSound(generator.mSound);
+            }
+        }
     }
 
     struct ListModelsVisitor
@@ -83,6 +119,13 @@ namespace MWWorld
         {
             mTerrainView = mTerrain->createView();
 
+            setCategory(SceneUtil::WorkCategory::Preload);
+            if (mIsExterior)
+            {
+                const osg::Vec2f center = ESM::indexToPosition(mCellLocation, true);
+                setPosition(osg::Vec3f(center.x(), center.y(), 0));
+            }
+
             ListModelsVisitor visitor{ mMeshes };
             cell->forEachConst(visitor);
         }
@@ -174,6 +217,9 @@ namespace MWWorld
             , mWorld(world)
             , mPreloadPositions(preloadPositions.begin(), preloadPositions.end())
         {
+            // Terrain around the predicted player position is what becomes visible next
+            setCategory(SceneUtil::WorkCategory::Terrain);
+            setPriority(1);
         }
 
         void doWork() override
@@ -272,7 +318,7 @@ namespace MWWorld
 
             if (oldestTimestamp + threshold < timestamp)
             {
-                oldestCell->second.mWorkItem->abort();
+                oldestCell->second.mWorkItem->cancel();
                 mPreloadCells.erase(oldestCell);
                 ++mEvicted;
             }
@@ -284,6 +330,8 @@ namespace MWWorld
             mResourceSystem->getKeyframeManager(), mTerrain, mLandManager, mPreloadInstances));
         mWorkQueue->addWorkItem(item);
 
+        preloadCreatureSounds(cell);
+
         mPreloadCells.emplace(&cell, PreloadEntry(timestamp, item));
         ++mAdded;
     }
@@ -295,7 +343,7 @@ namespace MWWorld
         {
             if (found->second.mWorkItem)
             {
-                found->second.mWorkItem->abort();
+                found->second.mWorkItem->cancel();
                 found->second.mWorkItem = nullptr;
             }
 
@@ -310,7 +358,7 @@ namespace MWWorld
         {
             if (it->second.mWorkItem)
             {
-                it->second.mWorkItem->abort();
+                it->second.mWorkItem->cancel();
                 it->second.mWorkItem = nullptr;
             }
 
@@ -326,7 +374,7 @@ namespace MWWorld
             {
                 if (it->second.mWorkItem)
                 {
-                    it->second.mWorkItem->abort();
+                    it->second.mWorkItem->cancel();
                     it->second.mWorkItem = nullptr;
                 }
                 mPreloadCells.erase(it++);
@@ -379,7 +427,7 @@ namespace MWWorld
             return;
         if (mTerrainPreloadItem && !mTerrainPreloadItem->isDone())
         {
-            mTerrainPreloadItem->abort();
+            mTerrainPreloadItem->cancel();
             mTerrainPreloadItem->waitTillDone();
         }
         setTerrainPreloadPositions({});
@@ -434,7 +482,7 @@ namespace MWWorld
     {
         if (mTerrainPreloadItem)
         {
-            mTerrainPreloadItem->abort();
+            mTerrainPreloadItem->cancel();
             mTerrainPreloadItem->waitTillDone();
             mTerrainPreloadItem = nullptr;
         }
@@ -446,7 +494,7 @@ namespace MWWorld
         }
 
         for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end(); ++it)
-            it->second.mWorkItem->abort();
+            it->second.mWorkItem->cancel();
 
         for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end(); ++it)
             it->second.mWorkItem->waitTillDone();
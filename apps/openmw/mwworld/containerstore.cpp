@@ -150,6 +150,7 @@ MWWorld::ContainerStore::ContainerStore()
     , mRechargingItemsUpToDate(false)
     , mCachedWeight(0)
     , mWeightUpToDate(false)
+    , mRevision(0)
     , mModified(false)
     , mResolved(false)
     , mSeed()
@@ -679,6 +680,7 @@ void MWWorld::ContainerStore::flagAsModified()
 {
     mWeightUpToDate = false;
     mRechargingItemsUpToDate = false;
+    ++mRevision;
 }
 
 bool MWWorld::ContainerStore::isResolved() const
@@ -1,6 +1,7 @@
 #ifndef GAME_MWWORLD_CONTAINERSTORE_H
 #define GAME_MWWORLD_CONTAINERSTORE_H
 
+#include <cstdint>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -141,6 +142,7 @@ namespace MWWorld
 
         mutable float mCachedWeight;
         mutable bool mWeightUpToDate;
+        std::uint32_t mRevision;
 
         bool mModified;
         bool mResolved;
@@ -270,6 +272,9 @@ namespace MWWorld
         float getWeight() const;
         ///< Return total weight of the items contained in *this.
 
+        std::uint32_t getRevision() const { return mRevision; }
+        ///< Return a number changed by every modification of the items contained in *this.
+
         static int getType(const ConstPtr& ptr);
         ///< This function throws an exception, if ptr does not point to an object, that can be
         /// put into a container.
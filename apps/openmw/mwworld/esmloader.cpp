@@ -18,13 +18,14 @@ namespace MWWorld
 {
 
     EsmLoader::EsmLoader(MWWorld::ESMStore& store, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder,
-        std::vector<int>& esmVersions)
+        std::vector<int>& esmVersions, std::size_t numThreads)
         : mReaders(readers)
         , mStore(store)
         , mEncoder(encoder)
         , mDialogue(nullptr) // A content file containing INFO records without a DIAL record appends them to the
                              // previous file's dialogue
         , mESMVersions(esmVersions)
+        , mNumThreads(numThreads)
     {
     }
 
@@ -55,7 +56,11 @@ namespace MWWorld
                   "Please run the launcher to fix this issue.");
 
                 mESMVersions[index] = reader->getVer();
-                mStore.load(*reader, listener, mDialogue);
+                if (mNumThreads == 0)
+                    mStore.load(*reader, listener, mDialogue);
+                else
+                    mStore.loadParallel(*reader, listener, mDialogue, mNumThreads,
+                        [&] { return Files::openBinaryInputFileStream(filepath); });
 
                 if (!mMasterFileFormat.has_value()
                     && (Misc::StringUtils::ciEndsWith(reader->getName().u8string(), u8".esm")
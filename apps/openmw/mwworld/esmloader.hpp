@@ -1,6 +1,7 @@
 #ifndef ESMLOADER_HPP
 #define ESMLOADER_HPP
 
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <vector>
@@ -26,7 +27,7 @@ namespace MWWorld
     struct EsmLoader : public ContentLoader
     {
         explicit EsmLoader(MWWorld::ESMStore& store, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder,
-            std::vector<int>& esmVersions);
+            std::vector<int>& esmVersions, std::size_t numThreads = 0);
 
         std::optional<int> getMasterFileFormat() const { return mMasterFileFormat; }
 
@@ -39,6 +40,7 @@ namespace MWWorld
         ESM::Dialogue* mDialogue;
         std::optional<int> mMasterFileFormat;
         std::vector<int>& mESMVersions;
+        std::size_t mNumThreads;
         std::map<std::string, int> mNameToIndex;
     };
 
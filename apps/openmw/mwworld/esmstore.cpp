@@ -1,7 +1,11 @@
 #include "esmstore.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
+#include <mutex>
+#include <thread>
 #include <tuple>
 
 #include <components/debug/debuglog.hpp>
@@ -224,12 +228,36 @@ namespace
             }
         }
     }
+
+    constexpr std::size_t recordHeaderSize = ESM::NAME::sCapacity + 3 * sizeof(std::uint32_t);
+
+    // Move reader to the record starting at the position and read its header. Context is used as a scratch buffer to
+    // avoid allocations.
+    void seekRecord(ESM::ESMReader& esm, ESM::ESM_Context& context, std::size_t position)
+    {
+        context.filePos = position;
+        context.leftFile = static_cast<std::streamsize>(esm.getFileSize() - position);
+        context.leftRec = 0;
+        context.leftSub = 0;
+        context.subCached = false;
+        esm.restoreContext(context);
+        esm.getRecName();
+        esm.getRecHeader();
+    }
 }
 
 namespace MWWorld
 {
     using IDMap = std::unordered_map<ESM::RefId, int>;
 
+    struct ESMStore::DeferredRecord
+    {
+        DynamicStore* mStore;
+        std::size_t mIndex;
+        std::size_t mPosition;
+        bool mLoaded;
+    };
+
     struct ESMStoreImp
     {
         ESMStore::StoreTuple mStores;
@@ -387,6 +415,103 @@ namespace MWWorld
     }
 
     void ESMStore::load(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue)
+    {
+        loadImpl(esm, listener, dialogue, nullptr);
+    }
+
+    void ESMStore::loadParallel(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue,
+        std::size_t numThreads, const std::function<std::unique_ptr<std::istream>()>& openStream)
+    {
+        std::vector<DeferredRecord> deferred;
+        loadImpl(esm, listener, dialogue, &deferred);
+
+        const ESM::ESM_Context context = esm.getContext();
+        const std::filesystem::path name = esm.getName();
+
+        // Encoder has internal buffer so each thread needs own copy
+        std::vector<ToUTF8::Utf8Encoder> encoders;
+        if (esm.getEncoder() != nullptr)
+        {
+            encoders.reserve(numThreads);
+            for (std::size_t i = 0; i < numThreads; ++i)
+                encoders.push_back(*esm.getEncoder());
+        }
+
+        constexpr std::size_t batchSize = 64;
+        std::atomic_size_t next{ 0 };
+        std::atomic_bool failed{ false };
+        std::mutex errorMutex;
+        std::exception_ptr error;
+
+        const auto decode = [&](ESM::ESMReader& reader) {
+            ESM::ESM_Context recordContext = context;
+            while (!failed.load(std::memory_order_relaxed))
+            {
+                const std::size_t begin = next.fetch_add(batchSize, std::memory_order_relaxed);
+                if (begin >= deferred.size())
+                    return;
+                const std::size_t end = std::min(begin + batchSize, deferred.size());
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const DeferredRecord& record = deferred[i];
+                    if (record.mLoaded)
+                        continue;
+                    seekRecord(reader, recordContext, record.mPosition);
+                    record.mStore->loadDeferred(record.mIndex, reader);
+                }
+            }
+        };
+
+        const auto setError = [&] {
+            failed = true;
+            const std::lock_guard lock(errorMutex);
+            if (error == nullptr)
+                error = std::current_exception();
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        for (std::size_t i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back([&, i] {
+                try
+                {
+                    ESM::ESMReader reader;
+                    if (!encoders.empty())
+                        reader.setEncoder(&encoders[i]);
+                    reader.open(openStream(), name);
+                    decode(reader);
+                }
+                catch (...)
+                {
+                    setError();
+                }
+            });
+        }
+
+        try
+        {
+            decode(esm);
+        }
+        catch (...)
+        {
+            setError();
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        esm.restoreContext(context);
+
+        if (error != nullptr)
+            std::rethrow_exception(error);
+
+        for (DynamicStore* store : mDynamicStores)
+            store->insertDeferred();
+    }
+
+    void ESMStore::loadImpl(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue,
+        std::vector<DeferredRecord>* deferred)
     {
         if (listener != nullptr)
             listener->setProgressRange(::EsmLoader::fileProgress);
@@ -445,6 +570,22 @@ namespace MWWorld
                     throw std::runtime_error("Unknown record: " + n.toString());
                 }
             }
+            else if (deferred != nullptr && it->second->isDeferrable())
+            {
+                DynamicStore& store = *it->second;
+                // Record following a dialogue is decoded now because only a deleted record keeps following INFO
+                // records attached to the dialogue. It's still inserted by insertDeferred to keep the order.
+                const DeferredRecord& record = deferred->emplace_back(DeferredRecord{ .mStore = &store,
+                    .mIndex = store.deferRecord(),
+                    .mPosition = esm.getFileOffset() - recordHeaderSize,
+                    .mLoaded = dialogue != nullptr });
+                if (!record.mLoaded)
+                    esm.skipRecord();
+                else if (store.loadDeferred(record.mIndex, esm).mIsDeleted)
+                    continue;
+                else
+                    dialogue = nullptr;
+            }
             else
             {
                 RecordId id = it->second->load(esm);
@@ -2,6 +2,8 @@
 #define OPENMW_MWWORLD_ESMSTORE_H
 
 #include <filesystem>
+#include <functional>
+#include <istream>
 #include <memory>
 #include <stdexcept>
 #include <tuple>
@@ -184,6 +186,11 @@ namespace MWWorld
 
         void setIdType(const ESM::RefId& id, ESM::RecNameInts type);
 
+        struct DeferredRecord;
+
+        void loadImpl(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue,
+            std::vector<DeferredRecord>* deferred);
+
         using LuaContent = std::variant<ESM::LuaScriptsCfg, // data from an omwaddon
             std::filesystem::path>; // path to an omwscripts file
         std::vector<LuaContent> mLuaContent;
@@ -219,6 +226,12 @@ namespace MWWorld
         void validateDynamic();
 
         void load(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue);
+
+        /// Same as load() but records of stores supporting deferred loading are only located while reading the file
+        /// and then decoded by numThreads additional threads together with the calling thread. Each additional thread
+        /// reads the same content file with own reader using a stream created by openStream.
+        void loadParallel(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue,
+            std::size_t numThreads, const std::function<std::unique_ptr<std::istream>()>& openStream);
         void loadESM4(ESM4::Reader& esm);
 
         template <class T>
@@ -1098,6 +1098,7 @@ namespace MWWorld
             : mMesh(mesh)
             , mSceneManager(sceneManager)
         {
+            setCategory(SceneUtil::WorkCategory::Preload);
         }
 
         void doWork() override
@@ -1158,6 +1159,9 @@ namespace MWWorld
 
         mLastPlayerPos = playerPos;
 
+        // Preloading of the cells closer to the player is more urgent
+        mRendering.getWorkQueue()->setViewPoint(playerPos);
+
         if (mPreloadEnabled)
         {
             if (mPreloadDoors)
@@ -232,6 +232,49 @@ namespace MWWorld
         }
     }
 
+    template <class T, class Id>
+    bool TypedDynamicStore<T, Id>::isDeferrable() const
+    {
+        return !ESM::isESM4Rec(T::sRecordId);
+    }
+    template <class T, class Id>
+    std::size_t TypedDynamicStore<T, Id>::deferRecord()
+    {
+        mDeferred.emplace_back();
+        return mDeferred.size() - 1;
+    }
+    template <class T, class Id>
+    RecordId TypedDynamicStore<T, Id>::loadDeferred(std::size_t index, ESM::ESMReader& esm)
+    {
+        if constexpr (!ESM::isESM4Rec(T::sRecordId))
+        {
+            auto& [record, isDeleted] = mDeferred[index];
+            isDeleted = false;
+            record.load(esm, isDeleted);
+
+            if constexpr (std::is_same_v<Id, ESM::RefId>)
+                return RecordId(record.mId, isDeleted);
+            else
+                return RecordId();
+        }
+        else
+            throw std::logic_error("Deferred loading is not supported for ESM4 records");
+    }
+    template <class T, class Id>
+    void TypedDynamicStore<T, Id>::insertDeferred()
+    {
+        for (auto& [record, isDeleted] : mDeferred)
+        {
+            const Id id = record.mId;
+            std::pair<typename Static::iterator, bool> inserted = mStatic.insert_or_assign(id, std::move(record));
+            if (inserted.second)
+                mShared.push_back(&inserted.first->second);
+            if (isDeleted)
+                eraseStatic(id);
+        }
+        mDeferred.clear();
+    }
+
     template <class T, class Id>
     void TypedDynamicStore<T, Id>::setUp()
     {
@@ -1086,6 +1129,11 @@ namespace MWWorld
             [](const ESM::Dialogue* l, const ESM::Dialogue* r) -> bool { return l->mId < r->mId; });
 
         mKeywordSearchModFlag = true;
+
+        mInfoIndices.clear();
+        mInfoIndices.reserve(mStatic.size());
+        for (const auto& [id, dial] : mStatic)
+            mInfoIndices.emplace(id, MWDialogue::InfoIndex(dial));
     }
 
     const ESM::Dialogue* Store<ESM::Dialogue>::search(const ESM::RefId& id) const
@@ -1145,6 +1193,7 @@ namespace MWWorld
         }
 
         mKeywordSearchModFlag = true;
+        mInfoIndices.erase(dialogue.mId);
 
         return RecordId(dialogue.mId, isDeleted);
     }
@@ -1154,6 +1203,8 @@ namespace MWWorld
         if (eraseFromMap(mStatic, id))
             mKeywordSearchModFlag = true;
 
+        mInfoIndices.erase(id);
+
         return true;
     }
 
@@ -1178,6 +1229,7 @@ namespace MWWorld
 
             for (const auto& it : keywordList)
                 mKeywordSearch.seed(it, 0 /*unused*/);
+            mKeywordSearch.buildLinks();
 
             mKeywordSearchModFlag = false;
         }
@@ -1185,6 +1237,14 @@ namespace MWWorld
         return mKeywordSearch;
     }
 
+    const MWDialogue::InfoIndex* Store<ESM::Dialogue>::searchInfoIndex(const ESM::RefId& id) const
+    {
+        const auto it = mInfoIndices.find(id);
+        if (it == mInfoIndices.end())
+            return nullptr;
+        return &it->second;
+    }
+
     // ESM4 Cell
     //=========================================================================
 
@@ -26,6 +26,7 @@
 #include <components/misc/rng.hpp>
 #include <components/misc/strings/algorithm.hpp>
 
+#include "../mwdialogue/infoindex.hpp"
 #include "../mwdialogue/keywordsearch.hpp"
 
 namespace ESM
@@ -80,6 +81,19 @@ namespace MWWorld
 
         virtual RecordId read(ESM::ESMReader& reader, bool overrideOnly = false) { return RecordId(); }
         ///< Read into dynamic storage
+
+        /// Whether load() depends only on the loaded record so records can be decoded out of order by
+        /// loadDeferred() and inserted later by insertDeferred().
+        virtual bool isDeferrable() const { return false; }
+
+        /// Reserve a slot for a record to be decoded by loadDeferred(). Returns slot index.
+        virtual std::size_t deferRecord() { return 0; }
+
+        /// Decode current record into the slot. Can be called concurrently for different slots.
+        virtual RecordId loadDeferred(std::size_t index, ESM::ESMReader& esm) { return RecordId(); }
+
+        /// Insert decoded records in the order of slots the same way as load() and eraseStatic() do and release slots.
+        virtual void insertDeferred() {}
     };
 
     using DynamicStore = DynamicStoreBase<ESM::RefId>;
@@ -245,6 +259,15 @@ namespace MWWorld
         RecordId load(ESM::ESMReader& esm) override;
         void write(ESM::ESMWriter& writer, Loading::Listener& progress) const override;
         RecordId read(ESM::ESMReader& reader, bool overrideOnly = false) override;
+
+        bool isDeferrable() const override;
+        std::size_t deferRecord() override;
+        RecordId loadDeferred(std::size_t index, ESM::ESMReader& esm) override;
+        void insertDeferred() override;
+
+    private:
+        /// Records decoded by loadDeferred() with deleted flag
+        std::vector<std::pair<T, bool>> mDeferred;
     };
 
     template <class T>
@@ -419,6 +442,15 @@ namespace MWWorld
         iterator extBegin() const;
         iterator extEnd() const;
 
+        /// Call function for each exterior cell loaded from content files. Can be used from other threads because
+        /// these cells are not modified after loading.
+        template <class Function>
+        void forEachStaticExt(Function&& function) const
+        {
+            for (const auto& [position, cell] : mExt)
+                function(*cell);
+        }
+
         // Return the northernmost cell in the easternmost column.
         const ESM::Cell* searchExtByName(std::string_view id) const;
 
@@ -534,6 +566,8 @@ namespace MWWorld
         mutable bool mKeywordSearchModFlag;
         mutable MWDialogue::KeywordSearch<int /*unused*/> mKeywordSearch;
 
+        std::unordered_map<ESM::RefId, MWDialogue::InfoIndex> mInfoIndices;
+
     public:
         Store();
 
@@ -556,6 +590,9 @@ namespace MWWorld
         void listIdentifier(std::vector<ESM::RefId>& list) const override;
 
         const MWDialogue::KeywordSearch<int>& getDialogIdKeywordSearch() const;
+
+        /// Returns nullptr when the dialogue is modified after the last setUp call.
+        const MWDialogue::InfoIndex* searchInfoIndex(const ESM::RefId& id) const;
     };
 
     template <typename T>
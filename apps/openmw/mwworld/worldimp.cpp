@@ -45,6 +45,7 @@
 #include <components/sceneutil/workqueue.hpp>
 
 #include <components/detournavigator/agentbounds.hpp>
+#include <components/detournavigator/asyncpathfinder.hpp>
 #include <components/detournavigator/debug.hpp>
 #include <components/detournavigator/navigator.hpp>
 #include <components/detournavigator/settings.hpp>
@@ -300,6 +301,9 @@ namespace MWWorld
             auto navigatorSettings = DetourNavigator::makeSettingsFromSettingsManager();
             navigatorSettings.mRecast.mSwimHeightScale = mSwimHeightScale;
             mNavigator = DetourNavigator::makeNavigator(navigatorSettings, mUserDataPath);
+            if (navigatorSettings.mAsyncPathFinderThreads > 0)
+                mAsyncPathFinder = std::make_unique<DetourNavigator::AsyncPathFinder>(
+                    *mNavigator, navigatorSettings.mAsyncPathFinderThreads);
         }
         else
         {
@@ -1675,6 +1679,10 @@ namespace MWWorld
 
         updateNavigator();
 
+        // Paths requested by AI during the mechanics update are found while the frame is rendered
+        if (mAsyncPathFinder != nullptr)
+            mAsyncPathFinder->submit();
+
         mPlayer->update();
 
         mPhysics->debugDraw();
@@ -2841,7 +2849,8 @@ namespace MWWorld
         ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
     {
         GameContentLoader gameContentLoader;
-        EsmLoader esmLoader(mStore, mReaders, encoder, mESMVersions);
+        EsmLoader esmLoader(mStore, mReaders, encoder, mESMVersions,
+            static_cast<std::size_t>(Settings::general().mContentLoadingNumThreads.get()));
 
         gameContentLoader.addLoader(".esm", esmLoader);
         gameContentLoader.addLoader(".esp", esmLoader);
@@ -3787,6 +3796,11 @@ namespace MWWorld
         return mNavigator.get();
     }
 
+    DetourNavigator::AsyncPathFinder* World::getAsyncPathFinder() const
+    {
+        return mAsyncPathFinder.get();
+    }
+
     void World::updateActorPath(const MWWorld::ConstPtr& actor, const std::deque<osg::Vec3f>& path,
         const DetourNavigator::AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end) const
     {
@@ -100,6 +100,7 @@ namespace MWWorld
         std::unique_ptr<MWWorld::Player> mPlayer;
         std::unique_ptr<MWPhysics::PhysicsSystem> mPhysics;
         std::unique_ptr<DetourNavigator::Navigator> mNavigator;
+        std::unique_ptr<DetourNavigator::AsyncPathFinder> mAsyncPathFinder;
         std::unique_ptr<MWRender::RenderingManager> mRendering;
         std::unique_ptr<MWWorld::Scene> mWorldScene;
         std::unique_ptr<MWWorld::WeatherManager> mWeatherManager;
@@ -641,6 +642,8 @@ namespace MWWorld
 
         DetourNavigator::Navigator* getNavigator() const override;
 
+        DetourNavigator::AsyncPathFinder* getAsyncPathFinder() const override;
+
         void updateActorPath(const MWWorld::ConstPtr& actor, const std::deque<osg::Vec3f>& path,
             const DetourNavigator::AgentBounds& agentBounds, const osg::Vec3f& start,
             const osg::Vec3f& end) const override;
@@ -17,6 +17,7 @@ TEST_F(KeywordSearchTest, keyword_test_conflict_resolution)
     search.seed("foo bar", 0);
     search.seed("bar lock", 0);
     search.seed("lock switch", 0);
+    search.buildLinks();
 
     std::string text = "foo bar lock switch";
 
@@ -34,6 +35,7 @@ TEST_F(KeywordSearchTest, keyword_test_conflict_resolution2)
     MWDialogue::KeywordSearch<int> search;
     search.seed("the dwemer", 0);
     search.seed("dwemer language", 0);
+    search.buildLinks();
 
     std::string text = "the dwemer language";
 
@@ -52,6 +54,7 @@ TEST_F(KeywordSearchTest, keyword_test_conflict_resolution3)
     search.seed("foo bar", 0);
     search.seed("bar lock", 0);
     search.seed("lock so", 0);
+    search.buildLinks();
 
     std::string text = "foo bar lock so";
 
@@ -70,6 +73,7 @@ TEST_F(KeywordSearchTest, keyword_test_utf8_word_begin)
     search.seed("ïrradiés", 0);
     search.seed("ça nous déçois", 0);
     search.seed("ois", 0);
+    search.buildLinks();
 
     std::string text
         = "les nations unis ont réunis le monde entier, états units inclus pour parler du problème des gens ïrradiés "
@@ -89,6 +93,7 @@ TEST_F(KeywordSearchTest, keyword_test_non_alpha_non_whitespace_word_begin)
     // We make sure that the search works well even if the separator is not a whitespace
     MWDialogue::KeywordSearch<int> search;
     search.seed("Report to caius cosades", 0);
+    search.buildLinks();
 
     std::string text = "I was told to \"Report to caius cosades\"";
 
@@ -104,6 +109,7 @@ TEST_F(KeywordSearchTest, keyword_test_russian_non_ascii_before)
     // We make sure that the search works well even if the separator is not a whitespace with russian chars
     MWDialogue::KeywordSearch<int> search;
     search.seed("Доложить Каю Косадесу", 0);
+    search.buildLinks();
 
     std::string text
         = "Что? Да. Я Кай Косадес. То есть как это, вам велели «Доложить Каю Косадесу»? О чем вы говорите?";
@@ -120,6 +126,7 @@ TEST_F(KeywordSearchTest, keyword_test_russian_ascii_before)
     // We make sure that the search works well even if the separator is not a whitespace with russian chars
     MWDialogue::KeywordSearch<int> search;
     search.seed("Доложить Каю Косадесу", 0);
+    search.buildLinks();
 
     std::string text
         = "Что? Да. Я Кай Косадес. То есть как это, вам велели 'Доложить Каю Косадесу'? О чем вы говорите?";
@@ -130,3 +137,104 @@ TEST_F(KeywordSearchTest, keyword_test_russian_ascii_before)
     EXPECT_EQ(matches.size(), 1);
     EXPECT_EQ(std::string(matches[0].mBeg, matches[0].mEnd), "Доложить Каю Косадесу");
 }
+
+TEST_F(KeywordSearchTest, keyword_test_case_insensitive)
+{
+    MWDialogue::KeywordSearch<int> search;
+    search.seed("Caius Cosades", 0);
+    search.seed("доложить", 1);
+    search.buildLinks();
+
+    std::string text = "Report to caius COSADES. Доложить.";
+
+    std::vector<MWDialogue::KeywordSearch<int>::Match> matches;
+    search.highlightKeywords(text.begin(), text.end(), matches);
+
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(std::string(matches[0].mBeg, matches[0].mEnd), "caius COSADES");
+    EXPECT_EQ(matches[0].mValue, 0);
+    EXPECT_EQ(std::string(matches[1].mBeg, matches[1].mEnd), "Доложить");
+    EXPECT_EQ(matches[1].mValue, 1);
+}
+
+TEST_F(KeywordSearchTest, keyword_test_prefix_of_other_keyword)
+{
+    MWDialogue::KeywordSearch<int> search;
+    search.seed("vivec city", 0);
+    search.seed("vivec", 1);
+    search.buildLinks();
+
+    std::string text = "vivec lives in vivec city";
+
+    std::vector<MWDialogue::KeywordSearch<int>::Match> matches;
+    search.highlightKeywords(text.begin(), text.end(), matches);
+
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(std::string(matches[0].mBeg, matches[0].mEnd), "vivec");
+    EXPECT_EQ(matches[0].mValue, 1);
+    EXPECT_EQ(std::string(matches[1].mBeg, matches[1].mEnd), "vivec city");
+    EXPECT_EQ(matches[1].mValue, 0);
+}
+
+TEST_F(KeywordSearchTest, keyword_test_seed_after_search)
+{
+    MWDialogue::KeywordSearch<int> search;
+    search.seed("bar", 0);
+    search.buildLinks();
+
+    std::string text = "foo bar";
+
+    std::vector<MWDialogue::KeywordSearch<int>::Match> matches;
+    search.highlightKeywords(text.begin(), text.end(), matches);
+    ASSERT_EQ(matches.size(), 1);
+
+    search.seed("foo", 1);
+    search.buildLinks();
+    matches.clear();
+    search.highlightKeywords(text.begin(), text.end(), matches);
+
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(std::string(matches[0].mBeg, matches[0].mEnd), "foo");
+    EXPECT_EQ(std::string(matches[1].mBeg, matches[1].mEnd), "bar");
+}
+
+TEST_F(KeywordSearchTest, keyword_test_empty_text)
+{
+    MWDialogue::KeywordSearch<int> search;
+    search.seed("foo", 0);
+    search.buildLinks();
+
+    std::string text;
+
+    std::vector<MWDialogue::KeywordSearch<int>::Match> matches;
+    search.highlightKeywords(text.begin(), text.end(), matches);
+
+    EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(KeywordSearchTest, keyword_test_contains_keyword)
+{
+    MWDialogue::KeywordSearch<int> search;
+    search.seed("foo bar", 1);
+    search.seed("foo", 2);
+    search.buildLinks();
+
+    int value = 0;
+    EXPECT_TRUE(search.containsKeyword("FOO", value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(search.containsKeyword("foo bar", value));
+    EXPECT_EQ(value, 1);
+    EXPECT_FALSE(search.containsKeyword("foo ba", value));
+    EXPECT_FALSE(search.containsKeyword("bar", value));
+}
+
+TEST_F(KeywordSearchTest, keyword_test_search_should_throw_when_links_are_not_built)
+{
+    MWDialogue::KeywordSearch<int> search;
+    search.seed("foo", 0);
+
+    std::string text = "foo";
+
+    std::vector<MWDialogue::KeywordSearch<int>::Match> matches;
+    EXPECT_THROW(search.highlightKeywords(text.begin(), text.end(), matches), std::logic_error);
+}
@@ -0,0 +1,120 @@
+#include "apps/openmw/mwdialogue/infoindex.hpp"
+
+#include <components/esm3/loaddial.hpp>
+#include <components/esm3/loadinfo.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace MWDialogue
+{
+    namespace
+    {
+        using namespace testing;
+
+        struct MWDialogueInfoIndexTest : Test
+        {
+            ESM::Dialogue mDialogue;
+
+            ESM::DialInfo& addInfo(std::string_view id)
+            {
+                ESM::DialInfo& info = mDialogue.mInfo.emplace_back();
+                info.mId = ESM::RefId::stringRefId(id);
+                info.mFactionLess = false;
+                return info;
+            }
+
+            std::vector<ESM::RefId> getCandidates(const InfoIndex::Speaker& speaker) const
+            {
+                const InfoIndex index(mDialogue);
+                std::vector<const ESM::DialInfo*> candidates;
+                index.getCandidates(speaker, candidates);
+                std::vector<ESM::RefId> result;
+                for (const ESM::DialInfo* info : candidates)
+                    result.push_back(info->mId);
+                return result;
+            }
+
+            static InfoIndex::Speaker makeNpc()
+            {
+                InfoIndex::Speaker speaker;
+                speaker.mId = ESM::RefId::stringRefId("npc");
+                speaker.mRace = ESM::RefId::stringRefId("dark elf");
+                speaker.mClass = ESM::RefId::stringRefId("pilgrim");
+                speaker.mFaction = ESM::RefId::stringRefId("temple");
+                return speaker;
+            }
+        };
+
+        TEST_F(MWDialogueInfoIndexTest, getCandidatesShouldReturnNothingForEmptyDialogue)
+        {
+            EXPECT_THAT(getCandidates(makeNpc()), IsEmpty());
+        }
+
+        TEST_F(MWDialogueInfoIndexTest, getCandidatesShouldReturnInfosWithoutSpeakerFilters)
+        {
+            addInfo("a");
+            addInfo("b");
+            EXPECT_THAT(getCandidates(makeNpc()),
+                ElementsAre(ESM::RefId::stringRefId("a"), ESM::RefId::stringRefId("b")));
+        }
+
+        TEST_F(MWDialogueInfoIndexTest, getCandidatesShouldReturnMatchingInfosInDialogueOrder)
+        {
+            addInfo("sex").mData.mGender = ESM::DialInfo::Male;
+            addInfo("faction").mFaction = ESM::RefId::stringRefId("temple");
+            addInfo("class").mClass = ESM::RefId::stringRefId("pilgrim");
+            addInfo("race").mRace = ESM::RefId::stringRefId("dark elf");
+            addInfo("actor").mActor = ESM::RefId::stringRefId("npc");
+            addInfo("any");
+            EXPECT_THAT(getCandidates(makeNpc()),
+                ElementsAre(ESM::RefId::stringRefId("sex"), ESM::RefId::stringRefId("faction"),
+                    ESM::RefId::stringRefId("class"), ESM::RefId::stringRefId("race"),
+                    ESM::RefId::stringRefId("actor"), ESM::RefId::stringRefId("any")));
+        }
+
+        TEST_F(MWDialogueInfoIndexTest, getCandidatesShouldSkipInfosForOtherSpeakers)
+        {
+            addInfo("female").mData.mGender = ESM::DialInfo::Female;
+            addInfo("faction").mFaction = ESM::RefId::stringRefId("mages guild");
+            addInfo("factionless").mFactionLess = true;
+            addInfo("class").mClass = ESM::RefId::stringRefId("guard");
+            addInfo("race").mRace = ESM::RefId::stringRefId("nord");
+            addInfo("actor").mActor = ESM::RefId::stringRefId("other");
+            EXPECT_THAT(getCandidates(makeNpc()), IsEmpty());
+        }
+
+        TEST_F(MWDialogueInfoIndexTest, getCandidatesShouldReturnFactionlessInfosForSpeakerWithoutFaction)
+        {
+            addInfo("faction").mFaction = ESM::RefId::stringRefId("temple");
+            addInfo("factionless").mFactionLess = true;
+            InfoIndex::Speaker speaker = makeNpc();
+            speaker.mFaction = ESM::RefId();
+            EXPECT_THAT(getCandidates(speaker), ElementsAre(ESM::RefId::stringRefId("factionless")));
+        }
+
+        TEST_F(MWDialogueInfoIndexTest, getCandidatesShouldReturnOnlyInfosForCreatureId)
+        {
+            addInfo("any");
+            addInfo("race").mRace = ESM::RefId::stringRefId("dark elf");
+            ESM::DialInfo& actor = addInfo("actor");
+            actor.mActor = ESM::RefId::stringRefId("creature");
+            actor.mRace = ESM::RefId::stringRefId("dark elf");
+            InfoIndex::Speaker speaker;
+            speaker.mId = ESM::RefId::stringRefId("creature");
+            speaker.mIsCreature = true;
+            EXPECT_THAT(getCandidates(speaker), ElementsAre(ESM::RefId::stringRefId("actor")));
+        }
+
+        TEST_F(MWDialogueInfoIndexTest, getCandidatesShouldReturnInfosForFemaleSpeaker)
+        {
+            addInfo("male").mData.mGender = ESM::DialInfo::Male;
+            addInfo("female").mData.mGender = ESM::DialInfo::Female;
+            addInfo("any");
+            InfoIndex::Speaker speaker = makeNpc();
+            speaker.mIsFemale = true;
+            EXPECT_THAT(getCandidates(speaker),
+                ElementsAre(ESM::RefId::stringRefId("female"), ESM::RefId::stringRefId("any")));
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include "apps/openmw/mwmechanics/actorstorage.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace MWMechanics
+{
+    namespace
+    {
+        using namespace testing;
+
+        using Storage = ActorStorage<int, int>;
+
+        std::vector<int> getValues(const Storage& storage)
+        {
+            std::vector<int> result;
+            for (const int value : storage)
+                result.push_back(value);
+            return result;
+        }
+
+        TEST(MWMechanicsActorStorageTest, should_iterate_in_insertion_order)
+        {
+            Storage storage;
+            storage.emplace(3, 30);
+            storage.emplace(1, 10);
+            storage.emplace(2, 20);
+            EXPECT_EQ(storage.size(), 3u);
+            EXPECT_THAT(getValues(storage), ElementsAre(30, 10, 20));
+        }
+
+        TEST(MWMechanicsActorStorageTest, find_should_return_value_by_key)
+        {
+            Storage storage;
+            storage.emplace(1, 10);
+            ASSERT_NE(storage.find(1), nullptr);
+            EXPECT_EQ(*storage.find(1), 10);
+            EXPECT_EQ(storage.find(2), nullptr);
+        }
+
+        TEST(MWMechanicsActorStorageTest, erase_should_leave_hole_skipped_by_iteration)
+        {
+            Storage storage;
+            storage.emplace(1, 10);
+            storage.emplace(2, 20);
+            storage.emplace(3, 30);
+            EXPECT_TRUE(storage.erase(2));
+            EXPECT_FALSE(storage.erase(2));
+            EXPECT_EQ(storage.size(), 2u);
+            EXPECT_EQ(storage.getDenseSize(), 3u);
+            EXPECT_EQ(storage.getAt(1), nullptr);
+            EXPECT_EQ(storage.find(2), nullptr);
+            EXPECT_THAT(getValues(storage), ElementsAre(10, 30));
+        }
+
+        TEST(MWMechanicsActorStorageTest, values_added_while_iterating_should_be_visited)
+        {
+            Storage storage;
+            storage.emplace(1, 10);
+            std::vector<int> visited;
+            for (const int value : storage)
+            {
+                visited.push_back(value);
+                if (value == 10)
+                    storage.emplace(2, 20);
+            }
+            EXPECT_THAT(visited, ElementsAre(10, 20));
+        }
+
+        TEST(MWMechanicsActorStorageTest, values_erased_while_iterating_should_not_be_visited)
+        {
+            Storage storage;
+            storage.emplace(1, 10);
+            storage.emplace(2, 20);
+            storage.emplace(3, 30);
+            std::vector<int> visited;
+            for (const int value : storage)
+            {
+                visited.push_back(value);
+                if (value == 10)
+                    storage.erase(2);
+            }
+            EXPECT_THAT(visited, ElementsAre(10, 30));
+        }
+
+        TEST(MWMechanicsActorStorageTest, compact_should_remove_holes_preserving_order)
+        {
+            Storage storage;
+            storage.emplace(1, 10);
+            storage.emplace(2, 20);
+            const ActorHandle handle = storage.emplace(3, 30);
+            storage.erase(1);
+            std::vector<std::pair<std::size_t, std::size_t>> moved;
+            storage.compact([&](std::size_t from, std::size_t to) { moved.emplace_back(from, to); });
+            EXPECT_THAT(moved, ElementsAre(Pair(1u, 0u), Pair(2u, 1u)));
+            EXPECT_EQ(storage.getDenseSize(), 2u);
+            EXPECT_EQ(storage.getIndex(handle), 1u);
+            EXPECT_THAT(getValues(storage), ElementsAre(20, 30));
+        }
+
+        TEST(MWMechanicsActorStorageTest, handle_should_not_resolve_to_value_reusing_slot)
+        {
+            Storage storage;
+            const ActorHandle erased = storage.emplace(1, 10);
+            storage.erase(1);
+            const ActorHandle added = storage.emplace(2, 20);
+            EXPECT_EQ(erased.mSlot, added.mSlot);
+            EXPECT_EQ(storage.get(erased), nullptr);
+            ASSERT_NE(storage.get(added), nullptr);
+            EXPECT_EQ(*storage.get(added), 20);
+        }
+
+        TEST(MWMechanicsActorStorageTest, clear_should_invalidate_handles)
+        {
+            Storage storage;
+            const ActorHandle handle = storage.emplace(1, 10);
+            storage.clear();
+            EXPECT_EQ(storage.size(), 0u);
+            EXPECT_EQ(storage.get(handle), nullptr);
+            EXPECT_THAT(getValues(storage), IsEmpty());
+        }
+    }
+}
@@ -0,0 +1,222 @@
+#include "apps/openmw/mwscript/scriptcache.hpp"
+
+#include <components/compiler/extensions.hpp>
+#include <components/compiler/extensions0.hpp>
+#include <components/compiler/fileparser.hpp>
+#include <components/compiler/locals.hpp>
+#include <components/compiler/scanner.hpp>
+#include <components/compiler/streamerrorhandler.hpp>
+#include <components/esm/refid.hpp>
+#include <components/testing/util.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+namespace MWScript
+{
+    namespace
+    {
+        using namespace testing;
+
+        class TestCompilerContext : public Compiler::Context
+        {
+        public:
+            std::map<std::string, char, std::less<>> mGlobals;
+
+            bool canDeclareLocals() const override { return true; }
+
+            char getGlobalType(const std::string& name) const override
+            {
+                const auto it = mGlobals.find(name);
+                return it == mGlobals.end() ? ' ' : it->second;
+            }
+
+            std::pair<char, bool> getMemberType(const std::string& name, const ESM::RefId& id) const override
+            {
+                return { ' ', false };
+            }
+
+            bool isId(const ESM::RefId& name) const override { return name == "player"; }
+        };
+
+        struct MWScriptScriptCacheTest : Test
+        {
+            Compiler::Extensions mExtensions;
+            TestCompilerContext mContext;
+
+            MWScriptScriptCacheTest()
+            {
+                Compiler::registerExtensions(mExtensions);
+                mContext.setExtensions(&mExtensions);
+                mContext.mGlobals.emplace("gvalue", 'f');
+            }
+
+            ScriptDependencies compile(const std::string& text)
+            {
+                ScriptDependencies dependencies;
+                RecordingCompilerContext context(mContext);
+                context.setDependencies(&dependencies);
+                Compiler::StreamErrorHandler errorHandler;
+                Compiler::FileParser parser(errorHandler, context);
+                std::istringstream input(text);
+                Compiler::Scanner scanner(errorHandler, input, context.getExtensions());
+                scanner.scan(parser);
+                EXPECT_TRUE(errorHandler.isGood());
+                return dependencies;
+            }
+        };
+
+        const std::string script = "begin test\n"
+                                   "float value\n"
+                                   "set value to gvalue\n"
+                                   "player->additem gold_001 1\n"
+                                   "end\n";
+
+        TEST_F(MWScriptScriptCacheTest, recordingContextShouldRecordGlobals)
+        {
+            const ScriptDependencies dependencies = compile(script);
+            ASSERT_EQ(dependencies.mGlobals.size(), 1);
+            EXPECT_EQ(dependencies.mGlobals[0].mName, "gvalue");
+            EXPECT_EQ(dependencies.mGlobals[0].mType, 'f');
+        }
+
+        TEST_F(MWScriptScriptCacheTest, checkDependenciesShouldReturnTrueForSameContext)
+        {
+            const ScriptDependencies dependencies = compile(script);
+            EXPECT_TRUE(checkDependencies(dependencies, mContext));
+        }
+
+        TEST_F(MWScriptScriptCacheTest, checkDependenciesShouldReturnFalseWhenGlobalTypeIsChanged)
+        {
+            const ScriptDependencies dependencies = compile(script);
+            mContext.mGlobals["gvalue"] = 's';
+            EXPECT_FALSE(checkDependencies(dependencies, mContext));
+        }
+
+        TEST_F(MWScriptScriptCacheTest, checkDependenciesShouldReturnFalseWhenGlobalIsRemoved)
+        {
+            const ScriptDependencies dependencies = compile(script);
+            mContext.mGlobals.clear();
+            EXPECT_FALSE(checkDependencies(dependencies, mContext));
+        }
+
+        TEST_F(MWScriptScriptCacheTest, getScriptTextDigestShouldDependOnText)
+        {
+            EXPECT_EQ(getScriptTextDigest(script), getScriptTextDigest(script));
+            EXPECT_NE(getScriptTextDigest(script), getScriptTextDigest(script + "\n"));
+        }
+
+        TEST_F(MWScriptScriptCacheTest, extensionsDigestShouldChangeWhenInstructionIsRegistered)
+        {
+            const std::uint64_t digest = mExtensions.getDigest();
+            mExtensions.registerInstruction("testinstruction", "", 0x3ffffff);
+            EXPECT_NE(mExtensions.getDigest(), digest);
+        }
+
+        TEST_F(MWScriptScriptCacheTest, localNamesShouldBeDeclaredInSameOrder)
+        {
+            Compiler::Locals locals;
+            locals.declare('f', "b");
+            locals.declare('s', "a");
+            locals.declare('f', "c");
+            locals.declare('l', "d");
+            Compiler::Locals declared;
+            declareLocals(getLocalNames(locals), declared);
+            const Compiler::Locals& result = declared;
+            EXPECT_EQ(result.get('s'), std::vector<std::string>{ "a" });
+            EXPECT_EQ(result.get('l'), std::vector<std::string>{ "d" });
+            EXPECT_EQ(result.get('f'), (std::vector<std::string>{ "b", "c" }));
+        }
+
+        TEST(MWScriptScriptCacheFileTest, removeUnusedScriptsShouldKeepOnlyUsedScripts)
+        {
+            ScriptCache cache;
+            cache.mScripts["used"].mTextDigest = 1;
+            cache.mScripts["unused"].mTextDigest = 2;
+            EXPECT_TRUE(removeUnusedScripts(cache, { "used", "absent" }));
+            ASSERT_EQ(cache.mScripts.size(), 1);
+            EXPECT_EQ(cache.mScripts.at("used").mTextDigest, 1);
+            EXPECT_FALSE(removeUnusedScripts(cache, { "used" }));
+            EXPECT_EQ(cache.mScripts.size(), 1);
+        }
+
+        TEST(MWScriptScriptCacheFileTest, readShouldReturnEmptyCacheForAbsentFile)
+        {
+            const ScriptCache cache = readScriptCache(TestingOpenMW::temporaryFilePath("absent_script_cache"));
+            EXPECT_EQ(cache.mExtensionsDigest, 0);
+            EXPECT_TRUE(cache.mScripts.empty());
+        }
+
+        TEST(MWScriptScriptCacheFileTest, readShouldReturnEmptyCacheForInvalidFile)
+        {
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("invalid_script_cache");
+            std::ofstream(path, std::ios_base::binary) << "invalid";
+            const ScriptCache cache = readScriptCache(path);
+            EXPECT_TRUE(cache.mScripts.empty());
+        }
+
+        TEST(MWScriptScriptCacheFileTest, shouldSupportWriteAndRead)
+        {
+            ScriptCache cache;
+            cache.mExtensionsDigest = 42;
+            CachedScript& cached = cache.mScripts["test"];
+            cached.mTextDigest = 13;
+            cached.mProgram.mInstructions = { 1, 2, 3 };
+            cached.mProgram.mIntegers = { -4 };
+            cached.mProgram.mFloats = { 0.5f };
+            cached.mProgram.mStrings = { "gold_001" };
+            cached.mLocals[2] = { "value" };
+            cached.mDependencies.mGlobals.push_back({ .mName = "gvalue", .mType = 'f' });
+            cached.mDependencies.mMembers.push_back(
+                { .mName = "state", .mId = "\"other\"", .mType = 's', .mReference = true });
+            cached.mDependencies.mIds.push_back({ .mId = "\"player\"", .mExists = true });
+
+            const std::filesystem::path path = TestingOpenMW::outputFilePath("script_cache");
+            writeScriptCache(cache, path);
+            const ScriptCache result = readScriptCache(path);
+
+            EXPECT_EQ(result.mExtensionsDigest, 42);
+            ASSERT_EQ(result.mScripts.size(), 1);
+            const CachedScript& script = result.mScripts.at("test");
+            EXPECT_EQ(script.mTextDigest, 13);
+            EXPECT_EQ(script.mProgram.mInstructions, (std::vector<Interpreter::Type_Code>{ 1, 2, 3 }));
+            EXPECT_EQ(script.mProgram.mIntegers, std::vector<Interpreter::Type_Integer>{ -4 });
+            EXPECT_EQ(script.mProgram.mFloats, std::vector<Interpreter::Type_Float>{ 0.5f });
+            EXPECT_EQ(script.mProgram.mStrings, std::vector<std::string>{ "gold_001" });
+            EXPECT_EQ(script.mLocals[2], std::vector<std::string>{ "value" });
+            ASSERT_EQ(script.mDependencies.mGlobals.size(), 1);
+            EXPECT_EQ(script.mDependencies.mGlobals[0].mName, "gvalue");
+            EXPECT_EQ(script.mDependencies.mGlobals[0].mType, 'f');
+            ASSERT_EQ(script.mDependencies.mMembers.size(), 1);
+            EXPECT_EQ(script.mDependencies.mMembers[0].mId, "\"other\"");
+            EXPECT_TRUE(script.mDependencies.mMembers[0].mReference);
+            ASSERT_EQ(script.mDependencies.mIds.size(), 1);
+            EXPECT_TRUE(script.mDependencies.mIds[0].mExists);
+        }
+
+        TEST(MWScriptScriptCacheFileTest, writeShouldNotLeaveTemporaryFiles)
+        {
+            const std::filesystem::path dir = TestingOpenMW::outputFilePathWithSubDir("script_cache_temporary_files");
+            std::filesystem::remove_all(dir);
+            ScriptCache cache;
+            cache.mExtensionsDigest = 42;
+            writeScriptCache(cache, dir / "script_cache");
+            writeScriptCache(cache, dir / "script_cache");
+            // Regular file can't replace a directory
+            std::filesystem::create_directories(dir / "directory" / "file");
+            EXPECT_ANY_THROW(writeScriptCache(cache, dir / "directory"));
+            std::vector<std::filesystem::path> files;
+            for (const auto& entry : std::filesystem::directory_iterator(dir))
+                files.push_back(entry.path().filename());
+            std::sort(files.begin(), files.end());
+            EXPECT_EQ(files, (std::vector<std::filesystem::path>{ "directory", "script_cache" }));
+            EXPECT_EQ(readScriptCache(dir / "script_cache").mExtensionsDigest, 42);
+        }
+    }
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "apps/openmw/mwsound/decodedsoundcache.hpp"
+
+namespace MWSound
+{
+    namespace
+    {
+        using namespace testing;
+        using namespace VFS::Path;
+
+        DecodedSound makeSound(std::size_t size)
+        {
+            DecodedSound result;
+            result.mSampleRate = 22050;
+            result.mChannels = ChannelConfig_Stereo;
+            result.mType = SampleType_Int16;
+            result.mData.resize(size);
+            for (std::size_t i = 0; i < size; ++i)
+                result.mData[i] = static_cast<char>(i * 7 % 13);
+            return result;
+        }
+
+        TEST(MWSoundCompressSoundTest, decompressShouldRestoreCompressedSound)
+        {
+            const DecodedSound sound = makeSound(10000);
+            const std::shared_ptr<const CompressedSound> compressed = compressSound(sound);
+            ASSERT_NE(compressed, nullptr);
+            const DecodedSound decompressed = decompressSound(*compressed);
+            EXPECT_EQ(decompressed.mData, sound.mData);
+            EXPECT_EQ(decompressed.mSampleRate, sound.mSampleRate);
+            EXPECT_EQ(decompressed.mChannels, sound.mChannels);
+            EXPECT_EQ(decompressed.mType, sound.mType);
+        }
+
+        TEST(MWSoundCompressSoundTest, compressShouldReturnNullForEmptySound)
+        {
+            EXPECT_EQ(compressSound(DecodedSound{}), nullptr);
+        }
+
+        TEST(MWSoundDecodedSoundCacheTest, getShouldReturnNullForMissingSound)
+        {
+            DecodedSoundCache cache(1024 * 1024);
+            EXPECT_EQ(cache.get(NormalizedView("sound/a.wav")), nullptr);
+        }
+
+        TEST(MWSoundDecodedSoundCacheTest, getShouldReturnAddedSound)
+        {
+            DecodedSoundCache cache(1024 * 1024);
+            const std::shared_ptr<const CompressedSound> sound = compressSound(makeSound(1000));
+            cache.put(NormalizedView("sound/a.wav"), sound);
+            EXPECT_EQ(cache.get(NormalizedView("sound/a.wav")), sound);
+        }
+
+        TEST(MWSoundDecodedSoundCacheTest, containsShouldNotAffectEvictionOrder)
+        {
+            const std::shared_ptr<const CompressedSound> a = compressSound(makeSound(1000));
+            const std::shared_ptr<const CompressedSound> b = compressSound(makeSound(1000));
+            DecodedSoundCache cache(a->mData.size() + b->mData.size());
+            cache.put(NormalizedView("sound/a.wav"), a);
+            cache.put(NormalizedView("sound/b.wav"), compressSound(makeSound(1000)));
+            EXPECT_TRUE(cache.contains(NormalizedView("sound/a.wav")));
+            cache.put(NormalizedView("sound/c.wav"), b);
+            EXPECT_FALSE(cache.contains(NormalizedView("sound/a.wav")));
+            EXPECT_TRUE(cache.contains(NormalizedView("sound/b.wav")));
+            EXPECT_TRUE(cache.contains(NormalizedView("sound/c.wav")));
+        }
+
+        TEST(MWSoundDecodedSoundCacheTest, putShouldEvictLeastRecentlyUsedSounds)
+        {
+            const std::shared_ptr<const CompressedSound> a = compressSound(makeSound(1000));
+            const std::shared_ptr<const CompressedSound> b = compressSound(makeSound(1000));
+            const std::shared_ptr<const CompressedSound> c = compressSound(makeSound(1000));
+            DecodedSoundCache cache(a->mData.size() + b->mData.size());
+            cache.put(NormalizedView("sound/a.wav"), a);
+            cache.put(NormalizedView("sound/b.wav"), b);
+            EXPECT_EQ(cache.get(NormalizedView("sound/a.wav")), a);
+            cache.put(NormalizedView("sound/c.wav"), c);
+            EXPECT_EQ(cache.get(NormalizedView("sound/a.wav")), a);
+            EXPECT_EQ(cache.get(NormalizedView("sound/b.wav")), nullptr);
+            EXPECT_EQ(cache.get(NormalizedView("sound/c.wav")), c);
+        }
+
+        TEST(MWSoundDecodedSoundCacheTest, putShouldIgnoreSoundLargerThanCache)
+        {
+            const std::shared_ptr<const CompressedSound> sound = compressSound(makeSound(1000));
+            DecodedSoundCache cache(sound->mData.size() - 1);
+            cache.put(NormalizedView("sound/a.wav"), sound);
+            EXPECT_EQ(cache.get(NormalizedView("sound/a.wav")), nullptr);
+        }
+
+        TEST(MWSoundDecodedSoundCacheTest, getShouldReturnNullWhenDisabled)
+        {
+            DecodedSoundCache cache(0);
+            cache.put(NormalizedView("sound/a.wav"), compressSound(makeSound(1000)));
+            EXPECT_EQ(cache.get(NormalizedView("sound/a.wav")), nullptr);
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#include "apps/openmw/mwstate/savewriter.hpp"
+
+#include <components/testing/util.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace MWState
+{
+    namespace
+    {
+        using namespace testing;
+
+        struct MWStateSaveWriterTest : Test
+        {
+            std::filesystem::path mDir;
+
+            void SetUp() override
+            {
+                mDir = TestingOpenMW::outputFilePathWithSubDir(std::filesystem::path("mwstate_save_writer")
+                    / UnitTest::GetInstance()->current_test_info()->name());
+                std::filesystem::remove_all(mDir);
+                std::filesystem::create_directories(mDir);
+            }
+
+            std::vector<std::filesystem::path> listDir() const
+            {
+                std::vector<std::filesystem::path> result;
+                for (const auto& entry : std::filesystem::directory_iterator(mDir))
+                    result.push_back(entry.path().filename());
+                return result;
+            }
+        };
+
+        std::string readFile(const std::filesystem::path& path)
+        {
+            std::ifstream stream(path, std::ios::binary);
+            std::stringstream result;
+            result << stream.rdbuf();
+            return result.str();
+        }
+
+        TEST_F(MWStateSaveWriterTest, wait_should_return_after_file_is_written)
+        {
+            const std::filesystem::path path = mDir / "save.omwsave";
+            const std::string data(16 * 1024 * 1024, 'a');
+            SaveWriter writer;
+            writer.write(path, std::string(data), false);
+            writer.wait();
+            EXPECT_EQ(readFile(path), data);
+            EXPECT_THAT(listDir(), ElementsAre("save.omwsave"));
+            EXPECT_THAT(writer.takeFailures(), IsEmpty());
+        }
+
+        TEST_F(MWStateSaveWriterTest, write_should_replace_existing_file)
+        {
+            const std::filesystem::path path = mDir / "save.omwsave";
+            std::ofstream(path) << "old content which is longer";
+            SaveWriter writer;
+            writer.write(path, "new content", false);
+            writer.wait();
+            EXPECT_EQ(readFile(path), "new content");
+            EXPECT_THAT(listDir(), ElementsAre("save.omwsave"));
+        }
+
+        TEST_F(MWStateSaveWriterTest, writes_should_be_done_in_order_of_requests)
+        {
+            const std::filesystem::path path = mDir / "save.omwsave";
+            SaveWriter writer;
+            for (int i = 0; i < 10; ++i)
+                writer.write(path, std::to_string(i), false);
+            writer.wait();
+            EXPECT_EQ(readFile(path), "9");
+        }
+
+        TEST_F(MWStateSaveWriterTest, destructor_should_finish_pending_writes)
+        {
+            const std::filesystem::path path = mDir / "save.omwsave";
+            {
+                SaveWriter writer;
+                writer.write(path, "content", false);
+            }
+            EXPECT_EQ(readFile(path), "content");
+        }
+
+        TEST_F(MWStateSaveWriterTest, failed_write_should_be_reported_once)
+        {
+            const std::filesystem::path path = mDir / "absent" / "save.omwsave";
+            SaveWriter writer;
+            writer.write(path, "content", false);
+            writer.wait();
+            const std::vector<SaveWriter::Failure> failures = writer.takeFailures();
+            ASSERT_EQ(failures.size(), 1);
+            EXPECT_EQ(failures[0].mPath, path);
+            EXPECT_THAT(failures[0].mError, Not(IsEmpty()));
+            EXPECT_THAT(writer.takeFailures(), IsEmpty());
+        }
+
+        TEST_F(MWStateSaveWriterTest, failed_rename_should_remove_temporary_file)
+        {
+            // Regular file can't replace a directory
+            std::filesystem::create_directory(mDir / "save.omwsave");
+            std::ofstream(mDir / "save.omwsave" / "file") << "content";
+            SaveWriter writer;
+            writer.write(mDir / "save.omwsave", "content", false);
+            writer.wait();
+            EXPECT_THAT(writer.takeFailures(), SizeIs(1));
+            EXPECT_THAT(listDir(), ElementsAre("save.omwsave"));
+        }
+
+        TEST_F(MWStateSaveWriterTest, failed_write_should_not_prevent_following_writes)
+        {
+            const std::filesystem::path path = mDir / "save.omwsave";
+            SaveWriter writer;
+            writer.write(mDir / "absent" / "save.omwsave", "content", false);
+            writer.write(path, "content", false);
+            writer.wait();
+            EXPECT_THAT(writer.takeFailures(), SizeIs(1));
+            EXPECT_EQ(readFile(path), "content");
+        }
+    }
+}
@@ -4,7 +4,9 @@
 #include <algorithm>
 #include <array>
 #include <fstream>
+#include <optional>
 #include <span>
+#include <sstream>
 
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/variables_map.hpp>
@@ -868,4 +870,144 @@ namespace
         ASSERT_NE(dialogue, nullptr);
         EXPECT_THAT(dialogue->mInfo, ElementsAre(HasIdEqualTo("info0"), HasIdEqualTo("info2")));
     }
+
+    template <class T>
+    void writeRecord(ESM::ESMWriter& writer, const T& record, bool deleted = false)
+    {
+        writer.startRecord(T::sRecordId);
+        record.save(writer, deleted);
+        writer.endRecord(T::sRecordId);
+    }
+
+    template <class T>
+    T makeRecord(std::string_view id, std::string_view name)
+    {
+        T record;
+        record.blank();
+        record.mId = ESM::RefId::stringRefId(id);
+        record.mName = name;
+        return record;
+    }
+
+    std::string makeMasterFile()
+    {
+        std::stringstream stream;
+        ESM::ESMWriter writer;
+        writer.setFormatVersion(ESM::CurrentContentFormatVersion);
+        writer.save(stream);
+
+        for (int i = 0; i < 300; ++i)
+        {
+            const std::string n = std::to_string(i);
+            writeRecord(writer, makeRecord<ESM::Activator>("activator" + n, "Activator " + n));
+            writeRecord(writer, makeRecord<ESM::Book>("book" + n, "Book " + n));
+            writeRecord(writer, makeRecord<ESM::Spell>("spell" + n, "Spell " + n));
+        }
+
+        const DialogueData data = generateDialogueWithInfos(3);
+        writeRecord(writer, data.mDialogue);
+        // Deleted record keeps next INFO attached to the dialogue
+        writeRecord(writer, makeRecord<ESM::Activator>("activator1", ""), true);
+        writeRecord(writer, data.mInfos[0]);
+        writeRecord(writer, data.mInfos[1]);
+        // Present record detaches next INFO from the dialogue
+        writeRecord(writer, makeRecord<ESM::Activator>("activator2", "Updated activator 2"));
+        writeRecord(writer, data.mInfos[2]);
+
+        writeRecord(writer, makeRecord<ESM::Book>("book3", "Updated book 3"));
+        writeRecord(writer, makeRecord<ESM::Book>("book4", ""), true);
+        writeRecord(writer, makeRecord<ESM::Book>("book4", "Restored book 4"));
+
+        return stream.str();
+    }
+
+    std::string makePluginFile()
+    {
+        std::stringstream stream;
+        ESM::ESMWriter writer;
+        writer.setFormatVersion(ESM::CurrentContentFormatVersion);
+        writer.save(stream);
+
+        writeRecord(writer, makeRecord<ESM::Activator>("Activator1", "Restored activator 1"));
+        writeRecord(writer, makeRecord<ESM::Spell>("spell5", ""), true);
+        writeRecord(writer, makeRecord<ESM::Spell>("spell6", "Updated spell 6"));
+        for (int i = 0; i < 100; ++i)
+            writeRecord(writer, makeRecord<ESM::Spell>("newspell" + std::to_string(i), "New spell"));
+
+        return stream.str();
+    }
+
+    template <class T>
+    void writeRecords(const MWWorld::ESMStore& esmStore, ESM::ESMWriter& writer)
+    {
+        for (const T& record : esmStore.get<T>())
+            writeRecord(writer, record);
+    }
+
+    std::string serializeStore(const MWWorld::ESMStore& esmStore)
+    {
+        std::stringstream stream;
+        ESM::ESMWriter writer;
+        writer.setFormatVersion(ESM::CurrentContentFormatVersion);
+        writer.save(stream);
+
+        writeRecords<ESM::Activator>(esmStore, writer);
+        writeRecords<ESM::Book>(esmStore, writer);
+        writeRecords<ESM::Spell>(esmStore, writer);
+        for (const ESM::Dialogue& dialogue : esmStore.get<ESM::Dialogue>())
+        {
+            writeRecord(writer, dialogue);
+            for (const ESM::DialInfo& info : dialogue.mInfo)
+                writeRecord(writer, info);
+        }
+
+        return stream.str();
+    }
+
+    void loadContentFiles(
+        const std::vector<std::string>& files, std::optional<std::size_t> numThreads, MWWorld::ESMStore& esmStore)
+    {
+        ESM::Dialogue* dialogue = nullptr;
+        for (std::size_t i = 0; i < files.size(); ++i)
+        {
+            const auto openStream = [&] { return std::make_unique<std::istringstream>(files[i]); };
+            ESM::ESMReader reader;
+            reader.setIndex(static_cast<int>(i));
+            reader.open(openStream(), "test" + std::to_string(i));
+            if (numThreads.has_value())
+                esmStore.loadParallel(reader, &dummyListener, dialogue, *numThreads, openStream);
+            else
+                esmStore.load(reader, &dummyListener, dialogue);
+        }
+        esmStore.setUp();
+    }
+
+    struct MWWorldStoreParallelLoadTest : TestWithParam<std::size_t>
+    {
+    };
+
+    TEST_P(MWWorldStoreParallelLoadTest, shouldProduceSameStoreAsSerialLoad)
+    {
+        const std::vector<std::string> files{ makeMasterFile(), makePluginFile() };
+
+        MWWorld::ESMStore serial;
+        loadContentFiles(files, std::nullopt, serial);
+
+        MWWorld::ESMStore parallel;
+        loadContentFiles(files, GetParam(), parallel);
+
+        EXPECT_EQ(serializeStore(parallel), serializeStore(serial));
+
+        EXPECT_EQ(parallel.get<ESM::Activator>().find(ESM::RefId::stringRefId("activator1"))->mName,
+            "Restored activator 1");
+        EXPECT_EQ(parallel.get<ESM::Book>().find(ESM::RefId::stringRefId("book4"))->mName, "Restored book 4");
+        EXPECT_EQ(parallel.get<ESM::Spell>().search(ESM::RefId::stringRefId("spell5")), nullptr);
+        EXPECT_EQ(parallel.get<ESM::Spell>().getSize(), 399);
+        const ESM::Dialogue* dialogue = parallel.get<ESM::Dialogue>().search(ESM::RefId::stringRefId("dialogue"));
+        ASSERT_NE(dialogue, nullptr);
+        EXPECT_THAT(dialogue->mInfo, ElementsAre(HasIdEqualTo("info0"), HasIdEqualTo("info1")));
+    }
+
+    INSTANTIATE_TEST_SUITE_P(
+        NumThreads, MWWorldStoreParallelLoadTest, Values(std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 3 }));
 }
@@ -658,7 +658,7 @@ namespace Bsa
         {
             if (c.packedSize != 0)
             {
-                Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, c.offset, c.packedSize);
+                Files::IStreamPtr streamPtr = openRegion(c.offset, c.packedSize);
                 std::istream* fileStream = streamPtr.get();
 
                 boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
@@ -671,10 +671,15 @@ namespace Bsa
             // uncompressed chunk
             else
             {
-                Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, c.offset, c.size);
-                std::istream* fileStream = streamPtr.get();
-
-                fileStream->read(memoryStreamPtr->getRawData() + offset, c.size);
+                if (const char* data = getMappedData(c.offset, c.size))
+                {
+                    std::memcpy(memoryStreamPtr->getRawData() + offset, data, c.size);
+                }
+                else
+                {
+                    Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, c.offset, c.size);
+                    streamPtr->read(memoryStreamPtr->getRawData() + offset, c.size);
+                }
             }
             offset += c.size;
         }
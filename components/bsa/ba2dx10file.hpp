@@ -50,6 +50,7 @@ namespace Bsa
     public:
         using BSAFile::getFilename;
         using BSAFile::getList;
+        using BSAFile::mapIntoMemory;
         using BSAFile::open;
 
         BA2DX10File();
@@ -217,7 +217,9 @@ namespace Bsa
     Files::IStreamPtr BA2GNRLFile::getFile(const FileRecord& fileRecord)
     {
         const uint32_t inputSize = fileRecord.packedSize ? fileRecord.packedSize : fileRecord.size;
-        Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, fileRecord.offset, inputSize);
+        if (!fileRecord.packedSize && getMappedData(fileRecord.offset, inputSize) != nullptr)
+            return openRegion(fileRecord.offset, inputSize);
+        Files::IStreamPtr streamPtr = openRegion(fileRecord.offset, inputSize);
         auto memoryStreamPtr = std::make_unique<MemoryInputStream>(fileRecord.size);
         if (fileRecord.packedSize)
         {
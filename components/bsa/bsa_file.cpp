@@ -23,8 +23,12 @@
 
 #include "bsa_file.hpp"
 
+#include <components/debug/debuglog.hpp>
 #include <components/esm/fourcc.hpp>
 #include <components/files/constrainedfilestream.hpp>
+#include <components/platform/file.hpp>
+
+#include "memorystream.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -252,6 +256,26 @@ void BSAFile::open(const std::filesystem::path& file)
     }
 }
 
+void BSAFile::open(const std::filesystem::path& file, FileList files, std::vector<char> names)
+{
+    if (mIsLoaded)
+        close();
+
+    mFilepath = file;
+    mFiles = std::move(files);
+    mStringBuf = std::move(names);
+
+    for (FileStruct& fs : mFiles)
+    {
+        if (fs.namesOffset >= mStringBuf.size()
+            || std::memchr(&mStringBuf[fs.namesOffset], '\0', mStringBuf.size() - fs.namesOffset) == nullptr)
+            fail("File table contains invalid names offset");
+        fs.namesBuffer = &mStringBuf;
+    }
+
+    mIsLoaded = true;
+}
+
 /// Close the archive, write the updated headers to the file
 void Bsa::BSAFile::close()
 {
@@ -260,12 +284,43 @@ void Bsa::BSAFile::close()
 
     mFiles.clear();
     mStringBuf.clear();
+    mMappedFile.reset();
     mIsLoaded = false;
 }
 
+void Bsa::BSAFile::mapIntoMemory()
+{
+    if (mMappedFile != nullptr)
+        return;
+
+    try
+    {
+        mMappedFile = std::make_shared<const Platform::File::MappedFile>(mFilepath);
+    }
+    catch (const std::exception& e)
+    {
+        Log(Debug::Warning) << "Failed to map archive " << mFilepath << " into memory, falling back to file streams: "
+                            << e.what();
+    }
+}
+
+const char* Bsa::BSAFile::getMappedData(std::size_t offset, std::size_t size) const
+{
+    if (mMappedFile == nullptr || offset > mMappedFile->size() || size > mMappedFile->size() - offset)
+        return nullptr;
+    return mMappedFile->data() + offset;
+}
+
+Files::IStreamPtr Bsa::BSAFile::openRegion(std::size_t offset, std::size_t size) const
+{
+    if (getMappedData(offset, size) != nullptr)
+        return std::make_unique<MappedInputStream>(mMappedFile, offset, size);
+    return Files::openConstrainedFileStream(mFilepath, offset, size);
+}
+
 Files::IStreamPtr Bsa::BSAFile::getFile(const FileStruct* file)
 {
-    return Files::openConstrainedFileStream(mFilepath, file->offset, file->fileSize);
+    return openRegion(file->offset, file->fileSize);
 }
 
 void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
@@ -273,6 +328,9 @@ void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
     if (!mIsLoaded)
         fail("Unable to add file " + filename + " the archive is not opened");
 
+    if (mMappedFile != nullptr)
+        fail("Unable to add file " + filename + " the archive is mapped into memory");
+
     auto newStartOfDataBuffer = 12 + (12 + 8) * (mFiles.size() + 1) + mStringBuf.size() + filename.size() + 1;
     if (mFiles.empty())
         std::filesystem::resize_file(mFilepath, newStartOfDataBuffer);
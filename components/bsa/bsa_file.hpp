@@ -26,12 +26,18 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <components/files/conversion.hpp>
 #include <components/files/istreamptr.hpp>
 
+namespace Platform::File
+{
+    class MappedFile;
+}
+
 namespace Bsa
 {
 
@@ -96,6 +102,9 @@ namespace Bsa
         /// Used for error messages
         std::filesystem::path mFilepath;
 
+        /// Whole archive content when it's mapped into memory
+        std::shared_ptr<const Platform::File::MappedFile> mMappedFile;
+
         /// Error handling
         [[noreturn]] void fail(const std::string& msg) const;
 
@@ -103,6 +112,12 @@ namespace Bsa
         virtual void readHeader();
         virtual void writeHeader();
 
+        /// Returns pointer to the archive region if it's mapped into memory or nullptr otherwise
+        const char* getMappedData(std::size_t offset, std::size_t size) const;
+
+        /// Open stream over the archive region. Doesn't copy the data if the archive is mapped into memory.
+        Files::IStreamPtr openRegion(std::size_t offset, std::size_t size) const;
+
     public:
         /* -----------------------------------
          * BSA management methods
@@ -122,8 +137,17 @@ namespace Bsa
         /// Open an archive file.
         void open(const std::filesystem::path& file);
 
+        /// Open an existing archive file using previously read file table instead of reading the header.
+        /// @param names Filename string buffer referenced by FileStruct::namesOffset.
+        void open(const std::filesystem::path& file, FileList files, std::vector<char> names);
+
         void close();
 
+        /// Map the whole archive into memory. Files are served from the mapped memory without opening a file stream
+        /// per each one. If mapping fails files are read through file streams.
+        /// @note The archive can't be modified after that.
+        void mapIntoMemory();
+
         /* -----------------------------------
          * Archive file routines
          * -----------------------------------
@@ -143,6 +167,13 @@ namespace Bsa
             return mFiles;
         }
 
+        /// Get filename string buffer referenced by FileStruct::namesOffset
+        /// @note Thread safe.
+        const std::vector<char>& getNames() const
+        {
+            return mStringBuf;
+        }
+
         std::string getFilename() const
         {
             return Files::pathToUnicodeString(mFilepath);
@@ -271,7 +271,8 @@ namespace Bsa
     {
         size_t size = fileRecord.mSize & (~FileSizeFlag_Compression);
         size_t resultSize = size;
-        Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, fileRecord.mOffset, size);
+        size_t dataOffset = fileRecord.mOffset;
+        Files::IStreamPtr streamPtr = openRegion(fileRecord.mOffset, size);
         bool compressed = (fileRecord.mSize != size) == ((mHeader.mFlags & ArchiveFlag_Compress) == 0);
         if ((mHeader.mFlags & ArchiveFlag_EmbeddedNames) != 0)
         {
@@ -280,11 +281,17 @@ namespace Bsa
             streamPtr->read(reinterpret_cast<char*>(&length), 1);
             streamPtr->ignore(length);
             size -= length + sizeof(uint8_t);
+            dataOffset += length + sizeof(uint8_t);
         }
         if (compressed)
         {
             streamPtr->read(reinterpret_cast<char*>(&resultSize), sizeof(uint32_t));
             size -= sizeof(uint32_t);
+            dataOffset += sizeof(uint32_t);
+        }
+        else if (getMappedData(dataOffset, size) != nullptr)
+        {
+            return openRegion(dataOffset, size);
         }
         auto memoryStreamPtr = std::make_unique<MemoryInputStream>(resultSize);
 
@@ -301,13 +308,20 @@ namespace Bsa
             }
             else
             {
-                auto buffer = std::vector<char>(size);
-                streamPtr->read(buffer.data(), size);
+                // Decompress straight from the mapped memory when possible
+                const char* input = getMappedData(dataOffset, size);
+                std::vector<char> buffer;
+                if (input == nullptr)
+                {
+                    buffer.resize(size);
+                    streamPtr->read(buffer.data(), size);
+                    input = buffer.data();
+                }
                 LZ4F_decompressionContext_t context = nullptr;
                 LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
                 LZ4F_decompressOptions_t options = {};
-                LZ4F_errorCode_t errorCode = LZ4F_decompress(
-                    context, memoryStreamPtr->getRawData(), &resultSize, buffer.data(), &size, &options);
+                LZ4F_errorCode_t errorCode
+                    = LZ4F_decompress(context, memoryStreamPtr->getRawData(), &resultSize, input, &size, &options);
                 if (LZ4F_isError(errorCode))
                     fail("LZ4 decompression error (file " + Files::pathToUnicodeString(mFilepath)
                         + "): " + LZ4F_getErrorName(errorCode));
@@ -117,6 +117,7 @@ namespace Bsa
     public:
         using BSAFile::getFilename;
         using BSAFile::getList;
+        using BSAFile::mapIntoMemory;
         using BSAFile::open;
 
         CompressedBSAFile() = default;
@@ -27,7 +27,11 @@
 #define BSA_MEMORY_STREAM_H
 
 #include <components/files/memorystream.hpp>
+#include <components/platform/file.hpp>
+
+#include <cstddef>
 #include <istream>
+#include <memory>
 #include <vector>
 
 namespace Bsa
@@ -53,5 +57,25 @@ namespace Bsa
         char* getRawData() { return this->data(); }
     };
 
+    /**
+        Allows to pass a region of memory mapped archive as Files::IStreamPtr without copying.
+
+        Mapping is kept alive until the stream is destroyed.
+     */
+    class MappedInputStream final : public Files::IMemStream
+    {
+    public:
+        explicit MappedInputStream(
+            std::shared_ptr<const Platform::File::MappedFile> file, std::size_t offset, std::size_t size)
+            : Files::MemBuf(file->data() + offset, size)
+            , Files::IMemStream(file->data() + offset, size)
+            , mFile(std::move(file))
+        {
+        }
+
+    private:
+        std::shared_ptr<const Platform::File::MappedFile> mFile;
+    };
+
 }
 #endif
@@ -1,8 +1,11 @@
 #include "extensions.hpp"
 
+#include <array>
 #include <cassert>
 #include <stdexcept>
 
+#include <extern/smhasher/MurmurHash3.h>
+
 #include "generator.hpp"
 #include "literals.hpp"
 
@@ -204,4 +207,44 @@ namespace Compiler
         for (const auto& mKeyword : mKeywords)
             keywords.push_back(mKeyword.first);
     }
+
+    std::uint64_t Extensions::getDigest() const
+    {
+        std::string data;
+        const auto add = [&](int value) { data.append(reinterpret_cast<const char*>(&value), sizeof(value)); };
+        const auto addString = [&](const std::string& value) {
+            add(static_cast<int>(value.size()));
+            data += value;
+        };
+
+        for (const auto& [keyword, index] : mKeywords)
+        {
+            addString(keyword);
+            add(index);
+        }
+
+        for (const auto& [keyword, function] : mFunctions)
+        {
+            add(keyword);
+            data += function.mReturn;
+            addString(function.mArguments);
+            add(function.mCode);
+            add(function.mCodeExplicit);
+            add(function.mSegment);
+        }
+
+        for (const auto& [keyword, instruction] : mInstructions)
+        {
+            add(keyword);
+            addString(instruction.mArguments);
+            add(instruction.mCode);
+            add(instruction.mCodeExplicit);
+            add(instruction.mSegment);
+        }
+
+        const std::array<std::uint64_t, 2> seed{ 0, 0 };
+        std::array<std::uint64_t, 2> result{ 0, 0 };
+        MurmurHash3_x64_128(data.data(), static_cast<int>(data.size()), seed.data(), result.data());
+        return result[0];
+    }
 }
@@ -0,0 +1,136 @@
+#include "asyncpathfinder.hpp"
+#include "navigator.hpp"
+#include "navigatorutils.hpp"
+
+#include <components/debug/debuglog.hpp>
+
+#include <iterator>
+
+namespace DetourNavigator
+{
+    AsyncPathFinder::AsyncPathFinder(const Navigator& navigator, std::size_t threadsNumber)
+        : mNavigator(navigator)
+    {
+        for (std::size_t i = 0; i < threadsNumber; ++i)
+            mThreads.emplace_back([&] { run(); });
+    }
+
+    AsyncPathFinder::~AsyncPathFinder()
+    {
+        stop();
+    }
+
+    std::shared_ptr<const PendingPath> AsyncPathFinder::enqueue(const PathQuery& query)
+    {
+        auto pendingPath = std::make_shared<PendingPath>(query);
+        pendingPath->mNavMesh = mNavigator.getNavMesh(query.mAgentBounds);
+        if (pendingPath->mNavMesh == nullptr)
+        {
+            cancel(*pendingPath);
+            return pendingPath;
+        }
+        const std::lock_guard lock(mBatchMutex);
+        mBatch.push_back(pendingPath);
+        return pendingPath;
+    }
+
+    void AsyncPathFinder::submit()
+    {
+        const std::lock_guard batchLock(mBatchMutex);
+        if (mBatch.empty())
+            return;
+        if (mThreads.empty())
+        {
+            for (const std::weak_ptr<PendingPath>& weak : mBatch)
+                if (const std::shared_ptr<PendingPath> pendingPath = weak.lock())
+                    process(*pendingPath);
+            mBatch.clear();
+            return;
+        }
+        const std::lock_guard lock(mMutex);
+        mQueries.insert(mQueries.end(), mBatch.begin(), mBatch.end());
+        mBatch.clear();
+        mHasQuery.notify_all();
+    }
+
+    void AsyncPathFinder::wait()
+    {
+        std::unique_lock lock(mMutex);
+        mDone.wait(lock, [&] { return mQueries.empty() && mProcessing == 0; });
+    }
+
+    void AsyncPathFinder::stop()
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            mShouldStop = true;
+            mHasQuery.notify_all();
+        }
+        for (std::thread& thread : mThreads)
+            if (thread.joinable())
+                thread.join();
+        // Navmesh must not outlive navigator through not processed queries
+        const std::lock_guard batchLock(mBatchMutex);
+        const std::lock_guard lock(mMutex);
+        mQueries.insert(mQueries.end(), mBatch.begin(), mBatch.end());
+        mBatch.clear();
+        for (const std::weak_ptr<PendingPath>& weak : mQueries)
+            if (const std::shared_ptr<PendingPath> pendingPath = weak.lock())
+                cancel(*pendingPath);
+        mQueries.clear();
+        mDone.notify_all();
+    }
+
+    void AsyncPathFinder::run() noexcept
+    {
+        Log(Debug::Debug) << "Start process path queries by thread=" << std::this_thread::get_id();
+        std::unique_lock lock(mMutex);
+        while (true)
+        {
+            mHasQuery.wait(lock, [&] { return mShouldStop || !mQueries.empty(); });
+            if (mShouldStop)
+                break;
+            std::shared_ptr<PendingPath> pendingPath = mQueries.front().lock();
+            mQueries.pop_front();
+            if (pendingPath != nullptr)
+            {
+                ++mProcessing;
+                lock.unlock();
+                process(*pendingPath);
+                pendingPath = nullptr;
+                lock.lock();
+                --mProcessing;
+            }
+            if (mQueries.empty() && mProcessing == 0)
+                mDone.notify_all();
+        }
+        Log(Debug::Debug) << "Stop process path queries by thread=" << std::this_thread::get_id();
+    }
+
+    void AsyncPathFinder::process(PendingPath& pendingPath) const
+    {
+        const PathQuery& query = pendingPath.mQuery;
+        PathQueryResult& result = pendingPath.mResult;
+        try
+        {
+            result.mStatus = findPath(*pendingPath.mNavMesh, mNavigator.getSettings(), query.mAgentBounds,
+                query.mStart, query.mEnd, query.mIncludeFlags, query.mAreaCosts, query.mEndTolerance,
+                std::back_inserter(result.mPath));
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "AsyncPathFinder::process exception: " << e.what();
+            result.mStatus = Status::FindPathOverPolygonsFailed;
+            result.mPath.clear();
+        }
+        pendingPath.mNavMesh = nullptr;
+        pendingPath.mReady.store(true, std::memory_order_release);
+    }
+
+    void AsyncPathFinder::cancel(PendingPath& pendingPath)
+    {
+        pendingPath.mResult.mStatus = Status::NavMeshNotFound;
+        pendingPath.mNavMesh = nullptr;
+        pendingPath.mReady.store(true, std::memory_order_release);
+    }
+}
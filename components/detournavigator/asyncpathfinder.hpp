@@ -0,0 +1,115 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+
+#include "agentbounds.hpp"
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "sharednavmeshcacheitem.hpp"
+#include "status.hpp"
+
+#include <osg/Vec3f>
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DetourNavigator
+{
+    class Navigator;
+
+    struct PathQuery
+    {
+        AgentBounds mAgentBounds;
+        osg::Vec3f mStart;
+        osg::Vec3f mEnd;
+        Flags mIncludeFlags = Flag_none;
+        AreaCosts mAreaCosts;
+        float mEndTolerance = 0;
+    };
+
+    struct PathQueryResult
+    {
+        Status mStatus = Status::Success;
+        std::vector<osg::Vec3f> mPath;
+    };
+
+    /// Path query shared by the requester and AsyncPathFinder. When the requester drops it before a worker thread
+    /// takes it the query is skipped.
+    class PendingPath
+    {
+    public:
+        explicit PendingPath(const PathQuery& query)
+            : mQuery(query)
+        {
+        }
+
+        const PathQuery& getQuery() const { return mQuery; }
+
+        bool isReady() const { return mReady.load(std::memory_order_acquire); }
+
+        const PathQueryResult& getResult() const
+        {
+            assert(isReady());
+            return mResult;
+        }
+
+    private:
+        const PathQuery mQuery;
+        SharedNavMeshCacheItem mNavMesh;
+        PathQueryResult mResult;
+        std::atomic_bool mReady{ false };
+
+        friend class AsyncPathFinder;
+    };
+
+    /// Finds paths over navmesh on the worker threads. Queries are collected into a batch by enqueue and handed to
+    /// the workers at once by submit so the results are usually ready by the next frame.
+    class AsyncPathFinder
+    {
+    public:
+        /// With zero threads submitted queries are processed by the calling thread.
+        explicit AsyncPathFinder(const Navigator& navigator, std::size_t threadsNumber);
+
+        ~AsyncPathFinder();
+
+        /// Adds the query to the batch. Navmesh for the agent is taken here so the call must not be done while
+        /// navigator is updated.
+        std::shared_ptr<const PendingPath> enqueue(const PathQuery& query);
+
+        /// Passes all queries enqueued since the last call to the worker threads.
+        void submit();
+
+        /// Blocks until all submitted queries are processed.
+        void wait();
+
+        void stop();
+
+        std::size_t getThreadsNumber() const { return mThreads.size(); }
+
+    private:
+        const Navigator& mNavigator;
+        std::mutex mBatchMutex;
+        std::vector<std::weak_ptr<PendingPath>> mBatch;
+        std::mutex mMutex;
+        std::condition_variable mHasQuery;
+        std::condition_variable mDone;
+        std::deque<std::weak_ptr<PendingPath>> mQueries;
+        std::size_t mProcessing = 0;
+        bool mShouldStop = false;
+        std::vector<std::thread> mThreads;
+
+        void run() noexcept;
+
+        void process(PendingPath& pendingPath) const;
+
+        static void cancel(PendingPath& pendingPath);
+    };
+}
+
+#endif
@@ -78,32 +78,42 @@ namespace DetourNavigator
         return static_cast<std::size_t>(pathLen);
     }
 
+    /// Memory reused between path queries to avoid allocations for each of them
+    struct FindSmoothPathBuffers
+    {
+        std::vector<dtPolyRef> mPolygonPath;
+        std::vector<float> mCornerVerts;
+        std::vector<unsigned char> mCornerFlags;
+        std::vector<dtPolyRef> mCornerPolys;
+    };
+
     Status makeSmoothPath(const dtNavMeshQuery& navMeshQuery, const osg::Vec3f& start, const osg::Vec3f& end,
         std::span<dtPolyRef> polygonPath, std::size_t polygonPathSize, std::size_t maxSmoothPathSize,
-        std::output_iterator<osg::Vec3f> auto& out)
+        FindSmoothPathBuffers& buffers, std::output_iterator<osg::Vec3f> auto& out)
     {
         assert(polygonPathSize <= polygonPath.size());
 
-        std::vector<float> cornerVertsBuffer(maxSmoothPathSize * 3);
-        std::vector<unsigned char> cornerFlagsBuffer(maxSmoothPathSize);
-        std::vector<dtPolyRef> cornerPolysBuffer(maxSmoothPathSize);
+        buffers.mCornerVerts.resize(maxSmoothPathSize * 3);
+        buffers.mCornerFlags.resize(maxSmoothPathSize);
+        buffers.mCornerPolys.resize(maxSmoothPathSize);
         int cornersCount = 0;
         constexpr int findStraightPathOptions = DT_STRAIGHTPATH_AREA_CROSSINGS | DT_STRAIGHTPATH_ALL_CROSSINGS;
         if (const dtStatus status = navMeshQuery.findStraightPath(start.ptr(), end.ptr(), polygonPath.data(),
-                static_cast<int>(polygonPathSize), cornerVertsBuffer.data(), cornerFlagsBuffer.data(),
-                cornerPolysBuffer.data(), &cornersCount, static_cast<int>(maxSmoothPathSize), findStraightPathOptions);
+                static_cast<int>(polygonPathSize), buffers.mCornerVerts.data(), buffers.mCornerFlags.data(),
+                buffers.mCornerPolys.data(), &cornersCount, static_cast<int>(maxSmoothPathSize),
+                findStraightPathOptions);
             dtStatusFailed(status))
             return Status::FindStraightPathFailed;
 
         for (int i = 0; i < cornersCount; ++i)
-            *out++ = Misc::Convert::makeOsgVec3f(&cornerVertsBuffer[static_cast<std::size_t>(i) * 3]);
+            *out++ = Misc::Convert::makeOsgVec3f(&buffers.mCornerVerts[static_cast<std::size_t>(i) * 3]);
 
         return Status::Success;
     }
 
     Status findSmoothPath(const dtNavMeshQuery& navMeshQuery, const osg::Vec3f& halfExtents, const osg::Vec3f& start,
         const osg::Vec3f& end, const Flags includeFlags, const AreaCosts& areaCosts, const DetourSettings& settings,
-        float endTolerance, std::output_iterator<osg::Vec3f> auto out)
+        float endTolerance, FindSmoothPathBuffers& buffers, std::output_iterator<osg::Vec3f> auto out)
     {
         dtQueryFilter queryFilter;
         queryFilter.setIncludeFlags(includeFlags);
@@ -130,7 +140,8 @@ namespace DetourNavigator
             dtStatusFailed(status) || endRef == 0)
             return Status::EndPolygonNotFound;
 
-        std::vector<dtPolyRef> polygonPath(settings.mMaxPolygonPathSize);
+        std::vector<dtPolyRef>& polygonPath = buffers.mPolygonPath;
+        polygonPath.resize(settings.mMaxPolygonPathSize);
         const auto polygonPathSize
             = findPolygonPath(navMeshQuery, startRef, endRef, startNavMeshPos, endNavMeshPos, queryFilter, polygonPath);
 
@@ -148,7 +159,7 @@ namespace DetourNavigator
 
         const bool partialPath = polygonPath[*polygonPathSize - 1] != endRef;
         const Status smoothStatus = makeSmoothPath(navMeshQuery, startNavMeshPos, targetNavMeshPos, polygonPath,
-            *polygonPathSize, settings.mMaxSmoothPathSize, out);
+            *polygonPathSize, settings.mMaxSmoothPathSize, buffers, out);
 
         if (smoothStatus != Status::Success)
             return smoothStatus;
@@ -44,6 +44,7 @@ namespace DetourNavigator
         , mSettings(settings)
         , mConsumer(std::move(consumer))
     {
+        setCategory(SceneUtil::WorkCategory::NavMesh);
     }
 
     void GenerateNavMeshTile::doWork()
@@ -4,14 +4,14 @@
 namespace Misc
 {
     template <class T>
-    class ScopeGuarded;
+    class SharedGuarded;
 }
 
 namespace DetourNavigator
 {
     class NavMeshCacheItem;
 
-    using GuardedNavMeshCacheItem = Misc::ScopeGuarded<NavMeshCacheItem>;
+    using GuardedNavMeshCacheItem = Misc::SharedGuarded<NavMeshCacheItem>;
 }
 
 #endif
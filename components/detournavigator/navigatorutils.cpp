@@ -8,6 +8,12 @@
 
 namespace DetourNavigator
 {
+    PathQueryContext& getThreadPathQueryContext()
+    {
+        thread_local PathQueryContext context;
+        return context;
+    }
+
     std::optional<osg::Vec3f> findRandomPointAroundCircle(const Navigator& navigator, const AgentBounds& agentBounds,
         const osg::Vec3f& start, const float maxRadius, const Flags includeFlags, float (*prng)())
     {
@@ -52,7 +58,7 @@ namespace DetourNavigator
         const osg::Vec3f navMeshPosition = toNavMeshCoordinates(settings.mRecast, position);
         const auto lockedNavMesh = navMesh->lockConst();
 
-        dtNavMeshQuery navMeshQuery;
+        dtNavMeshQuery& navMeshQuery = getThreadPathQueryContext().mQuery;
         if (const dtStatus status
             = navMeshQuery.init(&lockedNavMesh->getImpl(), settings.mDetour.mMaxNavMeshQueryNodes);
             dtStatusFailed(status))
@@ -14,6 +14,41 @@
 
 namespace DetourNavigator
 {
+    /// Navmesh query with buffers owned by a thread to find paths without allocations holding navmesh shared lock
+    struct PathQueryContext
+    {
+        dtNavMeshQuery mQuery;
+        FindSmoothPathBuffers mBuffers;
+    };
+
+    PathQueryContext& getThreadPathQueryContext();
+
+    /**
+     * @brief findPath fills output iterator with points of scene surfaces to be used for actor to walk through.
+     * @param navMesh to find path over.
+     * @param start path from given point.
+     * @param end path at given point.
+     * @param includeFlags setup allowed navmesh areas.
+     * @param out the beginning of the destination range.
+     * @param endTolerance defines maximum allowed distance to end path point in addition to agentHalfExtents
+     * @return Status.
+     * Equal to out if no path is found.
+     */
+    inline Status findPath(const GuardedNavMeshCacheItem& navMesh, const Settings& settings,
+        const AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags,
+        const AreaCosts& areaCosts, float endTolerance, std::output_iterator<osg::Vec3f> auto out)
+    {
+        FromNavMeshCoordinatesIterator outTransform(out, settings.mRecast);
+        PathQueryContext& context = getThreadPathQueryContext();
+        const auto locked = navMesh.lockConst();
+        if (const dtStatus status = context.mQuery.init(&locked->getImpl(), settings.mDetour.mMaxNavMeshQueryNodes);
+            dtStatusFailed(status))
+            return Status::InitNavMeshQueryFailed;
+        return findSmoothPath(context.mQuery, toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
+            toNavMeshCoordinates(settings.mRecast, start), toNavMeshCoordinates(settings.mRecast, end), includeFlags,
+            areaCosts, settings.mDetour, endTolerance, context.mBuffers, outTransform);
+    }
+
     /**
      * @brief findPath fills output iterator with points of scene surfaces to be used for actor to walk through.
      * @param agentBounds defines which navmesh to use.
@@ -32,12 +67,8 @@ namespace DetourNavigator
         const auto navMesh = navigator.getNavMesh(agentBounds);
         if (navMesh == nullptr)
             return Status::NavMeshNotFound;
-        const Settings& settings = navigator.getSettings();
-        FromNavMeshCoordinatesIterator outTransform(out, settings.mRecast);
-        const auto locked = navMesh->lock();
-        return findSmoothPath(locked->getQuery(), toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
-            toNavMeshCoordinates(settings.mRecast, start), toNavMeshCoordinates(settings.mRecast, end), includeFlags,
-            areaCosts, settings.mDetour, endTolerance, outTransform);
+        return findPath(*navMesh, navigator.getSettings(), agentBounds, start, end, includeFlags, areaCosts,
+            endTolerance, out);
     }
 
     /**
@@ -1,10 +1,130 @@
 #include "navmeshtilescache.hpp"
 #include "stats.hpp"
 
+#include <extern/smhasher/MurmurHash3.h>
+
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <type_traits>
 
 namespace DetourNavigator
 {
+    namespace
+    {
+        class Digest
+        {
+        public:
+            void add(const void* data, std::size_t size)
+            {
+                std::array<std::uint64_t, 2> result{ 0, 0 };
+                MurmurHash3_x64_128(data, static_cast<int>(size), mValue.data(), result.data());
+                mValue = result;
+            }
+
+            template <class T>
+            void add(const T& value)
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    const T normalized = normalize(value);
+                    add(&normalized, sizeof(normalized));
+                }
+                else
+                {
+                    static_assert(std::has_unique_object_representations_v<T>);
+                    add(&value, sizeof(value));
+                }
+            }
+
+            template <class T>
+            void add(const std::vector<T>& values)
+            {
+                add(values.size());
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    std::array<T, 256> buffer;
+                    for (std::size_t i = 0; i < values.size(); i += buffer.size())
+                    {
+                        const std::size_t count = std::min(buffer.size(), values.size() - i);
+                        std::transform(values.begin() + i, values.begin() + i + count, buffer.begin(), normalize<T>);
+                        add(buffer.data(), count * sizeof(T));
+                    }
+                }
+                else
+                {
+                    static_assert(std::has_unique_object_representations_v<T>);
+                    add(values.data(), values.size() * sizeof(T));
+                }
+            }
+
+            void add(const osg::Vec2i& value)
+            {
+                add(value.x());
+                add(value.y());
+            }
+
+            void add(const osg::Vec3f& value)
+            {
+                add(value.x());
+                add(value.y());
+                add(value.z());
+            }
+
+            std::uint64_t getValue() const { return mValue[0]; }
+
+        private:
+            std::array<std::uint64_t, 2> mValue{ 0, 0 };
+
+            // Keys are compared by value and -0 is equal to +0 but has a different representation
+            template <class T>
+            static T normalize(T value)
+            {
+                return value == 0 ? T(0) : value;
+            }
+        };
+    }
+
+    std::uint64_t getDigest(
+        const AgentBounds& agentBounds, const TilePosition& changedTile, const RecastMesh& recastMesh)
+    {
+        Digest digest;
+        digest.add(agentBounds.mShapeType);
+        digest.add(agentBounds.mHalfExtents);
+        digest.add(changedTile);
+        digest.add(recastMesh.getMesh().getIndices());
+        digest.add(recastMesh.getMesh().getVertices());
+        digest.add(recastMesh.getMesh().getAreaTypes());
+        digest.add(recastMesh.getWater().size());
+        for (const CellWater& water : recastMesh.getWater())
+        {
+            digest.add(water.mCellPosition);
+            digest.add(water.mWater.mCellSize);
+            digest.add(water.mWater.mLevel);
+        }
+        digest.add(recastMesh.getHeightfields().size());
+        for (const Heightfield& heightfield : recastMesh.getHeightfields())
+        {
+            digest.add(heightfield.mCellPosition);
+            digest.add(heightfield.mCellSize);
+            digest.add(heightfield.mLength);
+            digest.add(heightfield.mMinHeight);
+            digest.add(heightfield.mMaxHeight);
+            digest.add(heightfield.mHeights);
+            digest.add(heightfield.mOriginalSize);
+            digest.add(heightfield.mMinX);
+            digest.add(heightfield.mMinY);
+        }
+        digest.add(recastMesh.getFlatHeightfields().size());
+        for (const FlatHeightfield& heightfield : recastMesh.getFlatHeightfields())
+        {
+            digest.add(heightfield.mCellPosition);
+            digest.add(heightfield.mCellSize);
+            digest.add(heightfield.mHeight);
+        }
+        return digest.getValue();
+    }
+
     NavMeshTilesCache::NavMeshTilesCache(const std::size_t maxNavMeshDataSize)
         : mMaxNavMeshDataSize(maxNavMeshDataSize)
         , mUsedNavMeshDataSize(0)
@@ -17,19 +137,42 @@ namespace DetourNavigator
     NavMeshTilesCache::Value NavMeshTilesCache::get(
         const AgentBounds& agentBounds, const TilePosition& changedTile, const RecastMesh& recastMesh)
     {
-        const std::lock_guard<std::mutex> lock(mMutex);
+        const std::uint64_t digest = getDigest(agentBounds, changedTile, recastMesh);
 
-        ++mGetCount;
+        mGetCount.fetch_add(1, std::memory_order_relaxed);
 
-        const auto tile = mValues.find(std::tie(agentBounds, changedTile, recastMesh));
-        if (tile == mValues.end())
-            return Value();
+        ItemIterator iterator;
+
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+
+            const std::optional<ItemIterator> found = findUnsafe(digest, agentBounds, changedTile, nullptr);
+            if (!found.has_value())
+                return Value();
+
+            iterator = *found;
+            acquireItemUnsafe(iterator);
+        }
 
-        acquireItemUnsafe(tile->second);
+        // Acquired item can't be removed so compare the content without holding the lock
+        if (!(iterator->mRecastMeshData == recastMesh))
+        {
+            // Digest collision, search again comparing the content
+            releaseItem(iterator);
+
+            const std::lock_guard<std::mutex> lock(mMutex);
+
+            const std::optional<ItemIterator> found = findUnsafe(digest, agentBounds, changedTile, &recastMesh);
+            if (!found.has_value())
+                return Value();
 
-        ++mHitCount;
+            iterator = *found;
+            acquireItemUnsafe(iterator);
+        }
+
+        mHitCount.fetch_add(1, std::memory_order_relaxed);
 
-        return Value(*this, tile->second);
+        return Value(*this, iterator);
     }
 
     NavMeshTilesCache::Value NavMeshTilesCache::set(const AgentBounds& agentBounds, const TilePosition& changedTile,
@@ -38,29 +181,30 @@ namespace DetourNavigator
         const auto itemSize = sizeof(RecastMesh) + getSize(recastMesh)
             + (value == nullptr ? 0 : sizeof(PreparedNavMeshData) + getSize(*value));
 
+        const std::uint64_t digest = getDigest(agentBounds, changedTile, recastMesh);
+
+        RecastMeshData key{ recastMesh.getMesh(), recastMesh.getWater(), recastMesh.getHeightfields(),
+            recastMesh.getFlatHeightfields() };
+
         const std::lock_guard<std::mutex> lock(mMutex);
 
         if (itemSize > mFreeNavMeshDataSize + (mMaxNavMeshDataSize - mUsedNavMeshDataSize))
             return Value();
 
+        if (const std::optional<ItemIterator> found = findUnsafe(digest, agentBounds, changedTile, &recastMesh))
+        {
+            acquireItemUnsafe(*found);
+            mGetCount.fetch_add(1, std::memory_order_relaxed);
+            mHitCount.fetch_add(1, std::memory_order_relaxed);
+            return Value(*this, *found);
+        }
+
         while (!mFreeItems.empty() && mUsedNavMeshDataSize + itemSize > mMaxNavMeshDataSize)
             removeLeastRecentlyUsed();
 
-        RecastMeshData key{ recastMesh.getMesh(), recastMesh.getWater(), recastMesh.getHeightfields(),
-            recastMesh.getFlatHeightfields() };
-
-        const auto iterator = mFreeItems.emplace(mFreeItems.end(), agentBounds, changedTile, std::move(key), itemSize);
-        const auto emplaced = mValues.emplace(
-            std::make_tuple(agentBounds, changedTile, std::cref(iterator->mRecastMeshData)), iterator);
-
-        if (!emplaced.second)
-        {
-            mFreeItems.erase(iterator);
-            acquireItemUnsafe(emplaced.first->second);
-            ++mGetCount;
-            ++mHitCount;
-            return Value(*this, emplaced.first->second);
-        }
+        const auto iterator
+            = mFreeItems.emplace(mFreeItems.end(), digest, agentBounds, changedTile, std::move(key), itemSize);
+        mValues.emplace(digest, iterator);
 
         iterator->mPreparedNavMeshData = std::move(value);
         ++iterator->mUseCount;
@@ -78,9 +222,9 @@ namespace DetourNavigator
             result.mNavMeshCacheSize = mUsedNavMeshDataSize;
             result.mUsedNavMeshTiles = mBusyItems.size();
             result.mCachedNavMeshTiles = mFreeItems.size();
-            result.mHitCount = mHitCount;
-            result.mGetCount = mGetCount;
         }
+        result.mHitCount = mHitCount.load(std::memory_order_relaxed);
+        result.mGetCount = mGetCount.load(std::memory_order_relaxed);
         return result;
     }
 
@@ -88,8 +232,9 @@ namespace DetourNavigator
     {
         const auto& item = mFreeItems.back();
 
-        const auto value = mValues.find(std::tie(item.mAgentBounds, item.mChangedTile, item.mRecastMeshData));
-        if (value == mValues.end())
+        const auto [begin, end] = mValues.equal_range(item.mDigest);
+        const auto value = std::find_if(begin, end, [&](const auto& v) { return &*v.second == &item; });
+        if (value == end)
             return;
 
         mUsedNavMeshDataSize -= item.mSize;
@@ -99,6 +244,20 @@ namespace DetourNavigator
         mFreeItems.pop_back();
     }
 
+    std::optional<NavMeshTilesCache::ItemIterator> NavMeshTilesCache::findUnsafe(std::uint64_t digest,
+        const AgentBounds& agentBounds, const TilePosition& changedTile, const RecastMesh* recastMesh) const
+    {
+        const auto [begin, end] = mValues.equal_range(digest);
+        for (auto it = begin; it != end; ++it)
+        {
+            const Item& item = *it->second;
+            if (item.mAgentBounds == agentBounds && item.mChangedTile == changedTile
+                && (recastMesh == nullptr || item.mRecastMeshData == *recastMesh))
+                return it->second;
+        }
+        return std::nullopt;
+    }
+
     void NavMeshTilesCache::acquireItemUnsafe(ItemIterator iterator)
     {
         if (++iterator->mUseCount > 1)
@@ -110,11 +269,17 @@ namespace DetourNavigator
 
     void NavMeshTilesCache::releaseItem(ItemIterator iterator)
     {
-        if (--iterator->mUseCount > 0)
-            return;
+        // Last reference is released only under the lock to not race with acquireItemUnsafe
+        std::int64_t useCount = iterator->mUseCount.load(std::memory_order_relaxed);
+        while (useCount > 1)
+            if (iterator->mUseCount.compare_exchange_weak(useCount, useCount - 1, std::memory_order_acq_rel))
+                return;
 
         const std::lock_guard<std::mutex> lock(mMutex);
 
+        if (--iterator->mUseCount > 0)
+            return;
+
         mFreeItems.splice(mFreeItems.begin(), mBusyItems, iterator);
         mFreeNavMeshDataSize += iterator->mSize;
     }
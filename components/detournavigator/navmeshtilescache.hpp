@@ -10,8 +10,9 @@
 #include <cassert>
 #include <cstring>
 #include <list>
-#include <map>
 #include <mutex>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
 namespace DetourNavigator
@@ -24,23 +25,15 @@ namespace DetourNavigator
         std::vector<FlatHeightfield> mFlatHeightfields;
     };
 
-    inline bool operator<(const RecastMeshData& lhs, const RecastMeshData& rhs)
+    inline bool operator==(const RecastMeshData& lhs, const RecastMesh& rhs)
     {
         return std::tie(lhs.mMesh, lhs.mWater, lhs.mHeightfields, lhs.mFlatHeightfields)
-            < std::tie(rhs.mMesh, rhs.mWater, rhs.mHeightfields, rhs.mFlatHeightfields);
+            == std::tie(rhs.getMesh(), rhs.getWater(), rhs.getHeightfields(), rhs.getFlatHeightfields());
     }
 
-    inline bool operator<(const RecastMeshData& lhs, const RecastMesh& rhs)
-    {
-        return std::tie(lhs.mMesh, lhs.mWater, lhs.mHeightfields, lhs.mFlatHeightfields)
-            < std::tie(rhs.getMesh(), rhs.getWater(), rhs.getHeightfields(), rhs.getFlatHeightfields());
-    }
-
-    inline bool operator<(const RecastMesh& lhs, const RecastMeshData& rhs)
-    {
-        return std::tie(lhs.getMesh(), lhs.getWater(), lhs.getHeightfields(), lhs.getFlatHeightfields())
-            < std::tie(rhs.mMesh, rhs.mWater, rhs.mHeightfields, rhs.mFlatHeightfields);
-    }
+    /// Hash of the content of the cache key, equal keys always have equal digests
+    std::uint64_t getDigest(
+        const AgentBounds& agentBounds, const TilePosition& changedTile, const RecastMesh& recastMesh);
 
     struct NavMeshTilesCacheStats;
 
@@ -50,15 +43,17 @@ namespace DetourNavigator
         struct Item
         {
             std::atomic<std::int64_t> mUseCount;
+            std::uint64_t mDigest;
             AgentBounds mAgentBounds;
             TilePosition mChangedTile;
             RecastMeshData mRecastMeshData;
             std::unique_ptr<PreparedNavMeshData> mPreparedNavMeshData;
             std::size_t mSize;
 
-            Item(const AgentBounds& agentBounds, const TilePosition& changedTile, RecastMeshData&& recastMeshData,
-                std::size_t size)
+            Item(std::uint64_t digest, const AgentBounds& agentBounds, const TilePosition& changedTile,
+                RecastMeshData&& recastMeshData, std::size_t size)
                 : mUseCount(0)
+                , mDigest(digest)
                 , mAgentBounds(agentBounds)
                 , mChangedTile(changedTile)
                 , mRecastMeshData(std::move(recastMeshData))
@@ -137,16 +132,19 @@ namespace DetourNavigator
         std::size_t mMaxNavMeshDataSize;
         std::size_t mUsedNavMeshDataSize;
         std::size_t mFreeNavMeshDataSize;
-        std::size_t mHitCount;
-        std::size_t mGetCount;
+        std::atomic_size_t mHitCount;
+        std::atomic_size_t mGetCount;
         std::list<Item> mBusyItems;
         std::list<Item> mFreeItems;
-        std::map<std::tuple<AgentBounds, TilePosition, std::reference_wrapper<const RecastMeshData>>, ItemIterator,
-            std::less<>>
-            mValues;
+        // Items by digest of the key, digest collisions are resolved by comparing the content
+        std::unordered_multimap<std::uint64_t, ItemIterator> mValues;
 
         void removeLeastRecentlyUsed();
 
+        /// Content of recast mesh is compared only when it's not nullptr
+        std::optional<ItemIterator> findUnsafe(std::uint64_t digest, const AgentBounds& agentBounds,
+            const TilePosition& changedTile, const RecastMesh* recastMesh) const;
+
         void acquireItemUnsafe(ItemIterator iterator);
 
         void releaseItem(ItemIterator iterator);
@@ -35,6 +35,12 @@ namespace DetourNavigator
         std::vector<float> mVertices;
         std::vector<AreaType> mAreaTypes;
 
+        friend inline bool operator==(const Mesh& lhs, const Mesh& rhs) noexcept
+        {
+            return std::tie(lhs.mIndices, lhs.mVertices, lhs.mAreaTypes)
+                == std::tie(rhs.mIndices, rhs.mVertices, rhs.mAreaTypes);
+        }
+
         friend inline bool operator<(const Mesh& lhs, const Mesh& rhs) noexcept
         {
             return std::tie(lhs.mIndices, lhs.mVertices, lhs.mAreaTypes)
@@ -54,6 +60,12 @@ namespace DetourNavigator
         float mLevel;
     };
 
+    inline bool operator==(const Water& lhs, const Water& rhs) noexcept
+    {
+        const auto tie = [](const Water& v) { return std::tie(v.mCellSize, v.mLevel); };
+        return tie(lhs) == tie(rhs);
+    }
+
     inline bool operator<(const Water& lhs, const Water& rhs) noexcept
     {
         const auto tie = [](const Water& v) { return std::tie(v.mCellSize, v.mLevel); };
@@ -66,6 +78,12 @@ namespace DetourNavigator
         Water mWater;
     };
 
+    inline bool operator==(const CellWater& lhs, const CellWater& rhs) noexcept
+    {
+        const auto tie = [](const CellWater& v) { return std::tie(v.mCellPosition, v.mWater); };
+        return tie(lhs) == tie(rhs);
+    }
+
     inline bool operator<(const CellWater& lhs, const CellWater& rhs) noexcept
     {
         const auto tie = [](const CellWater& v) { return std::tie(v.mCellPosition, v.mWater); };
@@ -101,6 +119,11 @@ namespace DetourNavigator
             v.mOriginalSize, v.mMinX, v.mMinY);
     }
 
+    inline bool operator==(const Heightfield& lhs, const Heightfield& rhs) noexcept
+    {
+        return makeTuple(lhs) == makeTuple(rhs);
+    }
+
     inline bool operator<(const Heightfield& lhs, const Heightfield& rhs) noexcept
     {
         return makeTuple(lhs) < makeTuple(rhs);
@@ -113,6 +136,12 @@ namespace DetourNavigator
         float mHeight;
     };
 
+    inline bool operator==(const FlatHeightfield& lhs, const FlatHeightfield& rhs) noexcept
+    {
+        const auto tie = [](const FlatHeightfield& v) { return std::tie(v.mCellPosition, v.mCellSize, v.mHeight); };
+        return tie(lhs) == tie(rhs);
+    }
+
     inline bool operator<(const FlatHeightfield& lhs, const FlatHeightfield& rhs) noexcept
     {
         const auto tie = [](const FlatHeightfield& v) { return std::tie(v.mCellPosition, v.mCellSize, v.mHeight); };
@@ -1,6 +1,7 @@
 #include "esmreader.hpp"
 
 #include "readerscache.hpp"
+#include "savecompression.hpp"
 
 #include <components/esm3/cellid.hpp>
 #include <components/esm3/loadcell.hpp>
@@ -142,6 +143,18 @@ namespace ESM
         getRecHeader();
 
         mHeader.load(*this);
+
+        // Saved games may have everything after the header compressed
+        if (mHeader.mFormatVersion > MaxUncompressedSaveGameFormatVersion && !hasMoreSubs()
+            && isCompressedSaveGame(*mEsm))
+        {
+            const std::streamoff position = mEsm->tellg();
+            mEsm = openCompressedSaveGame(std::move(mEsm));
+            mEsm->seekg(0, mEsm->end);
+            mFileSize = mEsm->tellg();
+            mEsm->seekg(position);
+            mCtx.leftFile = mFileSize - position;
+        }
     }
 
     void ESMReader::open(const std::filesystem::path& file)
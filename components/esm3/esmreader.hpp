@@ -353,6 +353,8 @@ namespace ESM
         /// Sets font encoder for ESM strings
         void setEncoder(ToUTF8::Utf8Encoder* encoder) { mEncoder = encoder; }
 
+        ToUTF8::Utf8Encoder* getEncoder() const { return mEncoder; }
+
         /// Get record flags of last record
         uint32_t getRecordFlags() { return mRecordFlags; }
 
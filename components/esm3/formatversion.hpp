@@ -28,11 +28,12 @@ namespace ESM
     inline constexpr FormatVersion MaxOldCountFormatVersion = 30;
     inline constexpr FormatVersion MaxActiveSpellTypeVersion = 31;
     inline constexpr FormatVersion MaxPlayerBeforeCellDataFormatVersion = 32;
-    inline constexpr FormatVersion CurrentSaveGameFormatVersion = 34;
+    inline constexpr FormatVersion MaxUncompressedSaveGameFormatVersion = 34;
+    inline constexpr FormatVersion CurrentSaveGameFormatVersion = 35;
 
     inline constexpr FormatVersion MinSupportedSaveGameFormatVersion = 5;
     inline constexpr FormatVersion OpenMW0_48SaveGameFormatVersion = 21;
-    inline constexpr FormatVersion OpenMW0_49SaveGameFormatVersion = CurrentSaveGameFormatVersion;
+    inline constexpr FormatVersion OpenMW0_49SaveGameFormatVersion = 34;
 }
 
 #endif
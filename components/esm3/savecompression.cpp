@@ -0,0 +1,233 @@
+#include "savecompression.hpp"
+
+#include <components/files/streamwithbuffer.hpp>
+
+#include <lz4.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <streambuf>
+#include <vector>
+
+namespace ESM
+{
+    namespace
+    {
+        constexpr char compressedSaveGameMagic[] = { 'L', 'Z', '4', 'B' };
+        constexpr std::uint32_t compressedBlockSize = 256 * 1024;
+        // Limits the memory allocated for a block read from a damaged or malicious file
+        constexpr std::uint32_t maxCompressedBlockSize = 64 * 1024 * 1024;
+        // Record name, size and flags
+        constexpr std::size_t recordHeaderSize = 16;
+
+        template <class T>
+        void append(std::string& out, const T& value)
+        {
+            out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        template <class T>
+        void read(std::istream& stream, T& value)
+        {
+            stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+            if (!stream)
+                throw std::runtime_error("Failed to read compressed saved game header");
+        }
+
+        class CompressedSaveGameStreamBuf final : public std::streambuf
+        {
+        public:
+            explicit CompressedSaveGameStreamBuf(std::unique_ptr<std::istream>&& source)
+                : mSource(std::move(source))
+                , mOrigin(mSource->tellg())
+            {
+                char magic[std::size(compressedSaveGameMagic)];
+                read(*mSource, magic);
+                if (std::memcmp(magic, compressedSaveGameMagic, sizeof(magic)) != 0)
+                    throw std::runtime_error("Bad compressed saved game magic");
+                std::uint32_t blockCount = 0;
+                read(*mSource, mBlockSize);
+                read(*mSource, mSize);
+                read(*mSource, blockCount);
+                if (mBlockSize == 0 || mBlockSize > maxCompressedBlockSize
+                    || blockCount != (mSize + mBlockSize - 1) / mBlockSize)
+                    throw std::runtime_error("Invalid compressed saved game header");
+                const std::streamoff tableOffset = mSource->tellg();
+                mSource->seekg(0, std::ios_base::end);
+                const std::streamoff end = mSource->tellg();
+                mSource->seekg(tableOffset);
+                if (tableOffset < 0 || end < tableOffset
+                    || static_cast<std::uint64_t>(blockCount) * sizeof(std::uint32_t)
+                        > static_cast<std::uint64_t>(end - tableOffset))
+                    throw std::runtime_error("Compressed saved game is truncated");
+                std::vector<std::uint32_t> sizes(blockCount);
+                if (!sizes.empty())
+                    mSource->read(reinterpret_cast<char*>(sizes.data()), sizes.size() * sizeof(std::uint32_t));
+                if (!*mSource)
+                    throw std::runtime_error("Failed to read compressed saved game blocks");
+                const std::uint32_t maxSize = static_cast<std::uint32_t>(LZ4_compressBound(mBlockSize));
+                mBlockOffsets.reserve(blockCount + 1);
+                mBlockOffsets.push_back(mSource->tellg());
+                for (std::uint32_t size : sizes)
+                {
+                    if (size > maxSize)
+                        throw std::runtime_error("Invalid compressed saved game block size");
+                    mBlockOffsets.push_back(mBlockOffsets.back() + size);
+                }
+                if (mBlockOffsets.back() > end)
+                    throw std::runtime_error("Compressed saved game is truncated");
+                mBuffer.resize(mBlockSize);
+                setg(nullptr, nullptr, nullptr);
+            }
+
+            int_type underflow() final
+            {
+                if (gptr() == egptr())
+                {
+                    const std::size_t next = eback() == nullptr ? mBlock : mBlock + 1;
+                    if (next + 1 >= mBlockOffsets.size())
+                        return traits_type::eof();
+                    loadBlock(next);
+                }
+                return traits_type::to_int_type(*gptr());
+            }
+
+            pos_type seekoff(off_type offset, std::ios_base::seekdir whence, std::ios_base::openmode mode) final
+            {
+                switch (whence)
+                {
+                    case std::ios_base::beg:
+                        return seekpos(offset, mode);
+                    case std::ios_base::cur:
+                        return seekpos(getPosition() + offset, mode);
+                    case std::ios_base::end:
+                        return seekpos(mOrigin + static_cast<std::streamoff>(mSize) + offset, mode);
+                    default:
+                        return pos_type(off_type(-1));
+                }
+            }
+
+            pos_type seekpos(pos_type pos, std::ios_base::openmode mode) final
+            {
+                if ((mode & std::ios_base::out) || !(mode & std::ios_base::in))
+                    return pos_type(off_type(-1));
+
+                const std::streamoff offset = static_cast<std::streamoff>(pos) - mOrigin;
+                if (offset < 0 || static_cast<std::uint64_t>(offset) > mSize)
+                    return pos_type(off_type(-1));
+
+                const std::size_t block = static_cast<std::size_t>(offset / mBlockSize);
+                if (block + 1 >= mBlockOffsets.size())
+                {
+                    // Position at the end of the data with the size multiple of the block size
+                    mBlock = block;
+                    setg(nullptr, nullptr, nullptr);
+                    return pos;
+                }
+
+                if (eback() == nullptr || block != mBlock)
+                    loadBlock(block);
+                setg(eback(), eback() + (offset - static_cast<std::streamoff>(block) * mBlockSize), egptr());
+                return pos;
+            }
+
+        private:
+            std::unique_ptr<std::istream> mSource;
+            std::streamoff mOrigin;
+            std::uint32_t mBlockSize = 0;
+            std::uint64_t mSize = 0;
+            std::vector<std::streamoff> mBlockOffsets;
+            std::size_t mBlock = 0;
+            std::vector<char> mCompressed;
+            std::vector<char> mBuffer;
+
+            std::streamoff getPosition() const
+            {
+                return mOrigin + static_cast<std::streamoff>(mBlock) * mBlockSize + (gptr() - eback());
+            }
+
+            void loadBlock(std::size_t block)
+            {
+                const std::streamoff begin = mBlockOffsets[block];
+                mCompressed.resize(static_cast<std::size_t>(mBlockOffsets[block + 1] - begin));
+                mSource->clear();
+                mSource->seekg(begin);
+                mSource->read(mCompressed.data(), static_cast<std::streamsize>(mCompressed.size()));
+                if (!*mSource)
+                    throw std::runtime_error("Failed to read compressed saved game block " + std::to_string(block));
+
+                const std::uint64_t expected
+                    = std::min<std::uint64_t>(mBlockSize, mSize - static_cast<std::uint64_t>(block) * mBlockSize);
+                const int size = LZ4_decompress_safe(mCompressed.data(), mBuffer.data(),
+                    static_cast<int>(mCompressed.size()), static_cast<int>(mBuffer.size()));
+                if (size < 0 || static_cast<std::uint64_t>(size) != expected)
+                    throw std::runtime_error("Failed to decompress saved game block " + std::to_string(block));
+
+                mBlock = block;
+                setg(mBuffer.data(), mBuffer.data(), mBuffer.data() + size);
+            }
+        };
+    }
+
+    std::string compressSaveGame(std::string_view data)
+    {
+        std::uint32_t headerSize = 0;
+        if (data.size() < recordHeaderSize || data.substr(0, 4) != "TES3")
+            throw std::runtime_error("Saved game doesn't start with TES3 record");
+        std::memcpy(&headerSize, data.data() + 4, sizeof(headerSize));
+        const std::size_t payloadOffset = recordHeaderSize + headerSize;
+        if (payloadOffset > data.size())
+            throw std::runtime_error("Saved game TES3 record is truncated");
+
+        const std::string_view payload = data.substr(payloadOffset);
+        const std::size_t blockCount = (payload.size() + compressedBlockSize - 1) / compressedBlockSize;
+        if (blockCount > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error("Saved game is too large to compress");
+
+        std::string blocks;
+        std::vector<std::uint32_t> sizes;
+        sizes.reserve(blockCount);
+        std::vector<char> buffer(static_cast<std::size_t>(LZ4_compressBound(compressedBlockSize)));
+        for (std::size_t offset = 0; offset < payload.size(); offset += compressedBlockSize)
+        {
+            const std::size_t size = std::min<std::size_t>(compressedBlockSize, payload.size() - offset);
+            const int compressed = LZ4_compress_default(payload.data() + offset, buffer.data(),
+                static_cast<int>(size), static_cast<int>(buffer.size()));
+            if (compressed == 0)
+                throw std::runtime_error("Failed to compress saved game");
+            sizes.push_back(static_cast<std::uint32_t>(compressed));
+            blocks.append(buffer.data(), static_cast<std::size_t>(compressed));
+        }
+
+        std::string result(data.substr(0, payloadOffset));
+        result.append(std::begin(compressedSaveGameMagic), std::end(compressedSaveGameMagic));
+        append(result, compressedBlockSize);
+        append(result, static_cast<std::uint64_t>(payload.size()));
+        append(result, static_cast<std::uint32_t>(blockCount));
+        for (std::uint32_t size : sizes)
+            append(result, size);
+        result += blocks;
+        return result;
+    }
+
+    bool isCompressedSaveGame(std::istream& stream)
+    {
+        const std::streampos position = stream.tellg();
+        char magic[std::size(compressedSaveGameMagic)];
+        stream.read(magic, sizeof(magic));
+        const bool result = stream.gcount() == static_cast<std::streamsize>(sizeof(magic))
+            && std::memcmp(magic, compressedSaveGameMagic, sizeof(magic)) == 0;
+        stream.clear();
+        stream.seekg(position);
+        return result;
+    }
+
+    std::unique_ptr<std::istream> openCompressedSaveGame(std::unique_ptr<std::istream>&& stream)
+    {
+        return std::make_unique<Files::StreamWithBuffer<CompressedSaveGameStreamBuf>>(
+            std::make_unique<CompressedSaveGameStreamBuf>(std::move(stream)));
+    }
+}
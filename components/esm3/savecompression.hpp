@@ -0,0 +1,23 @@
+#ifndef OPENMW_COMPONENTS_ESM3_SAVECOMPRESSION_H
+#define OPENMW_COMPONENTS_ESM3_SAVECOMPRESSION_H
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace ESM
+{
+    /// Compresses everything after the TES3 header record of a serialized saved game into independent LZ4 blocks.
+    /// The header stays uncompressed so older versions still read the format version and reject the file.
+    std::string compressSaveGame(std::string_view data);
+
+    /// Checks whether compressed data starts at the current stream position. Doesn't change the position.
+    bool isCompressedSaveGame(std::istream& stream);
+
+    /// Returns a seekable stream decompressing blocks on demand. Positions before the current position of the source
+    /// stream are not accessible, the following ones correspond to the uncompressed data.
+    std::unique_ptr<std::istream> openCompressedSaveGame(std::unique_ptr<std::istream>&& stream);
+}
+
+#endif
@@ -2,12 +2,16 @@
 #define COMPONENTS_FILES_HASH_H
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <string_view>
 
 namespace Files
 {
+    /// Data is hashed by blocks of this size, each block hash is seeded with the previous one.
+    constexpr std::size_t hashBlockSize = 4096;
+
     std::array<std::uint64_t, 2> getHash(std::string_view fileName, std::istream& stream);
 }
 
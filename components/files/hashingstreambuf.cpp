@@ -0,0 +1,98 @@
+#include "hashingstreambuf.hpp"
+
+#include <extern/smhasher/MurmurHash3.h>
+
+namespace Files
+{
+    HashingStreamBuf::HashingStreamBuf(std::istream& source)
+        : mSource(source)
+        , mStart(source.tellg())
+    {
+        setg(nullptr, nullptr, nullptr);
+    }
+
+    std::array<std::uint64_t, 2> HashingStreamBuf::finish(std::string_view fileName)
+    {
+        if (mSequential)
+        {
+            while (underflow() != traits_type::eof())
+                setg(eback(), egptr(), egptr());
+            return mHash;
+        }
+        mSource.clear();
+        mSource.seekg(mStart);
+        return getHash(fileName, mSource);
+    }
+
+    std::streambuf::int_type HashingStreamBuf::underflow()
+    {
+        if (gptr() == egptr())
+        {
+            mSource.read(mBuffer.data(), mBuffer.size());
+            const std::streamsize read = mSource.gcount();
+            if (read == 0)
+                return traits_type::eof();
+            if (mSequential)
+            {
+                std::array<std::uint64_t, 2> blockHash{ 0, 0 };
+                MurmurHash3_x64_128(mBuffer.data(), static_cast<int>(read), mHash.data(), blockHash.data());
+                mHash = blockHash;
+            }
+            mRead += read;
+            setg(mBuffer.data(), mBuffer.data(), mBuffer.data() + read);
+        }
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::streambuf::pos_type HashingStreamBuf::seekoff(
+        off_type offset, std::ios_base::seekdir whence, std::ios_base::openmode mode)
+    {
+        switch (whence)
+        {
+            case std::ios_base::beg:
+                return seekpos(offset, mode);
+            case std::ios_base::cur:
+                return seekpos(mStart + mRead - (egptr() - gptr()) + offset, mode);
+            case std::ios_base::end:
+                break;
+            default:
+                return pos_type(off_type(-1));
+        }
+
+        if ((mode & std::ios_base::out) || !(mode & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        mSource.clear();
+        mSource.seekg(offset, std::ios_base::end);
+        const pos_type result = mSource.tellg();
+        if (result == pos_type(off_type(-1)))
+            return result;
+        mSequential = false;
+        mRead = static_cast<std::streamoff>(result) - mStart;
+        setg(nullptr, nullptr, nullptr);
+        return result;
+    }
+
+    std::streambuf::pos_type HashingStreamBuf::seekpos(pos_type pos, std::ios_base::openmode mode)
+    {
+        if ((mode & std::ios_base::out) || !(mode & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        // Moving within already hashed block keeps hashing sequential
+        const std::streamoff end = mStart + mRead;
+        const std::streamoff target = pos;
+        if (target <= end && target >= end - (egptr() - eback()))
+        {
+            setg(eback(), egptr() - (end - target), egptr());
+            return pos;
+        }
+
+        mSource.clear();
+        if (!mSource.seekg(pos))
+            return pos_type(off_type(-1));
+        mSequential = false;
+        mRead = target - mStart;
+        setg(nullptr, nullptr, nullptr);
+        return pos;
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef OPENMW_COMPONENTS_FILES_HASHINGSTREAMBUF_H
+#define OPENMW_COMPONENTS_FILES_HASHINGSTREAMBUF_H
+
+#include "hash.hpp"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <streambuf>
+#include <string_view>
+
+namespace Files
+{
+    /// @brief Streambuf reading the source stream in blocks and hashing them on the way.
+    /// @par Produces the same value as getHash without a separate pass over the data when the consumer reads
+    /// sequentially. Seeking outside of the current block falls back to getHash in finish().
+    class HashingStreamBuf final : public std::streambuf
+    {
+    public:
+        explicit HashingStreamBuf(std::istream& source);
+
+        /// Reads the rest of the source stream if needed and returns the hash of the data starting from the source
+        /// position at construction.
+        std::array<std::uint64_t, 2> finish(std::string_view fileName);
+
+        int_type underflow() final;
+
+        pos_type seekoff(off_type offset, std::ios_base::seekdir whence, std::ios_base::openmode mode) final;
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode mode) final;
+
+    private:
+        std::istream& mSource;
+        std::streamoff mStart;
+        std::streamoff mRead = 0;
+        bool mSequential = true;
+        std::array<std::uint64_t, 2> mHash{ 0, 0 };
+        std::array<char, hashBlockSize> mBuffer;
+    };
+}
+
+#endif
@@ -0,0 +1,31 @@
+#include "temporarypath.hpp"
+
+#include <components/misc/strings/format.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+namespace Files
+{
+    namespace
+    {
+        std::uint64_t makeProcessSeed()
+        {
+            std::random_device device;
+            const std::uint64_t value = (static_cast<std::uint64_t>(device()) << 32) | device();
+            return value ^ static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        }
+    }
+
+    std::filesystem::path makeTemporaryPath(const std::filesystem::path& path)
+    {
+        static const std::uint64_t processSeed = makeProcessSeed();
+        static std::atomic_uint64_t counter{ 0 };
+        std::filesystem::path result = path;
+        result += Misc::StringUtils::format(".%016llx.%llu.tmp", static_cast<unsigned long long>(processSeed),
+            static_cast<unsigned long long>(counter++));
+        return result;
+    }
+}
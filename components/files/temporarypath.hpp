@@ -0,0 +1,13 @@
+#ifndef COMPONENTS_FILES_TEMPORARYPATH_HPP
+#define COMPONENTS_FILES_TEMPORARYPATH_HPP
+
+#include <filesystem>
+
+namespace Files
+{
+    /// Returns a path in the same directory as the given one with a unique suffix to write a file and then rename
+    /// it over the original. Different processes and threads get different paths for the same argument.
+    std::filesystem::path makeTemporaryPath(const std::filesystem::path& path);
+}
+
+#endif
@@ -4,15 +4,16 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 
 namespace Misc
 {
-    template <class T>
+    template <class T, class Lock = std::unique_lock<std::mutex>>
     class Locked
     {
     public:
-        Locked(std::mutex& mutex, std::remove_reference_t<T>& value)
+        Locked(typename Lock::mutex_type& mutex, std::remove_reference_t<T>& value)
             : mLock(mutex)
             , mValue(value)
         {
@@ -25,7 +26,7 @@ namespace Misc
         std::remove_reference_t<T>& operator*() const { return get(); }
 
     private:
-        std::unique_lock<std::mutex> mLock;
+        Lock mLock;
         std::reference_wrapper<std::remove_reference_t<T>> mValue;
     };
 
@@ -85,6 +86,33 @@ namespace Misc
         mutable std::mutex mMutex;
         T mValue;
     };
+
+    /// Same as ScopeGuarded but allows multiple readers to access the value at the same time
+    template <class T>
+    class SharedGuarded
+    {
+    public:
+        template <class... Args>
+        SharedGuarded(Args&&... args)
+            : mMutex()
+            , mValue(std::forward<Args>(args)...)
+        {
+        }
+
+        Locked<T, std::unique_lock<std::shared_mutex>> lock()
+        {
+            return Locked<T, std::unique_lock<std::shared_mutex>>(mMutex, mValue);
+        }
+
+        Locked<const T, std::shared_lock<std::shared_mutex>> lockConst() const
+        {
+            return Locked<const T, std::shared_lock<std::shared_mutex>>(mMutex, mValue);
+        }
+
+    private:
+        mutable std::shared_mutex mMutex;
+        T mValue;
+    };
 }
 
 #endif
@@ -0,0 +1,92 @@
+#ifndef OPENMW_COMPONENTS_MISC_SPATIALHASH_H
+#define OPENMW_COMPONENTS_MISC_SPATIALHASH_H
+
+#include "hash.hpp"
+
+#include <osg/Vec2i>
+#include <osg/Vec3f>
+
+#include <cassert>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+namespace Misc
+{
+    /// @brief Uniform grid in XY plane for neighbour queries over a set of points rebuilt every frame
+    /// @par Memory allocated for non-empty cells is reused after clear() so rebuilding a grid with slowly moving points
+    /// does not allocate.
+    template <class T>
+    class SpatialHash
+    {
+    public:
+        explicit SpatialHash(float cellSize)
+            : mCellSize(cellSize)
+        {
+            assert(cellSize > 0);
+        }
+
+        float getCellSize() const { return mCellSize; }
+
+        std::size_t size() const { return mSize; }
+
+        void clear()
+        {
+            std::erase_if(mCells, [](const auto& cell) { return cell.second.empty(); });
+            for (auto& [position, items] : mCells)
+                items.clear();
+            mSize = 0;
+        }
+
+        void add(const osg::Vec3f& position, const T& value)
+        {
+            mCells[getCellPosition(position)].push_back(Item{ position, value });
+            ++mSize;
+        }
+
+        /// Call function for each value located not further than radius from the position. Order is unspecified.
+        template <class Function>
+        void forEachInRange(const osg::Vec3f& position, float radius, Function&& function) const
+        {
+            const osg::Vec2i min = getCellPosition(position - osg::Vec3f(radius, radius, 0));
+            const osg::Vec2i max = getCellPosition(position + osg::Vec3f(radius, radius, 0));
+            const float radiusSqr = radius * radius;
+            for (int x = min.x(); x <= max.x(); ++x)
+            {
+                for (int y = min.y(); y <= max.y(); ++y)
+                {
+                    const auto it = mCells.find(osg::Vec2i(x, y));
+                    if (it == mCells.end())
+                        continue;
+                    for (const Item& item : it->second)
+                        if ((item.mPosition - position).length2() <= radiusSqr)
+                            function(item.mValue);
+                }
+            }
+        }
+
+    private:
+        struct Item
+        {
+            osg::Vec3f mPosition;
+            T mValue;
+        };
+
+        struct CellHash
+        {
+            std::size_t operator()(const osg::Vec2i& value) const { return hash2dCoord(value.x(), value.y()); }
+        };
+
+        float mCellSize;
+        std::size_t mSize = 0;
+        std::unordered_map<osg::Vec2i, std::vector<Item>, CellHash> mCells;
+
+        osg::Vec2i getCellPosition(const osg::Vec3f& position) const
+        {
+            return osg::Vec2i(static_cast<int>(std::floor(position.x() / mCellSize)),
+                static_cast<int>(std::floor(position.y() / mCellSize)));
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,91 @@
+#include "taskgraph.hpp"
+
+#include <cassert>
+#include <utility>
+
+namespace Misc
+{
+    void TaskGraph::clear()
+    {
+        const std::lock_guard lock(mMutex);
+        mTasks.clear();
+        mReady.clear();
+        mRemainingTasks = 0;
+    }
+
+    TaskGraph::TaskId TaskGraph::addTask(std::function<void(std::size_t batch)> function, std::size_t batches)
+    {
+        assert(batches > 0);
+        const TaskId id = mTasks.size();
+        Task& task = mTasks.emplace_back();
+        task.mFunction = std::move(function);
+        task.mBatches = batches;
+        return id;
+    }
+
+    void TaskGraph::addDependency(TaskId task, TaskId dependency)
+    {
+        assert(dependency < task);
+        mTasks[dependency].mDependents.push_back(task);
+        ++mTasks[task].mDependencies;
+    }
+
+    void TaskGraph::start()
+    {
+        const std::lock_guard lock(mMutex);
+        mReady.clear();
+        for (TaskId id = 0; id < mTasks.size(); ++id)
+        {
+            Task& task = mTasks[id];
+            task.mRemainingDependencies = task.mDependencies;
+            task.mNextBatch = 0;
+            task.mUnfinishedBatches = task.mBatches;
+            if (task.mDependencies == 0)
+                mReady.push_back(id);
+        }
+        mRemainingTasks = mTasks.size();
+    }
+
+    void TaskGraph::run()
+    {
+        std::unique_lock lock(mMutex);
+        while (true)
+        {
+            mCondition.wait(lock, [&] { return !mReady.empty() || mRemainingTasks == 0; });
+            if (mRemainingTasks == 0)
+                return;
+
+            const TaskId id = mReady.front();
+            Task& task = mTasks[id];
+            const std::size_t batch = task.mNextBatch++;
+            if (task.mNextBatch == task.mBatches)
+                mReady.pop_front();
+
+            lock.unlock();
+            task.mFunction(batch);
+            lock.lock();
+
+            if (--task.mUnfinishedBatches != 0)
+                continue;
+
+            --mRemainingTasks;
+            bool notify = mRemainingTasks == 0;
+            for (TaskId dependent : task.mDependents)
+            {
+                if (--mTasks[dependent].mRemainingDependencies == 0)
+                {
+                    mReady.push_back(dependent);
+                    notify = true;
+                }
+            }
+            if (notify)
+                mCondition.notify_all();
+        }
+    }
+
+    bool TaskGraph::isDone() const
+    {
+        const std::lock_guard lock(mMutex);
+        return mRemainingTasks == 0;
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef OPENMW_COMPONENTS_MISC_TASKGRAPH_H
+#define OPENMW_COMPONENTS_MISC_TASKGRAPH_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Misc
+{
+    /// @brief Set of tasks with dependencies executed by the threads calling run()
+    /// @par Each task is split into batches. Batches of the same task may run in parallel, a task starts only when all
+    /// batches of its dependencies are finished. Tasks must not throw.
+    class TaskGraph
+    {
+    public:
+        using TaskId = std::size_t;
+
+        /// Remove all tasks. Must not be called while any thread is inside run().
+        void clear();
+
+        /// @param function is called once for each batch index in [0, batches)
+        TaskId addTask(std::function<void(std::size_t batch)> function, std::size_t batches = 1);
+
+        /// Task will not start until dependency is finished. Dependency has to be added before the task.
+        void addDependency(TaskId task, TaskId dependency);
+
+        /// Make tasks without dependencies available for execution. Must be called before run().
+        void start();
+
+        /// Execute batches until all tasks are finished. Can be called from multiple threads at the same time.
+        void run();
+
+        bool isDone() const;
+
+        std::size_t getTasksCount() const { return mTasks.size(); }
+
+    private:
+        struct Task
+        {
+            std::function<void(std::size_t batch)> mFunction;
+            std::size_t mBatches = 1;
+            std::vector<TaskId> mDependents;
+            std::size_t mDependencies = 0;
+            std::size_t mRemainingDependencies = 0;
+            std::size_t mNextBatch = 0;
+            std::size_t mUnfinishedBatches = 0;
+        };
+
+        std::vector<Task> mTasks;
+        std::deque<TaskId> mReady;
+        std::size_t mRemainingTasks = 0;
+        mutable std::mutex mMutex;
+        std::condition_variable mCondition;
+    };
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include "taskgraphworkers.hpp"
+#include "taskgraph.hpp"
+
+namespace Misc
+{
+    TaskGraphWorkers::TaskGraphWorkers(std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            mThreads.emplace_back([this] { work(); });
+    }
+
+    TaskGraphWorkers::~TaskGraphWorkers()
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            mShouldStop = true;
+        }
+        mHasJob.notify_all();
+        for (std::thread& thread : mThreads)
+            thread.join();
+    }
+
+    void TaskGraphWorkers::run(TaskGraph& graph)
+    {
+        if (mThreads.empty())
+        {
+            graph.run();
+            return;
+        }
+
+        {
+            const std::lock_guard lock(mMutex);
+            mGraph = &graph;
+            ++mGeneration;
+            mActiveThreads = mThreads.size();
+        }
+        mHasJob.notify_all();
+
+        graph.run();
+
+        // Workers may be still inside TaskGraph::run, it's not allowed to change the graph until they leave
+        std::unique_lock lock(mMutex);
+        mIsDone.wait(lock, [&] { return mActiveThreads == 0; });
+        mGraph = nullptr;
+    }
+
+    void TaskGraphWorkers::work()
+    {
+        std::size_t generation = 0;
+        std::unique_lock lock(mMutex);
+        while (true)
+        {
+            mHasJob.wait(lock, [&] { return mShouldStop || mGeneration != generation; });
+            if (mShouldStop)
+                return;
+            generation = mGeneration;
+            TaskGraph& graph = *mGraph;
+            lock.unlock();
+            graph.run();
+            lock.lock();
+            if (--mActiveThreads == 0)
+                mIsDone.notify_one();
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef OPENMW_COMPONENTS_MISC_TASKGRAPHWORKERS_H
+#define OPENMW_COMPONENTS_MISC_TASKGRAPHWORKERS_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Misc
+{
+    class TaskGraph;
+
+    /// @brief Threads helping the calling thread to execute a TaskGraph
+    class TaskGraphWorkers
+    {
+    public:
+        explicit TaskGraphWorkers(std::size_t count);
+
+        ~TaskGraphWorkers();
+
+        std::size_t size() const { return mThreads.size(); }
+
+        /// Execute started graph by the calling thread together with the workers. Returns when all tasks are finished
+        /// and none of the workers uses the graph anymore.
+        void run(TaskGraph& graph);
+
+    private:
+        std::mutex mMutex;
+        std::condition_variable mHasJob;
+        std::condition_variable mIsDone;
+        TaskGraph* mGraph = nullptr;
+        std::size_t mGeneration = 0;
+        std::size_t mActiveThreads = 0;
+        bool mShouldStop = false;
+        std::vector<std::thread> mThreads;
+
+        void work();
+    };
+}
+
+#endif
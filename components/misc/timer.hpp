@@ -35,6 +35,9 @@ namespace Misc
 
         void reset(float timeLeft) { mTimeLeft = timeLeft; }
 
+        /// Status the next update will return
+        TimerStatus getNextStatus() const { return mTimeLeft > 0 ? TimerStatus::Waiting : TimerStatus::Elapsed; }
+
     private:
         const float mPeriod;
         const float mDeviation;
@@ -1,7 +1,8 @@
 #include "niffile.hpp"
 
 #include <components/debug/debuglog.hpp>
-#include <components/files/hash.hpp>
+#include <components/files/hashingstreambuf.hpp>
+#include <components/files/streamwithbuffer.hpp>
 
 #include <algorithm>
 #include <array>
@@ -542,10 +543,11 @@ namespace Nif
         if (writeDebug)
             Log(Debug::Verbose) << "NIF Debug: Reading file: '" << mFilename << "'";
 
-        const std::array<std::uint64_t, 2> fileHash = Files::getHash(mFilename, *stream);
-        mHash.append(reinterpret_cast<const char*>(fileHash.data()), fileHash.size() * sizeof(std::uint64_t));
-
-        NIFStream nif(*this, std::move(stream), mEncoder);
+        // File is hashed while it's parsed to avoid reading it twice
+        auto hashingBuffer = std::make_unique<Files::HashingStreamBuf>(*stream);
+        Files::HashingStreamBuf& hashing = *hashingBuffer;
+        NIFStream nif(*this,
+            std::make_unique<Files::StreamWithBuffer<Files::HashingStreamBuf>>(std::move(hashingBuffer)), mEncoder);
 
         // Check the header string
         std::string head = nif.getVersionString();
@@ -722,6 +724,9 @@ namespace Nif
             }
         }
 
+        const std::array<std::uint64_t, 2> fileHash = hashing.finish(mFilename);
+        mHash.append(reinterpret_cast<const char*>(fileHash.data()), fileHash.size() * sizeof(std::uint64_t));
+
         // Once parsing is done, do post-processing.
         for (const auto& record : mRecords)
             record->post(*this);
@@ -63,6 +63,25 @@ namespace Platform::File
 
         operator Handle() const { return mHandle; }
     };
+
+    /// Read-only memory mapping of a whole file. Mapping stays valid after the file is closed.
+    class MappedFile
+    {
+    public:
+        /// Throws an exception if the file can not be mapped or mapping is not supported by the platform.
+        explicit MappedFile(const std::filesystem::path& filename);
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+        ~MappedFile();
+
+        const char* data() const noexcept { return mData; }
+
+        size_t size() const noexcept { return mSize; }
+
+    private:
+        const char* mData = nullptr;
+        size_t mSize = 0;
+    };
 }
 
 #endif // OPENMW_COMPONENTS_PLATFORM_FILE_HPP
@@ -93,4 +93,11 @@ namespace Platform::File
         return static_cast<size_t>(amount);
     }
 
+    MappedFile::MappedFile(const std::filesystem::path& filename)
+    {
+        throw std::runtime_error(
+            std::string("Failed to map '") + Files::pathToUnicodeString(filename) + "': not supported by the platform");
+    }
+
+    MappedFile::~MappedFile() = default;
 }
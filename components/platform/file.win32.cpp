@@ -99,4 +99,31 @@ namespace Platform::File
 
         return bytesRead;
     }
+
+    MappedFile::MappedFile(const std::filesystem::path& filename)
+    {
+        ScopedHandle handle(open(filename));
+        mSize = Platform::File::size(handle);
+        // Zero length mapping is not allowed
+        if (mSize == 0)
+            return;
+        HANDLE mapping = CreateFileMappingW(getNativeHandle(handle), nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+            throw std::runtime_error(std::string("Failed to create file mapping for '")
+                + Files::pathToUnicodeString(filename) + "': " + std::to_string(GetLastError()));
+        // View keeps a reference to the mapping object so it can be closed immediately
+        const void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        const DWORD error = GetLastError();
+        CloseHandle(mapping);
+        if (data == nullptr)
+            throw std::runtime_error(std::string("Failed to map '") + Files::pathToUnicodeString(filename)
+                + "' into memory: " + std::to_string(error));
+        mData = static_cast<const char*>(data);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (mData != nullptr)
+            UnmapViewOfFile(mData);
+    }
 }
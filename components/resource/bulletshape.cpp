@@ -6,6 +6,7 @@
 #include <BulletCollision/CollisionShapes/btBoxShape.h>
 #include <BulletCollision/CollisionShapes/btCompoundShape.h>
 #include <BulletCollision/CollisionShapes/btHeightfieldTerrainShape.h>
+#include <BulletCollision/CollisionShapes/btOptimizedBvh.h>
 #include <BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h>
 
 namespace Resource
@@ -71,6 +72,57 @@ namespace Resource
 
             delete shape;
         }
+
+        std::size_t estimateCollisionShapeSize(const btCollisionShape* shape)
+        {
+            if (shape == nullptr)
+                return 0;
+
+            if (shape->isCompound())
+            {
+                const btCompoundShape* comp = static_cast<const btCompoundShape*>(shape);
+                std::size_t result = sizeof(btCompoundShape);
+                for (int i = 0, n = comp->getNumChildShapes(); i < n; ++i)
+                    result += sizeof(btCompoundShapeChild) + estimateCollisionShapeSize(comp->getChildShape(i));
+                return result;
+            }
+
+            // Owns the child shape when it's a part of the loaded BulletShape
+            if (shape->getShapeType() == SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE)
+            {
+                const btScaledBvhTriangleMeshShape* trishape = static_cast<const btScaledBvhTriangleMeshShape*>(shape);
+                return sizeof(btScaledBvhTriangleMeshShape) + estimateCollisionShapeSize(trishape->getChildShape());
+            }
+
+            if (shape->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE)
+            {
+                btBvhTriangleMeshShape* trishape
+                    = const_cast<btBvhTriangleMeshShape*>(static_cast<const btBvhTriangleMeshShape*>(shape));
+                std::size_t result = sizeof(btBvhTriangleMeshShape);
+                const btStridingMeshInterface* mesh = trishape->getMeshInterface();
+                for (int part = 0, n = mesh->getNumSubParts(); part < n; ++part)
+                {
+                    const unsigned char* vertices = nullptr;
+                    int verticesCount = 0;
+                    PHY_ScalarType vertexType;
+                    int vertexStride = 0;
+                    const unsigned char* indices = nullptr;
+                    int indexStride = 0;
+                    int facesCount = 0;
+                    PHY_ScalarType indexType;
+                    mesh->getLockedReadOnlyVertexIndexBase(&vertices, verticesCount, vertexType, vertexStride,
+                        &indices, indexStride, facesCount, indexType, part);
+                    result += static_cast<std::size_t>(verticesCount) * static_cast<std::size_t>(vertexStride)
+                        + static_cast<std::size_t>(facesCount) * static_cast<std::size_t>(indexStride);
+                    mesh->unLockReadOnlyVertexBase(part);
+                }
+                if (const btOptimizedBvh* bvh = trishape->getOptimizedBvh())
+                    result += bvh->calculateSerializeBufferSize();
+                return result;
+            }
+
+            return sizeof(btCollisionShape);
+        }
     }
 
     void DeleteCollisionShape::operator()(btCollisionShape* shape) const
@@ -102,6 +154,12 @@ namespace Resource
         return { new BulletShapeInstance(std::move(source)) };
     }
 
+    std::size_t estimateBulletShapeSize(const BulletShape& shape)
+    {
+        return sizeof(BulletShape) + estimateCollisionShapeSize(shape.mCollisionShape.get())
+            + estimateCollisionShapeSize(shape.mAvoidCollisionShape.get());
+    }
+
     BulletShapeInstance::BulletShapeInstance(osg::ref_ptr<const BulletShape> source)
         : BulletShape(*source)
         , mSource(std::move(source))
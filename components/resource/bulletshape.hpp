@@ -1,6 +1,7 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_BULLETSHAPE_H
 #define OPENMW_COMPONENTS_RESOURCE_BULLETSHAPE_H
 
+#include <cstddef>
 #include <map>
 #include <memory>
 
@@ -89,6 +90,10 @@ namespace Resource
 
     osg::ref_ptr<BulletShapeInstance> makeInstance(osg::ref_ptr<const BulletShape> source);
 
+    // Approximate amount of memory owned by the collision shapes: triangle meshes and their bounding volume
+    // hierarchies.
+    std::size_t estimateBulletShapeSize(const BulletShape& shape);
+
     // Subclass btBhvTriangleMeshShape to auto-delete the meshInterface
     struct TriangleMeshShape : public btBvhTriangleMeshShape
     {
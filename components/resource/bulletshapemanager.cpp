@@ -160,7 +160,8 @@ namespace Resource
             }
         }
 
-        mCache->addEntryToObjectCache(name.value(), shape);
+        mCache->addEntryToObjectCache(
+            name.value(), shape, 0.0, shape == nullptr ? 0 : estimateBulletShapeSize(*shape));
 
         return shape;
     }
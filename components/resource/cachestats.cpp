@@ -15,6 +15,11 @@ namespace Resource
             result += suffix;
             return result;
         }
+
+        std::string makeShardAttribute(std::string_view prefix, std::size_t shard)
+        {
+            return makeAttribute(prefix, "Contended Shard " + std::to_string(shard));
+        }
     }
 
     void addCacheStatsAttibutes(std::string_view prefix, std::vector<std::string>& out)
@@ -24,17 +29,31 @@ namespace Resource
             "Get",
             "Hit",
             "Expired",
+            "Memory",
+            "Evicted",
+            "Contended",
         };
 
         for (std::string_view suffix : suffixes)
             out.push_back(makeAttribute(prefix, suffix));
     }
 
+    void addCacheShardStatsAttibutes(std::string_view prefix, std::size_t shards, std::vector<std::string>& out)
+    {
+        for (std::size_t i = 0; i < shards; ++i)
+            out.push_back(makeShardAttribute(prefix, i));
+    }
+
     void reportStats(std::string_view prefix, unsigned frameNumber, const CacheStats& src, osg::Stats& dst)
     {
         dst.setAttribute(frameNumber, makeAttribute(prefix, "Count"), static_cast<double>(src.mSize));
         dst.setAttribute(frameNumber, makeAttribute(prefix, "Get"), static_cast<double>(src.mGet));
         dst.setAttribute(frameNumber, makeAttribute(prefix, "Hit"), static_cast<double>(src.mHit));
         dst.setAttribute(frameNumber, makeAttribute(prefix, "Expired"), static_cast<double>(src.mExpired));
+        dst.setAttribute(frameNumber, makeAttribute(prefix, "Memory"), static_cast<double>(src.mMemoryUsage));
+        dst.setAttribute(frameNumber, makeAttribute(prefix, "Evicted"), static_cast<double>(src.mEvicted));
+        dst.setAttribute(frameNumber, makeAttribute(prefix, "Contended"), static_cast<double>(src.mContended));
+        for (std::size_t i = 0; i < src.mShardContended.size(); ++i)
+            dst.setAttribute(frameNumber, makeShardAttribute(prefix, i), static_cast<double>(src.mShardContended[i]));
     }
 }
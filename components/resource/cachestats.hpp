@@ -19,10 +19,17 @@ namespace Resource
         std::size_t mGet = 0;
         std::size_t mHit = 0;
         std::size_t mExpired = 0;
+        std::size_t mMemoryUsage = 0;
+        std::size_t mEvicted = 0;
+        std::size_t mContended = 0;
+        // Lock contention of each shard, empty for caches with a single shard
+        std::vector<std::size_t> mShardContended;
     };
 
     void addCacheStatsAttibutes(std::string_view prefix, std::vector<std::string>& out);
 
+    void addCacheShardStatsAttibutes(std::string_view prefix, std::size_t shards, std::vector<std::string>& out);
+
     void reportStats(std::string_view prefix, unsigned frameNumber, const CacheStats& src, osg::Stats& dst);
 }
 
@@ -214,11 +214,16 @@ namespace Resource
             return osg::ref_ptr<const SceneUtil::KeyframeHolder>(static_cast<SceneUtil::KeyframeHolder*>(obj.get()));
 
         osg::ref_ptr<SceneUtil::KeyframeHolder> loaded(new SceneUtil::KeyframeHolder);
+        // Animations retrieved from a scene are shared with its template accounted by the scene cache
+        std::size_t size = 0;
         if (Misc::getFileExtension(name.value()) == "kf")
         {
             auto file = std::make_shared<Nif::NIFFile>(name);
             Nif::Reader reader(*file, mEncoder);
-            reader.parse(mVFS->get(name));
+            Files::IStreamPtr stream = mVFS->get(name);
+            // Converted animations take about as much memory as the file content
+            size = getRemainingStreamSize(*stream);
+            reader.parse(std::move(stream));
             NifOsg::Loader::loadKf(*file, *loaded.get());
         }
         else
@@ -232,7 +237,7 @@ namespace Resource
                 scene->accept(rav);
             }
         }
-        mCache->addEntryToObjectCache(name.value(), loaded);
+        mCache->addEntryToObjectCache(name.value(), loaded, 0.0, size);
         return loaded;
     }
 
@@ -48,9 +48,12 @@ namespace Resource
 
         auto file = std::make_shared<Nif::NIFFile>(name);
         Nif::Reader reader(*file, mEncoder);
-        reader.parse(mVFS->get(name));
+        Files::IStreamPtr stream = mVFS->get(name);
+        // Parsed records take about as much memory as the file content
+        const std::size_t size = getRemainingStreamSize(*stream);
+        reader.parse(std::move(stream));
         obj = new NifFileHolder(file);
-        mCache->addEntryToObjectCache(name.value(), obj);
+        mCache->addEntryToObjectCache(name.value(), obj, 0.0, size);
         return file;
     }
 
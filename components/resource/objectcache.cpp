@@ -0,0 +1,109 @@
+#include "objectcache.hpp"
+
+#include <osg/Geometry>
+#include <osg/Image>
+#include <osg/NodeVisitor>
+#include <osg/StateSet>
+#include <osg/Texture>
+
+#include <istream>
+#include <unordered_set>
+
+namespace Resource
+{
+    namespace
+    {
+        class EstimateSizeVisitor : public osg::NodeVisitor
+        {
+        public:
+            EstimateSizeVisitor()
+                : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            {
+            }
+
+            void apply(osg::Node& node) override
+            {
+                add(node.getStateSet());
+                traverse(node);
+            }
+
+            void apply(osg::Drawable& drawable) override
+            {
+                add(drawable.getStateSet());
+                if (osg::Geometry* const geometry = drawable.asGeometry())
+                {
+                    osg::Geometry::ArrayList arrays;
+                    geometry->getArrayList(arrays);
+                    for (const osg::Array* array : arrays)
+                        add(array);
+                    for (const osg::ref_ptr<osg::PrimitiveSet>& primitiveSet : geometry->getPrimitiveSetList())
+                        add(primitiveSet.get());
+                }
+            }
+
+            void add(const osg::BufferData* data)
+            {
+                if (data != nullptr && mVisited.insert(data).second)
+                    mSize += data->getTotalDataSize();
+            }
+
+            void add(const osg::Image* image)
+            {
+                if (image != nullptr && mVisited.insert(image).second)
+                    mSize += image->getTotalSizeInBytesIncludingMipmaps();
+            }
+
+            void add(const osg::Texture* texture)
+            {
+                if (texture == nullptr)
+                    return;
+                for (unsigned i = 0; i < texture->getNumImages(); ++i)
+                    add(texture->getImage(i));
+            }
+
+            void add(const osg::StateSet* stateSet)
+            {
+                if (stateSet == nullptr || !mVisited.insert(stateSet).second)
+                    return;
+                for (const osg::StateSet::AttributeList& attributes : stateSet->getTextureAttributeList())
+                    for (const auto& [type, attribute] : attributes)
+                        add(attribute.first->asTexture());
+            }
+
+            std::size_t getSize() const { return mSize; }
+
+        private:
+            std::unordered_set<const osg::Referenced*> mVisited;
+            std::size_t mSize = 0;
+        };
+    }
+
+    std::size_t estimateObjectSize(const osg::Object* object)
+    {
+        if (object == nullptr)
+            return 0;
+        EstimateSizeVisitor visitor;
+        if (const osg::Image* const image = dynamic_cast<const osg::Image*>(object))
+            visitor.add(image);
+        else if (const osg::Texture* const texture = dynamic_cast<const osg::Texture*>(object))
+            visitor.add(texture);
+        else if (const osg::Node* const node = dynamic_cast<const osg::Node*>(object))
+            const_cast<osg::Node*>(node)->accept(visitor);
+        return visitor.getSize();
+    }
+
+    std::size_t getRemainingStreamSize(std::istream& stream)
+    {
+        const std::istream::pos_type position = stream.tellg();
+        if (position == std::istream::pos_type(-1) || !stream.seekg(0, std::ios_base::end))
+        {
+            stream.clear();
+            return 0;
+        }
+        const std::istream::pos_type end = stream.tellg();
+        stream.seekg(position);
+        if (end == std::istream::pos_type(-1))
+            return 0;
+        return static_cast<std::size_t>(end - position);
+    }
+}
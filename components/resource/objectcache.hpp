@@ -3,6 +3,8 @@
 // - removeExpiredObjectsInCache no longer keeps a lock while the unref happens.
 // - template allows customized KeyType.
 // - objects with uninitialized time stamp are not removed.
+// - items are spread over independently locked shards.
+// - optional memory budget with least recently used items eviction.
 
 /* -*-c++-*- OpenSceneGraph - Copyright (C) 1998-2006 Robert Osfield
  *
@@ -27,10 +29,16 @@
 #include <osg/ref_ptr>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
 #include <map>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace osg
@@ -47,6 +55,39 @@ namespace Resource
     {
         osg::ref_ptr<osg::Object> mValue;
         double mLastUsage;
+        std::size_t mSize = 0;
+    };
+
+    // Approximate amount of memory owned by the object: image data, vertex arrays and primitives. Shared data is
+    // counted once per object. Returns 0 for other types, callers caching them should provide the size explicitly.
+    std::size_t estimateObjectSize(const osg::Object* object);
+
+    // Number of bytes from the current position to the end of the stream, 0 if the stream doesn't support seeking.
+    // Used to estimate memory usage of objects parsed from files.
+    std::size_t getRemainingStreamSize(std::istream& stream);
+
+    // Defines how items are distributed over shards. Keys are compared with heterogeneous lookup so the shard has to
+    // be the same for all key representations. By default everything goes into a single shard.
+    template <class KeyType>
+    struct ObjectCacheShards
+    {
+        static constexpr std::size_t sCount = 1;
+
+        static std::size_t getIndex(const auto& /*key*/) { return 0; }
+    };
+
+    template <>
+    struct ObjectCacheShards<std::string>
+    {
+        static constexpr std::size_t sCount = 16;
+
+        static std::size_t getIndex(const auto& key)
+        {
+            if constexpr (requires { key.value(); })
+                return getIndex(std::string_view(key.value()));
+            else
+                return std::hash<std::string_view>{}(std::string_view(key)) % sCount;
+        }
     };
 
     template <typename KeyType>
@@ -55,70 +96,108 @@ namespace Resource
     public:
         // Update last usage timestamp using referenceTime for each cache time if they are not nullptr and referenced
         // from somewhere else. Remove items with last usage > expiryTime. Note: last usage might be updated from other
-        // places so nullptr or not references elsewhere items are not always removed.
+        // places so nullptr or not references elsewhere items are not always removed. When memory budget is set
+        // evict least recently used items not referenced from somewhere else until the total size of all shards fits
+        // the budget.
         void update(double referenceTime, double expiryDelay)
         {
+            const double expiryTime = referenceTime - expiryDelay;
             std::vector<osg::ref_ptr<osg::Object>> objectsToRemove;
+            for (Shard& shard : mShards)
             {
-                const double expiryTime = referenceTime - expiryDelay;
-                std::lock_guard<std::mutex> lock(mMutex);
-                std::erase_if(mItems, [&](auto& v) {
-                    Item& item = v.second;
-                    if ((item.mValue != nullptr && item.mValue->referenceCount() > 1) || item.mLastUsage == 0)
-                        item.mLastUsage = referenceTime;
-                    if (item.mLastUsage > expiryTime)
-                        return false;
-                    ++mExpired;
-                    if (item.mValue != nullptr)
-                        objectsToRemove.push_back(std::move(item.mValue));
-                    return true;
-                });
+                {
+                    const std::unique_lock lock = lockShard(shard);
+                    std::erase_if(shard.mItems, [&](auto& v) {
+                        Item& item = v.second;
+                        if ((item.mValue != nullptr && item.mValue->referenceCount() > 1) || item.mLastUsage == 0)
+                            item.mLastUsage = referenceTime;
+                        if (item.mLastUsage > expiryTime)
+                            return false;
+                        ++shard.mExpired;
+                        shard.mMemoryUsage -= item.mSize;
+                        if (item.mValue != nullptr)
+                            objectsToRemove.push_back(std::move(item.mValue));
+                        return true;
+                    });
+                }
+                // note, actual unref happens outside of the lock
+                objectsToRemove.clear();
+            }
+            if (const std::size_t budget = mMemoryBudget.load(std::memory_order_relaxed); budget != 0)
+            {
+                evict(budget, objectsToRemove);
+                objectsToRemove.clear();
             }
-            // note, actual unref happens outside of the lock
-            objectsToRemove.clear();
         }
 
         /** Remove all objects in the cache regardless of having external references or expiry times.*/
         void clear()
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mItems.clear();
+            for (Shard& shard : mShards)
+            {
+                std::map<KeyType, Item, std::less<>> items;
+                {
+                    const std::unique_lock lock = lockShard(shard);
+                    items.swap(shard.mItems);
+                    shard.mMemoryUsage = 0;
+                }
+            }
         }
 
         /** Add a key,object,timestamp triple to the Registry::ObjectCache.*/
         template <class K>
         void addEntryToObjectCache(K&& key, osg::Object* object, double timestamp = 0.0)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            const auto it = mItems.find(key);
-            if (it == mItems.end())
-                mItems.emplace_hint(it, std::forward<K>(key), Item{ object, timestamp });
+            addEntryToObjectCache(std::forward<K>(key), object, timestamp, estimateObjectSize(object));
+        }
+
+        /** Same as above but with a size estimated by the caller for objects not supported by estimateObjectSize.*/
+        template <class K>
+        void addEntryToObjectCache(K&& key, osg::Object* object, double timestamp, std::size_t size)
+        {
+            Shard& shard = getShard(key);
+            osg::ref_ptr<osg::Object> replaced;
+            const std::unique_lock lock = lockShard(shard);
+            const auto it = shard.mItems.find(key);
+            if (it == shard.mItems.end())
+                shard.mItems.emplace_hint(it, std::forward<K>(key), Item{ object, timestamp, size });
             else
-                it->second = Item{ object, timestamp };
+            {
+                shard.mMemoryUsage -= it->second.mSize;
+                replaced = std::move(it->second.mValue);
+                it->second = Item{ object, timestamp, size };
+            }
+            shard.mMemoryUsage += size;
         }
 
         /** Remove Object from cache.*/
         void removeFromObjectCache(const auto& key)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            const auto itr = mItems.find(key);
-            if (itr != mItems.end())
-                mItems.erase(itr);
+            Shard& shard = getShard(key);
+            const std::unique_lock lock = lockShard(shard);
+            const auto itr = shard.mItems.find(key);
+            if (itr != shard.mItems.end())
+            {
+                shard.mMemoryUsage -= itr->second.mSize;
+                shard.mItems.erase(itr);
+            }
         }
 
         /** Get an ref_ptr<Object> from the object cache*/
         osg::ref_ptr<osg::Object> getRefFromObjectCache(const auto& key)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            if (Item* const item = find(key))
+            Shard& shard = getShard(key);
+            const std::unique_lock lock = lockShard(shard);
+            if (Item* const item = find(shard, key))
                 return item->mValue;
             return nullptr;
         }
 
         std::optional<osg::ref_ptr<osg::Object>> getRefFromObjectCacheOrNone(const auto& key)
         {
-            const std::lock_guard<std::mutex> lock(mMutex);
-            if (Item* const item = find(key))
+            Shard& shard = getShard(key);
+            const std::unique_lock lock = lockShard(shard);
+            if (Item* const item = find(shard, key))
                 return item->mValue;
             return std::nullopt;
         }
@@ -126,8 +205,9 @@ namespace Resource
         /** Check if an object is in the cache, and if it is, update its usage time stamp. */
         bool checkInObjectCache(const auto& key, double timeStamp)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            if (Item* const item = find(key))
+            Shard& shard = getShard(key);
+            const std::unique_lock lock = lockShard(shard);
+            if (Item* const item = find(shard, key))
             {
                 item->mLastUsage = timeStamp;
                 return true;
@@ -138,69 +218,155 @@ namespace Resource
         /** call releaseGLObjects on all objects attached to the object cache.*/
         void releaseGLObjects(osg::State* state)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            for (const auto& [k, v] : mItems)
-                v.mValue->releaseGLObjects(state);
+            for (Shard& shard : mShards)
+            {
+                const std::unique_lock lock = lockShard(shard);
+                for (const auto& [k, v] : shard.mItems)
+                    v.mValue->releaseGLObjects(state);
+            }
         }
 
         /** call node->accept(nv); for all nodes in the objectCache. */
         void accept(osg::NodeVisitor& nv)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            for (const auto& [k, v] : mItems)
-                if (osg::Object* const object = v.mValue.get())
-                    if (osg::Node* const node = dynamic_cast<osg::Node*>(object))
-                        node->accept(nv);
+            for (Shard& shard : mShards)
+            {
+                const std::unique_lock lock = lockShard(shard);
+                for (const auto& [k, v] : shard.mItems)
+                    if (osg::Object* const object = v.mValue.get())
+                        if (osg::Node* const node = dynamic_cast<osg::Node*>(object))
+                            node->accept(nv);
+            }
         }
 
-        /** call operator()(KeyType, osg::Object*) for each object in the cache. */
+        /** call operator()(KeyType, osg::Object*) for each object in the cache. Objects are ordered by key only
+         * within a shard. */
         template <class Functor>
         void call(Functor&& f)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            for (const auto& [k, v] : mItems)
-                f(k, v.mValue.get());
+            for (Shard& shard : mShards)
+            {
+                const std::unique_lock lock = lockShard(shard);
+                for (const auto& [k, v] : shard.mItems)
+                    f(k, v.mValue.get());
+            }
         }
 
         template <class K>
         std::optional<std::pair<KeyType, osg::ref_ptr<osg::Object>>> lowerBound(K&& key)
         {
-            const std::lock_guard<std::mutex> lock(mMutex);
-            const auto it = mItems.lower_bound(std::forward<K>(key));
-            if (it == mItems.end())
-                return std::nullopt;
-            return std::pair(it->first, it->second.mValue);
+            std::optional<std::pair<KeyType, osg::ref_ptr<osg::Object>>> result;
+            for (Shard& shard : mShards)
+            {
+                const std::unique_lock lock = lockShard(shard);
+                const auto it = shard.mItems.lower_bound(key);
+                if (it != shard.mItems.end() && (!result.has_value() || std::less<>()(it->first, result->first)))
+                    result.emplace(it->first, it->second.mValue);
+            }
+            return result;
         }
 
+        /** Set maximum total size of the items in bytes, 0 means no limit. Budget is applied on update. */
+        void setMemoryBudget(std::size_t value) { mMemoryBudget.store(value, std::memory_order_relaxed); }
+
+        std::size_t getMemoryBudget() const { return mMemoryBudget.load(std::memory_order_relaxed); }
+
         CacheStats getStats() const
         {
-            const std::lock_guard<std::mutex> lock(mMutex);
-            return CacheStats{
-                .mSize = mItems.size(),
-                .mGet = mGet,
-                .mHit = mHit,
-                .mExpired = mExpired,
-            };
+            CacheStats result;
+            for (const Shard& shard : mShards)
+            {
+                const std::lock_guard<std::mutex> lock(shard.mMutex);
+                result.mSize += shard.mItems.size();
+                result.mGet += shard.mGet;
+                result.mHit += shard.mHit;
+                result.mExpired += shard.mExpired;
+                result.mMemoryUsage += shard.mMemoryUsage;
+                result.mEvicted += shard.mEvicted;
+                result.mContended += shard.mContended;
+                if constexpr (Shards::sCount > 1)
+                    result.mShardContended.push_back(shard.mContended);
+            }
+            return result;
         }
 
     protected:
         using Item = GenericObjectCacheItem;
+        using Shards = ObjectCacheShards<KeyType>;
+
+        struct Shard
+        {
+            std::map<KeyType, Item, std::less<>> mItems;
+            mutable std::mutex mMutex;
+            std::size_t mGet = 0;
+            std::size_t mHit = 0;
+            std::size_t mExpired = 0;
+            std::size_t mEvicted = 0;
+            std::size_t mContended = 0;
+            std::size_t mMemoryUsage = 0;
+        };
 
-        std::map<KeyType, Item, std::less<>> mItems;
-        mutable std::mutex mMutex;
-        std::size_t mGet = 0;
-        std::size_t mHit = 0;
-        std::size_t mExpired = 0;
+        std::array<Shard, Shards::sCount> mShards;
+        std::atomic_size_t mMemoryBudget{ 0 };
 
-        Item* find(const auto& key)
+        Shard& getShard(const auto& key) { return mShards[Shards::getIndex(key)]; }
+
+        // Counts lock acquisitions that had to wait for another thread.
+        static std::unique_lock<std::mutex> lockShard(Shard& shard)
         {
-            ++mGet;
-            const auto it = mItems.find(key);
-            if (it == mItems.end())
+            std::unique_lock<std::mutex> lock(shard.mMutex, std::try_to_lock);
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+                ++shard.mContended;
+            }
+            return lock;
+        }
+
+        static Item* find(Shard& shard, const auto& key)
+        {
+            ++shard.mGet;
+            const auto it = shard.mItems.find(key);
+            if (it == shard.mItems.end())
                 return nullptr;
-            ++mHit;
+            ++shard.mHit;
             return &it->second;
         }
+
+        // Items referenced from somewhere else are not evicted since it does not free any memory. All shards are
+        // locked at once to pick least recently used items over the whole cache. Other methods lock at most one shard
+        // so locking in the index order can't deadlock.
+        void evict(std::size_t budget, std::vector<osg::ref_ptr<osg::Object>>& objectsToRemove)
+        {
+            std::array<std::unique_lock<std::mutex>, Shards::sCount> locks;
+            std::size_t memoryUsage = 0;
+            for (std::size_t i = 0; i < Shards::sCount; ++i)
+            {
+                locks[i] = lockShard(mShards[i]);
+                memoryUsage += mShards[i].mMemoryUsage;
+            }
+            if (memoryUsage <= budget)
+                return;
+            using Iterator = typename std::map<KeyType, Item, std::less<>>::iterator;
+            std::vector<std::pair<Shard*, Iterator>> candidates;
+            for (Shard& shard : mShards)
+                for (auto it = shard.mItems.begin(); it != shard.mItems.end(); ++it)
+                    if (it->second.mSize != 0 && it->second.mValue->referenceCount() <= 1)
+                        candidates.emplace_back(&shard, it);
+            std::sort(candidates.begin(), candidates.end(), [](const auto& l, const auto& r) {
+                return l.second->second.mLastUsage < r.second->second.mLastUsage;
+            });
+            for (const auto& [shard, it] : candidates)
+            {
+                if (memoryUsage <= budget)
+                    break;
+                ++shard->mEvicted;
+                shard->mMemoryUsage -= it->second.mSize;
+                memoryUsage -= it->second.mSize;
+                objectsToRemove.push_back(std::move(it->second.mValue));
+                shard->mItems.erase(it);
+            }
+        }
     };
 }
 
@@ -3,6 +3,8 @@
 
 #include <osg/ref_ptr>
 
+#include <cstddef>
+
 #include <components/vfs/pathutil.hpp>
 
 #include "objectcache.hpp"
@@ -28,6 +30,7 @@ namespace Resource
         virtual void updateCache(double referenceTime) = 0;
         virtual void clearCache() = 0;
         virtual void setExpiryDelay(double expiryDelay) = 0;
+        virtual void setMemoryBudget(std::size_t value) = 0;
         virtual void reportStats(unsigned int frameNumber, osg::Stats* stats) const = 0;
         virtual void releaseGLObjects(osg::State* state) = 0;
     };
@@ -60,6 +63,10 @@ namespace Resource
         void setExpiryDelay(double expiryDelay) final { mExpiryDelay = expiryDelay; }
         double getExpiryDelay() const { return mExpiryDelay; }
 
+        /// Maximum total size of cached objects in bytes, 0 means no limit. Least recently used objects that are not
+        /// referenced elsewhere are removed on cache update to fit into the budget.
+        void setMemoryBudget(std::size_t value) final { mCache->setMemoryBudget(value); }
+
         const VFS::Manager* getVFS() const { return mVFS; }
 
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override {}
@@ -81,6 +81,13 @@ namespace Resource
         mNifFileManager->setExpiryDelay(0.0);
     }
 
+    void ResourceSystem::setMemoryBudget(std::size_t value)
+    {
+        mMemoryBudget = value;
+        for (BaseResourceManager* manager : mResourceManagers)
+            manager->setMemoryBudget(value);
+    }
+
     void ResourceSystem::updateCache(double referenceTime)
     {
         for (std::vector<BaseResourceManager*>::iterator it = mResourceManagers.begin(); it != mResourceManagers.end();
@@ -97,6 +104,7 @@ namespace Resource
 
     void ResourceSystem::addResourceManager(BaseResourceManager* resourceMgr)
     {
+        resourceMgr->setMemoryBudget(mMemoryBudget);
         mResourceManagers.push_back(resourceMgr);
     }
 
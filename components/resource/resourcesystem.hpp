@@ -1,6 +1,7 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 #define OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -67,6 +68,10 @@ namespace Resource
         /// How long to keep objects in cache after no longer being referenced.
         void setExpiryDelay(double expiryDelay);
 
+        /// Maximum total size of cached objects in bytes for each resource manager, 0 means no limit. Applies to
+        /// resource managers added later as well.
+        void setMemoryBudget(std::size_t value);
+
         /// @note May be called from any thread.
         const VFS::Manager* getVFS() const;
 
@@ -89,6 +94,8 @@ namespace Resource
 
         const VFS::Manager* mVFS;
 
+        std::size_t mMemoryBudget = 0;
+
         ResourceSystem(const ResourceSystem&);
         void operator=(const ResourceSystem&);
     };
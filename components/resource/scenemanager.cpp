@@ -52,7 +52,7 @@
 #include <components/shader/shadervisitor.hpp>
 
 #include <components/files/conversion.hpp>
-#include <components/files/hash.hpp>
+#include <components/files/hashingstreambuf.hpp>
 #include <components/files/memorystream.hpp>
 
 #include "bgsmfilemanager.hpp"
@@ -666,9 +666,9 @@ namespace Resource
             if (isColladaFile)
                 options->setOptionString("daeUseSequencedTextureUnits");
 
-            const std::array<std::uint64_t, 2> fileHash = Files::getHash(normalizedFilename.value(), model);
-
-            osgDB::ReaderWriter::ReadResult result = reader->readNode(model, options);
+            Files::HashingStreamBuf hashingBuffer(model);
+            std::istream hashingStream(&hashingBuffer);
+            osgDB::ReaderWriter::ReadResult result = reader->readNode(hashingStream, options);
             if (!result.success())
             {
                 std::stringstream errormsg;
@@ -677,6 +677,8 @@ namespace Resource
                 throw std::runtime_error(errormsg.str());
             }
 
+            const std::array<std::uint64_t, 2> fileHash = hashingBuffer.finish(normalizedFilename.value());
+
             // Recognize and hide collision node
             unsigned int hiddenNodeMask = 0;
             SceneUtil::FindByNameVisitor nameFinder("Collision");
@@ -21,6 +21,7 @@
 #include <components/vfs/manager.hpp>
 
 #include "cachestats.hpp"
+#include "objectcache.hpp"
 
 namespace Resource
 {
@@ -74,7 +75,7 @@ namespace Resource
                 "",
                 "Lua UsedMemory",
                 "",
-                "",
+                "Deformation Batch",
                 "",
             };
 
@@ -96,6 +97,18 @@ namespace Resource
                 "Blending Rules",
             };
 
+            // Caches with path keys spread over multiple shards
+            constexpr std::string_view shardedCaches[] = {
+                "Node",
+                "Shape",
+                "Image",
+                "Nif",
+                "Keyframe",
+                "BSShader Material",
+                "Terrain Texture",
+                "Blending Rules",
+            };
+
             constexpr std::string_view cellPreloader[] = {
                 "CellPreloader Count",
                 "CellPreloader Added",
@@ -104,6 +117,30 @@ namespace Resource
                 "CellPreloader Expired",
             };
 
+            constexpr std::string_view sound[] = {
+                "Sound Loading",
+                "Sound Compressing",
+                "Sound Decoded",
+                "Sound Decode Time",
+                "Sound DecodedCache Count",
+                "Sound DecodedCache Size",
+                "Sound DecodedCache Get",
+                "Sound DecodedCache Hit",
+            };
+
+            constexpr std::string_view workQueue[] = {
+                "WorkQueue General Items",
+                "WorkQueue General Latency",
+                "WorkQueue Preload Items",
+                "WorkQueue Preload Latency",
+                "WorkQueue Terrain Items",
+                "WorkQueue Terrain Latency",
+                "WorkQueue NavMesh Items",
+                "WorkQueue NavMesh Latency",
+                "WorkQueue Io Items",
+                "WorkQueue Io Latency",
+            };
+
             constexpr std::string_view navMesh[] = {
                 "NavMesh Jobs",
                 "NavMesh Removing",
@@ -131,22 +168,38 @@ namespace Resource
             for (std::string_view name : firstPage)
                 statNames.emplace_back(name);
 
-            for (std::size_t i = 0; i < std::size(caches); ++i)
+            for (std::string_view cache : caches)
             {
-                Resource::addCacheStatsAttibutes(caches[i], statNames);
-                if ((i + 1) % 5 != 0)
-                    statNames.emplace_back();
+                Resource::addCacheStatsAttibutes(cache, statNames);
+                statNames.emplace_back();
             }
 
             for (std::string_view name : cellPreloader)
                 statNames.emplace_back(name);
 
+            statNames.emplace_back();
+
+            for (std::string_view name : sound)
+                statNames.emplace_back(name);
+
+            statNames.emplace_back();
+
+            for (std::string_view name : workQueue)
+                statNames.emplace_back(name);
+
             while (statNames.size() % itemsPerPage != 0)
                 statNames.emplace_back();
 
             for (std::string_view name : navMesh)
                 statNames.emplace_back(name);
 
+            for (std::string_view cache : shardedCaches)
+            {
+                while (statNames.size() % itemsPerPage != 0)
+                    statNames.emplace_back();
+                Resource::addCacheShardStatsAttibutes(cache, ObjectCacheShards<std::string>::sCount, statNames);
+            }
+
             return statNames;
         }
 
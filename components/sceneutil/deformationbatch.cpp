@@ -0,0 +1,109 @@
+#include "deformationbatch.hpp"
+
+#include <components/misc/taskgraphworkers.hpp>
+
+#include <osg/NodeVisitor>
+#include <osg/Stats>
+
+namespace SceneUtil
+{
+    DeformationBatch::DeformationBatch(std::size_t threads)
+        : mWorkers(threads == 0 ? nullptr : std::make_unique<Misc::TaskGraphWorkers>(threads))
+    {
+    }
+
+    DeformationBatch::DeformationBatch(const DeformationBatch& copy, const osg::CopyOp& copyop)
+        : osg::Group(copy, copyop)
+        , mWorkers(copy.mWorkers == nullptr ? nullptr
+                                            : std::make_unique<Misc::TaskGraphWorkers>(copy.mWorkers->size()))
+    {
+    }
+
+    DeformationBatch::~DeformationBatch() = default;
+
+    void DeformationBatch::traverse(osg::NodeVisitor& nv)
+    {
+        if (nv.getVisitorType() != osg::NodeVisitor::CULL_VISITOR)
+        {
+            osg::Group::traverse(nv);
+            return;
+        }
+
+        {
+            const std::lock_guard lock(mMutex);
+            ++mCullTraversals;
+        }
+
+        osg::Group::traverse(nv);
+
+        {
+            const std::lock_guard lock(mMutex);
+            --mCullTraversals;
+        }
+
+        execute();
+    }
+
+    void DeformationBatch::add(std::function<void()>&& function)
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            if (mCullTraversals > 0)
+            {
+                mFunctions.push_back(std::move(function));
+                return;
+            }
+        }
+        function();
+    }
+
+    std::size_t DeformationBatch::getThreadsCount() const
+    {
+        return mWorkers == nullptr ? 0 : mWorkers->size();
+    }
+
+    void DeformationBatch::reportStats(unsigned int frameNumber, osg::Stats& stats)
+    {
+        stats.setAttribute(
+            frameNumber, "Deformation Batch", static_cast<double>(mDeformed.exchange(0, std::memory_order_relaxed)));
+    }
+
+    void DeformationBatch::execute()
+    {
+        // Concurrent cull traversals have to wait for the functions they added to be finished by another one
+        const std::lock_guard executeLock(mExecuteMutex);
+
+        {
+            const std::lock_guard lock(mMutex);
+            mExecuting.swap(mFunctions);
+        }
+
+        if (mExecuting.empty())
+            return;
+
+        mDeformed.fetch_add(mExecuting.size(), std::memory_order_relaxed);
+
+        if (mWorkers == nullptr || mExecuting.size() == 1)
+        {
+            for (const std::function<void()>& function : mExecuting)
+                function();
+        }
+        else
+        {
+            mTaskGraph.clear();
+            mTaskGraph.addTask([&](std::size_t batch) { mExecuting[batch](); }, mExecuting.size());
+            mTaskGraph.start();
+            mWorkers->run(mTaskGraph);
+        }
+
+        mExecuting.clear();
+    }
+
+    DeformationBatch* findDeformationBatch(const osg::NodePath& path)
+    {
+        for (auto it = path.rbegin(); it != path.rend(); ++it)
+            if (DeformationBatch* batch = dynamic_cast<DeformationBatch*>(*it))
+                return batch;
+        return nullptr;
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_DEFORMATIONBATCH_H
+#define OPENMW_COMPONENTS_SCENEUTIL_DEFORMATIONBATCH_H
+
+#include <components/misc/taskgraph.hpp>
+
+#include <osg/Group>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace osg
+{
+    class Stats;
+}
+
+namespace Misc
+{
+    class TaskGraphWorkers;
+}
+
+namespace SceneUtil
+{
+    /// @brief Collects vertex deformation (skinning and morphing) requested during the cull traversal of its children
+    /// and executes it in parallel once the traversal is finished, before anything is drawn.
+    /// @par RigGeometry and MorphGeometry find the closest DeformationBatch in their node path. Without one the
+    /// deformation is done immediately like before. Deformation writes only the internal geometry of the current
+    /// frame which is not used by the draw traversal of the previous frame, so it's safe with DrawThreadPerContext.
+    class DeformationBatch : public osg::Group
+    {
+    public:
+        /// @param threads number of additional threads executing the batch together with the cull thread
+        explicit DeformationBatch(std::size_t threads = 0);
+
+        DeformationBatch(const DeformationBatch& copy, const osg::CopyOp& copyop);
+
+        META_Node(SceneUtil, DeformationBatch)
+
+        void traverse(osg::NodeVisitor& nv) override;
+
+        /// Add deformation to the batch of the current cull traversal or execute it immediately if there is no one.
+        /// Function must only modify the data owned by a single drawable.
+        void add(std::function<void()>&& function);
+
+        std::size_t getThreadsCount() const;
+
+        /// Report number of deformed drawables since the previous call.
+        void reportStats(unsigned int frameNumber, osg::Stats& stats);
+
+    protected:
+        ~DeformationBatch() override;
+
+    private:
+        std::unique_ptr<Misc::TaskGraphWorkers> mWorkers;
+        std::mutex mMutex;
+        std::size_t mCullTraversals = 0;
+        std::vector<std::function<void()>> mFunctions;
+        std::mutex mExecuteMutex;
+        std::vector<std::function<void()>> mExecuting;
+        Misc::TaskGraph mTaskGraph;
+        std::atomic<std::size_t> mDeformed{ 0 };
+
+        void execute();
+    };
+
+    DeformationBatch* findDeformationBatch(const osg::NodePath& path);
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include <cassert>
 #include <components/resource/scenemanager.hpp>
 
+#include "deformationbatch.hpp"
+
 namespace SceneUtil
 {
 
@@ -185,6 +187,18 @@ namespace SceneUtil
         mLastFrameNumber = nv->getTraversalNumber();
         osg::Geometry& geom = *getGeometry(mLastFrameNumber);
 
+        if (DeformationBatch* batch = findDeformationBatch(nv->getNodePath()))
+            batch->add([this, &geom] { morph(geom); });
+        else
+            morph(geom);
+
+        nv->pushOntoNodePath(&geom);
+        nv->apply(geom);
+        nv->popFromNodePath();
+    }
+
+    void MorphGeometry::morph(osg::Geometry& geom) const
+    {
         const osg::Vec3Array* positionSrc = mMorphTargets[0].getOffsets();
         osg::Vec3Array* positionDst = static_cast<osg::Vec3Array*>(geom.getVertexArray());
         assert(positionSrc->size() == positionDst->size());
@@ -204,10 +218,6 @@ namespace SceneUtil
         positionDst->dirty();
 
         geom.osg::Drawable::dirtyGLObjects();
-
-        nv->pushOntoNodePath(&geom);
-        nv->apply(geom);
-        nv->popFromNodePath();
     }
 
     osg::Geometry* MorphGeometry::getGeometry(unsigned int frame) const
@@ -75,6 +75,7 @@ namespace SceneUtil
 
     private:
         void cull(osg::NodeVisitor* nv);
+        void morph(osg::Geometry& geom) const;
 
         MorphTargetList mMorphTargets;
 
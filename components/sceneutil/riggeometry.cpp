@@ -9,7 +9,9 @@
 #include <components/debug/debuglog.hpp>
 #include <components/resource/scenemanager.hpp>
 
+#include "deformationbatch.hpp"
 #include "skeleton.hpp"
+#include "skinning.hpp"
 #include "util.hpp"
 
 namespace SceneUtil
@@ -24,12 +26,19 @@ namespace SceneUtil
     RigGeometry::RigGeometry(const RigGeometry& copy, const osg::CopyOp& copyop)
         : Drawable(copy, copyop)
         , mData(copy.mData)
+        , mSkinningSource(copy.mSkinningSource)
     {
-        setSourceGeometry(copy.mSourceGeometry);
+        initGeometry(copy.mSourceGeometry);
         setNumChildrenRequiringUpdateTraversal(1);
     }
 
     void RigGeometry::setSourceGeometry(osg::ref_ptr<osg::Geometry> sourceGeometry)
+    {
+        initGeometry(std::move(sourceGeometry));
+        updateSkinningSource();
+    }
+
+    void RigGeometry::initGeometry(osg::ref_ptr<osg::Geometry> sourceGeometry)
     {
         for (unsigned int i = 0; i < 2; ++i)
             mGeometry[i] = nullptr;
@@ -93,6 +102,32 @@ namespace SceneUtil
         }
     }
 
+    void RigGeometry::updateSkinningSource()
+    {
+        if (mSourceGeometry == nullptr)
+            return;
+
+        const osg::Vec3Array& positions = static_cast<const osg::Vec3Array&>(*mSourceGeometry->getVertexArray());
+        const osg::Vec3Array* normals = static_cast<const osg::Vec3Array*>(mSourceGeometry->getNormalArray());
+        const osg::Vec4Array* tangents = mSourceTangents;
+
+        auto source = std::make_shared<SkinningSource>();
+        if (mData != nullptr)
+        {
+            std::size_t size = 0;
+            for (const auto& [influences, vertices] : mData->mInfluences)
+                size += vertices.size();
+            source->reserve(size);
+
+            for (const auto& [influences, vertices] : mData->mInfluences)
+                for (unsigned short vertex : vertices)
+                    source->add(vertex, positions[vertex], normals == nullptr ? nullptr : &(*normals)[vertex],
+                        tangents == nullptr ? nullptr : &(*tangents)[vertex]);
+        }
+
+        mSkinningSource = std::move(source);
+    }
+
     osg::ref_ptr<osg::Geometry> RigGeometry::getSourceGeometry() const
     {
         return mSourceGeometry;
@@ -161,11 +196,21 @@ namespace SceneUtil
 
         mSkeleton->updateBoneMatrices(traversalNumber);
 
-        // skinning
-        const osg::Vec3Array* positionSrc = static_cast<osg::Vec3Array*>(mSourceGeometry->getVertexArray());
-        const osg::Vec3Array* normalSrc = static_cast<osg::Vec3Array*>(mSourceGeometry->getNormalArray());
-        const osg::Vec4Array* tangentSrc = mSourceTangents;
+        if (mSkinningSource == nullptr)
+            updateSkinningSource();
+
+        if (DeformationBatch* batch = findDeformationBatch(nv->getNodePath()))
+            batch->add([this, &geom] { skin(geom); });
+        else
+            skin(geom);
 
+        nv->pushOntoNodePath(&geom);
+        nv->apply(geom);
+        nv->popFromNodePath();
+    }
+
+    void RigGeometry::skin(osg::Geometry& geom) const
+    {
         osg::Vec3Array* positionDst = static_cast<osg::Vec3Array*>(geom.getVertexArray());
         osg::Vec3Array* normalDst = static_cast<osg::Vec3Array*>(geom.getNormalArray());
         osg::Vec4Array* tangentDst = static_cast<osg::Vec4Array*>(geom.getTexCoordArray(7));
@@ -181,38 +226,30 @@ namespace SceneUtil
             ++boneInfo;
         }
 
+        const SkinningSource& source = *mSkinningSource;
+        const bool hasNormals = normalDst != nullptr && source.mNormals[0].size() == source.size();
+        const bool hasTangents = tangentDst != nullptr && source.mTangents[0].size() == source.size();
+        osg::Vec3f* const positions = positionDst->empty() ? nullptr : &positionDst->front();
+        osg::Vec3f* const normals = hasNormals && !normalDst->empty() ? &normalDst->front() : nullptr;
+        osg::Vec4f* const tangents = hasTangents && !tangentDst->empty() ? &tangentDst->front() : nullptr;
+
+        std::size_t begin = 0;
         for (const auto& [influences, vertices] : mData->mInfluences)
         {
             osg::Matrixf resultMat(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1);
 
             for (const auto& [index, weight] : influences)
-            {
-                if (mNodes[index] == nullptr)
-                    continue;
-                const float* boneMatPtr = boneMatrices[index].ptr();
-                float* resultMatPtr = resultMat.ptr();
-                for (int i = 0; i < 16; ++i, ++resultMatPtr, ++boneMatPtr)
-                    if (i % 4 != 3)
-                        *resultMatPtr += *boneMatPtr * weight;
-            }
+                if (mNodes[index] != nullptr)
+                    accumulateBoneMatrix(boneMatrices[index], weight, resultMat);
 
             if (mGeomToSkelMatrix)
                 resultMat *= (*mGeomToSkelMatrix);
 
-            for (unsigned short vertex : vertices)
-            {
-                (*positionDst)[vertex] = resultMat.preMult((*positionSrc)[vertex]);
-                if (normalDst)
-                    (*normalDst)[vertex] = osg::Matrixf::transform3x3((*normalSrc)[vertex], resultMat);
-
-                if (tangentDst)
-                {
-                    const osg::Vec4f& srcTangent = (*tangentSrc)[vertex];
-                    osg::Vec3f transformedTangent = osg::Matrixf::transform3x3(
-                        osg::Vec3f(srcTangent.x(), srcTangent.y(), srcTangent.z()), resultMat);
-                    (*tangentDst)[vertex] = osg::Vec4f(transformedTangent, srcTangent.w());
-                }
-            }
+            const std::size_t end = begin + vertices.size();
+            if (end > source.size())
+                break;
+            skinVertices(resultMat, source, begin, end, positions, normals, tangents);
+            begin = end;
         }
 
         positionDst->dirty();
@@ -222,10 +259,6 @@ namespace SceneUtil
             tangentDst->dirty();
 
         geom.osg::Drawable::dirtyGLObjects();
-
-        nv->pushOntoNodePath(&geom);
-        nv->apply(geom);
-        nv->popFromNodePath();
     }
 
     void RigGeometry::updateBounds(osg::NodeVisitor* nv)
@@ -337,6 +370,8 @@ namespace SceneUtil
 
         mData->mInfluences.reserve(influencesToVertices.size());
         mData->mInfluences.assign(influencesToVertices.begin(), influencesToVertices.end());
+
+        updateSkinningSource();
     }
 
     void RigGeometry::setInfluences(const std::vector<BoneWeights>& influences)
@@ -350,6 +385,8 @@ namespace SceneUtil
 
         mData->mInfluences.reserve(influencesToVertices.size());
         mData->mInfluences.assign(influencesToVertices.begin(), influencesToVertices.end());
+
+        updateSkinningSource();
     }
 
     void RigGeometry::accept(osg::NodeVisitor& nv)
@@ -4,10 +4,13 @@
 #include <osg/Geometry>
 #include <osg/Matrixf>
 
+#include <memory>
+
 namespace SceneUtil
 {
     class Skeleton;
     class Bone;
+    struct SkinningSource;
 
     // TODO: This class has a lot of issues.
     // - We require too many workarounds to ensure safety.
@@ -80,8 +83,12 @@ namespace SceneUtil
 
     private:
         void cull(osg::NodeVisitor* nv);
+        void skin(osg::Geometry& geom) const;
         void updateBounds(osg::NodeVisitor* nv);
 
+        void initGeometry(osg::ref_ptr<osg::Geometry> sourceGeometry);
+        void updateSkinningSource();
+
         osg::ref_ptr<osg::Geometry> mGeometry[2];
         osg::Geometry* getGeometry(unsigned int frame) const;
 
@@ -98,6 +105,8 @@ namespace SceneUtil
             std::vector<std::pair<BoneWeights, VertexList>> mInfluences;
         };
         osg::ref_ptr<InfluenceData> mData;
+        // Source vertices ordered by mData->mInfluences, shared with the copies
+        std::shared_ptr<const SkinningSource> mSkinningSource;
         std::vector<Bone*> mNodes;
 
         unsigned int mLastFrameNumber{ 0 };
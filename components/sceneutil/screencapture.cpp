@@ -29,6 +29,7 @@ namespace
             , mContextId(contextId)
         {
             assert(mImpl != nullptr);
+            setCategory(SceneUtil::WorkCategory::Io);
         }
 
         void doWork() override
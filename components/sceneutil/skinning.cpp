@@ -0,0 +1,221 @@
+#include "skinning.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define OPENMW_SKINNING_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define OPENMW_SKINNING_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+namespace SceneUtil
+{
+    namespace
+    {
+        struct Float1
+        {
+            static constexpr std::size_t sSize = 1;
+
+            float mValue;
+
+            static Float1 load(const float* values) { return { *values }; }
+
+            static Float1 broadcast(float value) { return { value }; }
+
+            void store(float* values) const { *values = mValue; }
+
+            friend Float1 operator+(Float1 lhs, Float1 rhs) { return { lhs.mValue + rhs.mValue }; }
+
+            friend Float1 operator*(Float1 lhs, Float1 rhs) { return { lhs.mValue * rhs.mValue }; }
+        };
+
+#if defined(OPENMW_SKINNING_SSE)
+        struct Float4
+        {
+            static constexpr std::size_t sSize = 4;
+
+            __m128 mValue;
+
+            static Float4 load(const float* values) { return { _mm_loadu_ps(values) }; }
+
+            static Float4 broadcast(float value) { return { _mm_set1_ps(value) }; }
+
+            void store(float* values) const { _mm_storeu_ps(values, mValue); }
+
+            friend Float4 operator+(Float4 lhs, Float4 rhs) { return { _mm_add_ps(lhs.mValue, rhs.mValue) }; }
+
+            friend Float4 operator*(Float4 lhs, Float4 rhs) { return { _mm_mul_ps(lhs.mValue, rhs.mValue) }; }
+        };
+#elif defined(OPENMW_SKINNING_NEON)
+        struct Float4
+        {
+            static constexpr std::size_t sSize = 4;
+
+            float32x4_t mValue;
+
+            static Float4 load(const float* values) { return { vld1q_f32(values) }; }
+
+            static Float4 broadcast(float value) { return { vdupq_n_f32(value) }; }
+
+            void store(float* values) const { vst1q_f32(values, mValue); }
+
+            friend Float4 operator+(Float4 lhs, Float4 rhs) { return { vaddq_f32(lhs.mValue, rhs.mValue) }; }
+
+            friend Float4 operator*(Float4 lhs, Float4 rhs) { return { vmulq_f32(lhs.mValue, rhs.mValue) }; }
+        };
+#endif
+
+#ifdef __AVX__
+        struct Float8
+        {
+            static constexpr std::size_t sSize = 8;
+
+            __m256 mValue;
+
+            static Float8 load(const float* values) { return { _mm256_loadu_ps(values) }; }
+
+            static Float8 broadcast(float value) { return { _mm256_set1_ps(value) }; }
+
+            void store(float* values) const { _mm256_storeu_ps(values, mValue); }
+
+            friend Float8 operator+(Float8 lhs, Float8 rhs) { return { _mm256_add_ps(lhs.mValue, rhs.mValue) }; }
+
+            friend Float8 operator*(Float8 lhs, Float8 rhs) { return { _mm256_mul_ps(lhs.mValue, rhs.mValue) }; }
+        };
+#endif
+
+        /// Affine part of the matrix with each element broadcasted to all lanes.
+        template <class T>
+        class SkinningMatrix
+        {
+        public:
+            explicit SkinningMatrix(const osg::Matrixf& matrix)
+            {
+                for (int row = 0; row < 4; ++row)
+                    for (int column = 0; column < 3; ++column)
+                        mElements[row][column] = T::broadcast(matrix(row, column));
+            }
+
+            // Same as osg::Matrixf::preMult for an affine matrix
+            T transform(int column, T x, T y, T z) const
+            {
+                return transform3x3(column, x, y, z) + mElements[3][column];
+            }
+
+            // Same as osg::Matrixf::transform3x3
+            T transform3x3(int column, T x, T y, T z) const
+            {
+                return x * mElements[0][column] + y * mElements[1][column] + z * mElements[2][column];
+            }
+
+        private:
+            T mElements[4][3];
+        };
+
+        /// Skins vertices in batches of T::sSize and returns the beginning of the unprocessed tail.
+        template <class T>
+        std::size_t skinVerticesBatched(const osg::Matrixf& matrix, const SkinningSource& source, std::size_t begin,
+            std::size_t end, osg::Vec3f* positions, osg::Vec3f* normals, osg::Vec4f* tangents)
+        {
+            constexpr std::size_t size = T::sSize;
+            const SkinningMatrix<T> m(matrix);
+            float result[3][size];
+
+            for (; begin + size <= end; begin += size)
+            {
+                const unsigned short* const vertices = source.mVertices.data() + begin;
+
+                {
+                    const T x = T::load(source.mPositions[0].data() + begin);
+                    const T y = T::load(source.mPositions[1].data() + begin);
+                    const T z = T::load(source.mPositions[2].data() + begin);
+                    for (int column = 0; column < 3; ++column)
+                        m.transform(column, x, y, z).store(result[column]);
+                    for (std::size_t i = 0; i < size; ++i)
+                        positions[vertices[i]] = osg::Vec3f(result[0][i], result[1][i], result[2][i]);
+                }
+
+                if (normals != nullptr)
+                {
+                    const T x = T::load(source.mNormals[0].data() + begin);
+                    const T y = T::load(source.mNormals[1].data() + begin);
+                    const T z = T::load(source.mNormals[2].data() + begin);
+                    for (int column = 0; column < 3; ++column)
+                        m.transform3x3(column, x, y, z).store(result[column]);
+                    for (std::size_t i = 0; i < size; ++i)
+                        normals[vertices[i]] = osg::Vec3f(result[0][i], result[1][i], result[2][i]);
+                }
+
+                if (tangents != nullptr)
+                {
+                    const T x = T::load(source.mTangents[0].data() + begin);
+                    const T y = T::load(source.mTangents[1].data() + begin);
+                    const T z = T::load(source.mTangents[2].data() + begin);
+                    for (int column = 0; column < 3; ++column)
+                        m.transform3x3(column, x, y, z).store(result[column]);
+                    const float* const w = source.mTangents[3].data() + begin;
+                    for (std::size_t i = 0; i < size; ++i)
+                        tangents[vertices[i]] = osg::Vec4f(result[0][i], result[1][i], result[2][i], w[i]);
+                }
+            }
+
+            return begin;
+        }
+    }
+
+    void SkinningSource::reserve(std::size_t size)
+    {
+        mVertices.reserve(size);
+        for (std::vector<float>& values : mPositions)
+            values.reserve(size);
+    }
+
+    void SkinningSource::add(
+        unsigned short vertex, const osg::Vec3f& position, const osg::Vec3f* normal, const osg::Vec4f* tangent)
+    {
+        mVertices.push_back(vertex);
+        for (int i = 0; i < 3; ++i)
+            mPositions[i].push_back(position[i]);
+        if (normal != nullptr)
+            for (int i = 0; i < 3; ++i)
+                mNormals[i].push_back((*normal)[i]);
+        if (tangent != nullptr)
+            for (int i = 0; i < 4; ++i)
+                mTangents[i].push_back((*tangent)[i]);
+    }
+
+    void accumulateBoneMatrix(const osg::Matrixf& bone, float weight, osg::Matrixf& result)
+    {
+        const float* bonePtr = bone.ptr();
+        float* resultPtr = result.ptr();
+#if defined(OPENMW_SKINNING_SSE)
+        const __m128 weights = _mm_set_ps(0, weight, weight, weight);
+        for (int row = 0; row < 4; ++row, bonePtr += 4, resultPtr += 4)
+            _mm_storeu_ps(resultPtr, _mm_add_ps(_mm_loadu_ps(resultPtr), _mm_mul_ps(_mm_loadu_ps(bonePtr), weights)));
+#elif defined(OPENMW_SKINNING_NEON)
+        const float32x4_t weights = vsetq_lane_f32(0, vdupq_n_f32(weight), 3);
+        for (int row = 0; row < 4; ++row, bonePtr += 4, resultPtr += 4)
+            vst1q_f32(resultPtr, vmlaq_f32(vld1q_f32(resultPtr), vld1q_f32(bonePtr), weights));
+#else
+        for (int i = 0; i < 16; ++i, ++resultPtr, ++bonePtr)
+            if (i % 4 != 3)
+                *resultPtr += *bonePtr * weight;
+#endif
+    }
+
+    void skinVertices(const osg::Matrixf& matrix, const SkinningSource& source, std::size_t begin, std::size_t end,
+        osg::Vec3f* positions, osg::Vec3f* normals, osg::Vec4f* tangents)
+    {
+#ifdef __AVX__
+        begin = skinVerticesBatched<Float8>(matrix, source, begin, end, positions, normals, tangents);
+#endif
+#if defined(OPENMW_SKINNING_SSE) || defined(OPENMW_SKINNING_NEON)
+        begin = skinVerticesBatched<Float4>(matrix, source, begin, end, positions, normals, tangents);
+#endif
+        skinVerticesBatched<Float1>(matrix, source, begin, end, positions, normals, tangents);
+    }
+}
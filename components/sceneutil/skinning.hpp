@@ -0,0 +1,44 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_SKINNING_H
+#define OPENMW_COMPONENTS_SCENEUTIL_SKINNING_H
+
+#include <osg/Matrixf>
+#include <osg/Vec3f>
+#include <osg/Vec4f>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace SceneUtil
+{
+    /// @brief Source vertex data of a skinned mesh in structure of arrays layout for the vectorised skinning.
+    /// @note Vertices sharing the same bone weights are expected to be added contiguously to be skinned by the same
+    /// matrix.
+    struct SkinningSource
+    {
+        /// Index of each vertex in the geometry arrays
+        std::vector<unsigned short> mVertices;
+        std::array<std::vector<float>, 3> mPositions;
+        std::array<std::vector<float>, 3> mNormals;
+        std::array<std::vector<float>, 4> mTangents;
+
+        void reserve(std::size_t size);
+
+        /// Normals and tangents should be given either for all or for none of the vertices.
+        void add(
+            unsigned short vertex, const osg::Vec3f& position, const osg::Vec3f* normal, const osg::Vec4f* tangent);
+
+        std::size_t size() const { return mVertices.size(); }
+    };
+
+    /// Add the bone matrix multiplied by the weight to the result. Last column of the result is not changed to keep
+    /// the matrix affine.
+    void accumulateBoneMatrix(const osg::Matrixf& bone, float weight, osg::Matrixf& result);
+
+    /// Transform source vertices in [begin, end) range by the affine matrix and write them into the destination arrays
+    /// at the geometry indices. Null normals or tangents destination skips them.
+    void skinVertices(const osg::Matrixf& matrix, const SkinningSource& source, std::size_t begin, std::size_t end,
+        osg::Vec3f* positions, osg::Vec3f* normals, osg::Vec4f* tangents);
+}
+
+#endif
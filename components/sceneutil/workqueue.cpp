@@ -2,10 +2,61 @@
 
 #include <components/debug/debuglog.hpp>
 
+#include <osg/Stats>
+
+#include <algorithm>
 #include <numeric>
+#include <string>
+#include <utility>
 
 namespace SceneUtil
 {
+    namespace
+    {
+        bool isBetter(const osg::ref_ptr<WorkItem>& lhs, std::int64_t lhsOrder, const osg::ref_ptr<WorkItem>& rhs,
+            std::int64_t rhsOrder, const std::optional<osg::Vec3f>& viewPoint)
+        {
+            const int lhsPriority = lhs->getPriority();
+            const int rhsPriority = rhs->getPriority();
+            if (lhsPriority != rhsPriority)
+                return lhsPriority > rhsPriority;
+            if (viewPoint.has_value() && lhs->getPosition().has_value() && rhs->getPosition().has_value())
+            {
+                const float lhsDistance = (*lhs->getPosition() - *viewPoint).length2();
+                const float rhsDistance = (*rhs->getPosition() - *viewPoint).length2();
+                if (lhsDistance != rhsDistance)
+                    return lhsDistance < rhsDistance;
+            }
+            return lhsOrder < rhsOrder;
+        }
+
+        std::string makeStatsName(WorkCategory category, std::string_view suffix)
+        {
+            std::string result = "WorkQueue ";
+            result += getWorkCategoryName(category);
+            result += ' ';
+            result += suffix;
+            return result;
+        }
+    }
+
+    std::string_view getWorkCategoryName(WorkCategory value)
+    {
+        switch (value)
+        {
+            case WorkCategory::General:
+                return "General";
+            case WorkCategory::Preload:
+                return "Preload";
+            case WorkCategory::Terrain:
+                return "Terrain";
+            case WorkCategory::NavMesh:
+                return "NavMesh";
+            case WorkCategory::Io:
+                return "Io";
+        }
+        return "Unknown";
+    }
 
     void WorkItem::waitTillDone()
     {
@@ -33,6 +84,12 @@ namespace SceneUtil
         return mDone;
     }
 
+    void WorkItem::cancel()
+    {
+        mCancelled = true;
+        abort();
+    }
+
     WorkQueue::WorkQueue(std::size_t workerThreads)
         : mIsReleased(false)
     {
@@ -50,16 +107,28 @@ namespace SceneUtil
             const std::lock_guard lock(mMutex);
             mIsReleased = false;
         }
+        // Queues are accessed by the threads without synchronization so can be created only when there are none.
+        if (mThreads.empty())
+        {
+            mQueues.clear();
+            while (mQueues.size() < std::max<std::size_t>(workerThreads, 1))
+                mQueues.push_back(std::make_unique<ThreadQueue>());
+        }
         while (mThreads.size() < workerThreads)
-            mThreads.emplace_back(std::make_unique<WorkThread>(*this));
+            mThreads.emplace_back(std::make_unique<WorkThread>(*this, mThreads.size()));
     }
 
     void WorkQueue::stop()
     {
         {
             std::unique_lock<std::mutex> lock(mMutex);
-            while (!mQueue.empty())
-                mQueue.pop_back();
+            for (const std::unique_ptr<ThreadQueue>& queue : mQueues)
+            {
+                const std::lock_guard queueLock(queue->mMutex);
+                mNumItems -= queue->mItems.size();
+                queue->mItems.clear();
+                queue->mSize = 0;
+            }
             mIsReleased = true;
             mCondition.notify_all();
         }
@@ -75,34 +144,112 @@ namespace SceneUtil
             return;
         }
 
-        std::unique_lock<std::mutex> lock(mMutex);
-        if (front)
-            mQueue.push_front(std::move(item));
-        else
-            mQueue.push_back(std::move(item));
+        const std::int64_t order = front ? -++mNextFrontOrder : ++mNextBackOrder;
+
+        const auto queue = std::min_element(mQueues.begin(), mQueues.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs->mSize < rhs->mSize; });
+
+        {
+            // Increment under mMutex to not miss a wakeup of a thread checking for the items. The counter is
+            // decremented by takeWorkItem under the queue lock so it has to be incremented under the same lock before
+            // the item can be taken to never go below zero.
+            const std::lock_guard lock(mMutex);
+            const std::lock_guard queueLock((*queue)->mMutex);
+            ++mNumItems;
+            (*queue)->mItems.push_back(QueuedItem{ std::move(item), order, std::chrono::steady_clock::now() });
+            ++(*queue)->mSize;
+        }
         mCondition.notify_one();
     }
 
-    osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem()
+    osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem(std::size_t threadIndex)
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        while (mQueue.empty() && !mIsReleased)
+        while (true)
         {
-            mCondition.wait(lock);
+            if (std::optional<QueuedItem> queued = takeWorkItem(threadIndex))
+            {
+                const auto latency = std::chrono::steady_clock::now() - queued->mQueuedAt;
+                {
+                    const std::lock_guard lock(mStatsMutex);
+                    CategoryStats& stats = mStats[static_cast<std::size_t>(queued->mItem->getCategory())];
+                    ++stats.mItems;
+                    stats.mLatency += latency;
+                }
+                return std::move(queued->mItem);
+            }
+
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [&] { return mNumItems > 0 || mIsReleased; });
+            if (mIsReleased)
+                return nullptr;
         }
-        if (!mQueue.empty())
+    }
+
+    std::optional<WorkQueue::QueuedItem> WorkQueue::takeWorkItem(std::size_t threadIndex)
+    {
+        std::optional<osg::Vec3f> viewPoint;
+        {
+            const std::lock_guard lock(mViewPointMutex);
+            viewPoint = mViewPoint;
+        }
+
+        std::vector<osg::ref_ptr<WorkItem>> cancelled;
+        std::optional<QueuedItem> result;
+
+        // Own queue goes first, others are checked only when it's empty
+        for (std::size_t i = 0; i < mQueues.size() && !result.has_value(); ++i)
+            result = takeWorkItem(*mQueues[(threadIndex + i) % mQueues.size()], viewPoint, cancelled);
+
+        for (const osg::ref_ptr<WorkItem>& item : cancelled)
+            item->signalDone();
+
+        return result;
+    }
+
+    std::optional<WorkQueue::QueuedItem> WorkQueue::takeWorkItem(ThreadQueue& queue,
+        const std::optional<osg::Vec3f>& viewPoint, std::vector<osg::ref_ptr<WorkItem>>& cancelled)
+    {
+        if (queue.mSize == 0)
+            return std::nullopt;
+
+        const std::lock_guard lock(queue.mMutex);
+
+        std::erase_if(queue.mItems, [&](QueuedItem& v) {
+            if (!v.mItem->isCancelled())
+                return false;
+            cancelled.push_back(std::move(v.mItem));
+            return true;
+        });
+
+        const auto best = std::min_element(queue.mItems.begin(), queue.mItems.end(),
+            [&](const QueuedItem& lhs, const QueuedItem& rhs) {
+                return isBetter(lhs.mItem, lhs.mOrder, rhs.mItem, rhs.mOrder, viewPoint);
+            });
+
+        std::optional<QueuedItem> result;
+        if (best != queue.mItems.end())
         {
-            osg::ref_ptr<WorkItem> item = std::move(mQueue.front());
-            mQueue.pop_front();
-            return item;
+            result = std::move(*best);
+            *best = std::move(queue.mItems.back());
+            queue.mItems.pop_back();
         }
-        return nullptr;
+
+        const std::size_t removed = queue.mSize - queue.mItems.size();
+        queue.mSize = queue.mItems.size();
+        mNumItems -= removed;
+
+        return result;
+    }
+
+    void WorkQueue::setViewPoint(const osg::Vec3f& value)
+    {
+        const std::lock_guard lock(mViewPointMutex);
+        mViewPoint = value;
     }
 
     unsigned int WorkQueue::getNumItems() const
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        return mQueue.size();
+        return mNumItems;
     }
 
     unsigned int WorkQueue::getNumActiveThreads() const
@@ -111,8 +258,32 @@ namespace SceneUtil
             mThreads.begin(), mThreads.end(), 0u, [](auto r, const auto& t) { return r + t->isActive(); });
     }
 
-    WorkThread::WorkThread(WorkQueue& workQueue)
+    void WorkQueue::reportStats(unsigned int frameNumber, osg::Stats& stats)
+    {
+        stats.setAttribute(frameNumber, "WorkQueue", getNumItems());
+        stats.setAttribute(frameNumber, "WorkThread", getNumActiveThreads());
+
+        std::array<CategoryStats, workCategoriesCount> categories;
+        {
+            const std::lock_guard lock(mStatsMutex);
+            categories = std::exchange(mStats, {});
+        }
+
+        for (std::size_t i = 0; i < categories.size(); ++i)
+        {
+            const WorkCategory category = static_cast<WorkCategory>(i);
+            const CategoryStats& value = categories[i];
+            const double latency = value.mItems == 0
+                ? 0.0
+                : std::chrono::duration<double, std::milli>(value.mLatency).count() / value.mItems;
+            stats.setAttribute(frameNumber, makeStatsName(category, "Items"), static_cast<double>(value.mItems));
+            stats.setAttribute(frameNumber, makeStatsName(category, "Latency"), latency);
+        }
+    }
+
+    WorkThread::WorkThread(WorkQueue& workQueue, std::size_t index)
         : mWorkQueue(&workQueue)
+        , mIndex(index)
         , mActive(false)
         , mThread([this] { run(); })
     {
@@ -127,11 +298,12 @@ namespace SceneUtil
     {
         while (true)
         {
-            osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem();
+            osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem(mIndex);
             if (!item)
                 return;
             mActive = true;
-            item->doWork();
+            if (!item->isCancelled())
+                item->doWork();
             item->signalDone();
             mActive = false;
         }
@@ -2,17 +2,41 @@
 #define OPENMW_COMPONENTS_SCENEUTIL_WORKQUEUE_H
 
 #include <osg/Referenced>
+#include <osg/Vec3f>
 #include <osg/ref_ptr>
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <deque>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <string_view>
 #include <thread>
 #include <vector>
 
+namespace osg
+{
+    class Stats;
+}
+
 namespace SceneUtil
 {
+    /// Used to group queue latency stats.
+    enum class WorkCategory
+    {
+        General,
+        Preload,
+        Terrain,
+        NavMesh,
+        Io,
+    };
+
+    inline constexpr std::size_t workCategoriesCount = 5;
+
+    std::string_view getWorkCategoryName(WorkCategory value);
 
     class WorkItem : public osg::Referenced
     {
@@ -31,8 +55,34 @@ namespace SceneUtil
         /// Set abort flag in order to return from doWork() as soon as possible. May not be respected by all WorkItems.
         virtual void abort() {}
 
+        /// Drop the item from the queue without calling doWork() if it is not started yet, otherwise abort().
+        /// The item is signaled as done in both cases.
+        void cancel();
+
+        bool isCancelled() const { return mCancelled; }
+
+        /// Items with higher priority are taken from the same thread queue first. May be changed while the item is
+        /// queued.
+        void setPriority(int value) { mPriority = value; }
+
+        int getPriority() const { return mPriority; }
+
+        /// Items with the same priority are taken in order of the distance from the position to the queue view point.
+        /// Should be set before the item is added to the queue.
+        void setPosition(const osg::Vec3f& value) { mPosition = value; }
+
+        const std::optional<osg::Vec3f>& getPosition() const { return mPosition; }
+
+        void setCategory(WorkCategory value) { mCategory = value; }
+
+        WorkCategory getCategory() const { return mCategory; }
+
     private:
         std::atomic_bool mDone{ false };
+        std::atomic_bool mCancelled{ false };
+        std::atomic_int mPriority{ 0 };
+        std::optional<osg::Vec3f> mPosition;
+        WorkCategory mCategory = WorkCategory::General;
         std::mutex mMutex;
         std::condition_variable mCondition;
     };
@@ -40,8 +90,10 @@ namespace SceneUtil
     class WorkThread;
 
     /// @brief A work queue that users can push work items onto, to be completed by one or more background threads.
-    /// @note Work items will be processed in the order that they were given in, however
-    /// if multiple work threads are involved then it is possible for a later item to complete before earlier items.
+    /// @note Each thread has own queue. Items are added to the shortest one and a thread with empty queue steals items
+    /// from others. Within a queue items are taken by priority, then by the distance to the view point, then in the
+    /// order that they were given in. The order is not global: a thread takes the best item from its own queue even
+    /// when another queue has an item with higher priority. Different threads may complete items in any order.
     class WorkQueue : public osg::Referenced
     {
     public:
@@ -54,33 +106,73 @@ namespace SceneUtil
 
         /// Add a new work item to the back of the queue.
         /// @par The work item's waitTillDone() method may be used by the caller to wait until the work is complete.
-        /// @param front If true, add item to the front of the queue. If false (default), add to the back.
+        /// @param front If true, add item before other items with the same priority. If false (default), add after.
         void addWorkItem(osg::ref_ptr<WorkItem> item, bool front = false);
 
-        /// Get the next work item from the front of the queue. If the queue is empty, waits until a new item is added.
-        /// If the workqueue is in the process of being destroyed, may return nullptr.
+        /// Get the next work item from the thread own queue or steal it from other threads. If all queues are empty,
+        /// waits until a new item is added. If the workqueue is in the process of being destroyed, may return nullptr.
         /// @par Used internally by the WorkThread.
-        osg::ref_ptr<WorkItem> removeWorkItem();
+        osg::ref_ptr<WorkItem> removeWorkItem(std::size_t threadIndex);
+
+        /// Position used to order items with the same priority, usually the player position.
+        void setViewPoint(const osg::Vec3f& value);
 
         unsigned int getNumItems() const;
 
         unsigned int getNumActiveThreads() const;
 
+        /// Report number of taken items and average time they spent in the queue per category since the last call.
+        void reportStats(unsigned int frameNumber, osg::Stats& stats);
+
     private:
+        struct QueuedItem
+        {
+            osg::ref_ptr<WorkItem> mItem;
+            std::int64_t mOrder;
+            std::chrono::steady_clock::time_point mQueuedAt;
+        };
+
+        struct ThreadQueue
+        {
+            std::mutex mMutex;
+            std::vector<QueuedItem> mItems;
+            std::atomic_size_t mSize{ 0 };
+        };
+
+        struct CategoryStats
+        {
+            std::size_t mItems = 0;
+            std::chrono::steady_clock::duration mLatency{};
+        };
+
         bool mIsReleased;
-        std::deque<osg::ref_ptr<WorkItem>> mQueue;
+        std::vector<std::unique_ptr<ThreadQueue>> mQueues;
+        std::atomic_size_t mNumItems{ 0 };
+        std::atomic<std::int64_t> mNextBackOrder{ 0 };
+        std::atomic<std::int64_t> mNextFrontOrder{ 0 };
 
         mutable std::mutex mMutex;
         std::condition_variable mCondition;
 
+        std::mutex mViewPointMutex;
+        std::optional<osg::Vec3f> mViewPoint;
+
+        std::mutex mStatsMutex;
+        std::array<CategoryStats, workCategoriesCount> mStats;
+
         std::vector<std::unique_ptr<WorkThread>> mThreads;
+
+        std::optional<QueuedItem> takeWorkItem(std::size_t threadIndex);
+
+        std::optional<QueuedItem> takeWorkItem(ThreadQueue& queue, const std::optional<osg::Vec3f>& viewPoint,
+            std::vector<osg::ref_ptr<WorkItem>>& cancelled);
     };
 
     /// Internally used by WorkQueue.
     class WorkThread
     {
     public:
-        WorkThread(WorkQueue& workQueue);
+        WorkThread(WorkQueue& workQueue, std::size_t index);
 
         ~WorkThread();
 
@@ -88,6 +180,7 @@ namespace SceneUtil
 
     private:
         WorkQueue* mWorkQueue;
+        std::size_t mIndex;
         std::atomic<bool> mActive;
         std::thread mThread;
 
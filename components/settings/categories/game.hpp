@@ -29,6 +29,7 @@ namespace Settings
         // complete (bug #1876)
         SettingValue<int> mActorsProcessingRange{ mIndex, "Game", "actors processing range",
             makeClampSanitizerInt(3584, 7168) };
+        SettingValue<int> mAiThinkNumThreads{ mIndex, "Game", "ai think num threads", makeMaxSanitizerInt(0) };
         SettingValue<bool> mClassicReflectedAbsorbSpellsBehavior{ mIndex, "Game",
             "classic reflected absorb spells behavior" };
         SettingValue<bool> mClassicCalmSpellsBehavior{ mIndex, "Game", "classic calm spells behavior" };
@@ -32,6 +32,11 @@ namespace Settings
         SettingValue<bool> mGmstOverridesL10n{ mIndex, "General", "gmst overrides l10n" };
         SettingValue<std::size_t> mLogBufferSize{ mIndex, "General", "log buffer size" };
         SettingValue<std::size_t> mConsoleHistoryBufferSize{ mIndex, "General", "console history buffer size" };
+        SettingValue<int> mContentLoadingNumThreads{ mIndex, "General", "content loading num threads",
+            makeMaxSanitizerInt(0) };
+        SettingValue<int> mSkinningNumThreads{ mIndex, "General", "skinning num threads", makeMaxSanitizerInt(0) };
+        SettingValue<int> mScriptPrecompileNumThreads{ mIndex, "General", "script precompile num threads",
+            makeMaxSanitizerInt(0) };
     };
 }
 
@@ -21,6 +21,7 @@ namespace Settings
         SettingValue<float> mVoiceVolume{ mIndex, "Sound", "voice volume", makeClampSanitizerFloat(0, 1) };
         SettingValue<int> mBufferCacheMin{ mIndex, "Sound", "buffer cache min", makeMaxSanitizerInt(1) };
         SettingValue<int> mBufferCacheMax{ mIndex, "Sound", "buffer cache max", makeMaxSanitizerInt(1) };
+        SettingValue<int> mDecodedCacheMax{ mIndex, "Sound", "decoded cache max", makeMaxSanitizerInt(0) };
         SettingValue<HrtfMode> mHrtfEnable{ mIndex, "Sound", "hrtf enable" };
         SettingValue<std::string> mHrtf{ mIndex, "Sound", "hrtf" };
         SettingValue<bool> mCameraListener{ mIndex, "Sound", "camera listener" };
@@ -43,17 +43,21 @@ namespace VFS
         {
             mFile = std::make_unique<BSAFileType>();
             mFile->open(filename);
+            init();
+        }
 
-            const Bsa::BSAFile::FileList& filelist = mFile->getList();
-            for (Bsa::BSAFile::FileList::const_iterator it = filelist.begin(); it != filelist.end(); ++it)
-            {
-                mResources.emplace_back(&*it, mFile.get());
-                mFiles.emplace_back(it->name());
-            }
-
-            std::sort(mFiles.begin(), mFiles.end());
+        /// Skips reading the archive header, supported only by uncompressed BSA.
+        BsaArchive(const std::filesystem::path& filename, const Bsa::BSAFile::FileList& files,
+            const std::vector<char>& names)
+            : Archive()
+        {
+            mFile = std::make_unique<BSAFileType>();
+            mFile->open(filename, files, names);
+            init();
         }
 
+        const BSAFileType& getBsaFile() const { return *mFile; }
+
         void listResources(FileMap& out) override
         {
             for (auto& resource : mResources)
@@ -71,6 +75,20 @@ namespace VFS
         std::unique_ptr<BSAFileType> mFile;
         std::vector<BsaArchiveFile<BSAFileType>> mResources;
         std::vector<VFS::Path::Normalized> mFiles;
+
+        void init()
+        {
+            mFile->mapIntoMemory();
+
+            const Bsa::BSAFile::FileList& filelist = mFile->getList();
+            for (Bsa::BSAFile::FileList::const_iterator it = filelist.begin(); it != filelist.end(); ++it)
+            {
+                mResources.emplace_back(&*it, mFile.get());
+                mFiles.emplace_back(it->name());
+            }
+
+            std::sort(mFiles.begin(), mFiles.end());
+        }
     };
 
     inline std::unique_ptr<VFS::Archive> makeBsaArchive(const std::filesystem::path& path)
@@ -0,0 +1,68 @@
+#include "fileindex.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "pathutil.hpp"
+
+namespace VFS
+{
+    namespace
+    {
+        constexpr std::size_t minCapacity = 16;
+
+        bool isEmpty(std::string_view path)
+        {
+            return path.data() == nullptr;
+        }
+    }
+
+    void FileIndex::build(const FileMap& files)
+    {
+        clear();
+
+        if (files.empty())
+            return;
+
+        // Keep load factor not greater than 0.5 to make probe sequences short
+        const std::size_t capacity = std::max(minCapacity, std::bit_ceil(files.size() * 2));
+        mSlots.resize(capacity);
+        mMask = capacity - 1;
+
+        for (const auto& [path, file] : files)
+        {
+            const std::string_view view = path.view();
+            const std::size_t hash = Path::Hash{}(view);
+            std::size_t i = hash & mMask;
+            while (!isEmpty(mSlots[i].mPath))
+                i = (i + 1) & mMask;
+            mSlots[i] = Entry{ .mHash = hash, .mPath = view, .mFile = file };
+        }
+
+        mSize = files.size();
+    }
+
+    void FileIndex::clear()
+    {
+        mSlots.clear();
+        mMask = 0;
+        mSize = 0;
+    }
+
+    const FileIndex::Entry* FileIndex::find(std::string_view path) const
+    {
+        if (mSlots.empty())
+            return nullptr;
+
+        const std::size_t hash = Path::Hash{}(path);
+
+        for (std::size_t i = hash & mMask;; i = (i + 1) & mMask)
+        {
+            const Entry& slot = mSlots[i];
+            if (isEmpty(slot.mPath))
+                return nullptr;
+            if (slot.mHash == hash && slot.mPath == path)
+                return &slot;
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef OPENMW_COMPONENTS_VFS_FILEINDEX_H
+#define OPENMW_COMPONENTS_VFS_FILEINDEX_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "filemap.hpp"
+
+namespace VFS
+{
+    class File;
+
+    /// @brief Open addressing hash table with linear probing over the keys of a FileMap.
+    /// @par Keeps precomputed path hashes next to the keys so probing compares strings only on hash match.
+    /// Keys are views into the FileMap keys, so the FileMap must outlive the index and must not be modified
+    /// until the index is rebuilt or cleared.
+    class FileIndex
+    {
+    public:
+        struct Entry
+        {
+            std::size_t mHash = 0;
+            // Empty slot has nullptr data
+            std::string_view mPath;
+            File* mFile = nullptr;
+        };
+
+        void build(const FileMap& files);
+
+        void clear();
+
+        std::size_t size() const { return mSize; }
+
+        bool contains(std::string_view path) const { return find(path) != nullptr; }
+
+        // Returns nullptr if there is no such file
+        const Entry* find(std::string_view path) const;
+
+    private:
+        std::vector<Entry> mSlots;
+        std::size_t mMask = 0;
+        std::size_t mSize = 0;
+    };
+}
+
+#endif
@@ -10,47 +10,87 @@
 
 namespace VFS
 {
+    namespace
+    {
+        std::int64_t getModificationTime(const std::filesystem::path& path, std::error_code& ec)
+        {
+            return static_cast<std::int64_t>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+        }
+    }
 
-    FileSystemArchive::FileSystemArchive(const std::filesystem::path& path)
-        : mPath(path)
+    DirectoryListing listDirectory(const std::filesystem::path& path)
     {
-        const auto str = mPath.u8string();
+        DirectoryListing result;
+
+        const auto str = path.u8string();
         std::size_t prefix = str.size();
 
         if (prefix > 0 && str[prefix - 1] != '\\' && str[prefix - 1] != '/')
             ++prefix;
 
-        std::filesystem::recursive_directory_iterator iterator(mPath);
+        std::error_code ec;
+        result.mDirectories.push_back(
+            DirectoryStamp{ .mPath = {}, .mModificationTime = getModificationTime(path, ec) });
+
+        std::filesystem::recursive_directory_iterator iterator(path);
 
         for (auto it = std::filesystem::begin(iterator), end = std::filesystem::end(iterator); it != end;)
         {
             const std::filesystem::directory_entry& entry = *it;
 
+            const std::string proper = Files::pathToUnicodeString(entry.path());
+            std::string relative(std::string_view{ proper }.substr(prefix));
+
             if (!entry.is_directory())
-            {
-                const std::filesystem::path& filePath = entry.path();
-                const std::string proper = Files::pathToUnicodeString(filePath);
-                VFS::Path::Normalized searchable(std::string_view{ proper }.substr(prefix));
-                FileSystemArchiveFile file(filePath);
-
-                const auto inserted = mIndex.emplace(std::move(searchable), std::move(file));
-                if (!inserted.second)
-                    Log(Debug::Warning)
-                        << "Found duplicate file for '" << proper
-                        << "', please check your file system for two files with the same name in different cases.";
-            }
+                result.mFiles.push_back(std::move(relative));
+            else
+                result.mDirectories.push_back(DirectoryStamp{
+                    .mPath = std::move(relative), .mModificationTime = getModificationTime(entry.path(), ec) });
 
             // Exception thrown by the operator++ may not contain the context of the error like what exact path caused
             // the problem which makes it hard to understand what's going on when iteration happens over a directory
             // with thousands of files and subdirectories.
             const std::filesystem::path prevPath = entry.path();
-            std::error_code ec;
             it.increment(ec);
             if (ec != std::error_code())
-                throw std::runtime_error("Failed to recursively iterate over \"" + Files::pathToUnicodeString(mPath)
+                throw std::runtime_error("Failed to recursively iterate over \"" + Files::pathToUnicodeString(path)
                     + "\" when incrementing to the next item from \"" + Files::pathToUnicodeString(prevPath)
                     + "\": " + ec.message());
         }
+
+        return result;
+    }
+
+    bool isUpToDate(const std::filesystem::path& path, const DirectoryListing& listing)
+    {
+        for (const DirectoryStamp& directory : listing.mDirectories)
+        {
+            std::error_code ec;
+            const std::int64_t modificationTime
+                = getModificationTime(path / Files::pathFromUnicodeString(directory.mPath), ec);
+            if (ec != std::error_code() || modificationTime != directory.mModificationTime)
+                return false;
+        }
+        return !listing.mDirectories.empty();
+    }
+
+    FileSystemArchive::FileSystemArchive(const std::filesystem::path& path)
+        : FileSystemArchive(path, listDirectory(path))
+    {
+    }
+
+    FileSystemArchive::FileSystemArchive(const std::filesystem::path& path, const DirectoryListing& listing)
+        : mPath(path)
+    {
+        for (const std::string& file : listing.mFiles)
+        {
+            const std::filesystem::path filePath = mPath / Files::pathFromUnicodeString(file);
+            const auto inserted = mIndex.emplace(VFS::Path::Normalized(file), FileSystemArchiveFile(filePath));
+            if (!inserted.second)
+                Log(Debug::Warning)
+                    << "Found duplicate file for '" << Files::pathToUnicodeString(filePath)
+                    << "', please check your file system for two files with the same name in different cases.";
+        }
     }
 
     void FileSystemArchive::listResources(FileMap& out)
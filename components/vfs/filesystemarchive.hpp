@@ -4,12 +4,35 @@
 #include "archive.hpp"
 #include "file.hpp"
 
+#include <cstdint>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace VFS
 {
 
+    struct DirectoryStamp
+    {
+        // Path relative to the data directory, empty for the data directory itself
+        std::string mPath;
+        std::int64_t mModificationTime = 0;
+    };
+
+    /// Result of a recursive data directory scan.
+    struct DirectoryListing
+    {
+        // Paths relative to the data directory
+        std::vector<std::string> mFiles;
+        // Modification time of each directory changes when its entries are added, removed or renamed
+        std::vector<DirectoryStamp> mDirectories;
+    };
+
+    DirectoryListing listDirectory(const std::filesystem::path& path);
+
+    /// Checks whether none of the listed directories has been modified since the listing was made.
+    bool isUpToDate(const std::filesystem::path& path, const DirectoryListing& listing);
+
     class FileSystemArchiveFile : public File
     {
     public:
@@ -28,6 +51,8 @@ namespace VFS
     public:
         FileSystemArchive(const std::filesystem::path& path);
 
+        FileSystemArchive(const std::filesystem::path& path, const DirectoryListing& listing);
+
         void listResources(FileMap& out) override;
 
         bool contains(Path::NormalizedView file) const override;
@@ -0,0 +1,212 @@
+#include "indexcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/files/conversion.hpp>
+#include <components/files/temporarypath.hpp>
+#include <components/serialization/binaryreader.hpp>
+#include <components/serialization/binarywriter.hpp>
+#include <components/serialization/format.hpp>
+#include <components/serialization/sizeaccumulator.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace VFS
+{
+    namespace
+    {
+        constexpr char indexCacheMagic[] = { 'v', 'f', 's', 'i' };
+        constexpr std::uint32_t indexCacheVersion = 1;
+
+        template <Serialization::Mode mode>
+        struct Format : Serialization::Format<mode, Format<mode>>
+        {
+            using Serialization::Format<mode, Format<mode>>::operator();
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, std::string>>
+            {
+                if constexpr (mode == Serialization::Mode::Write)
+                    visitor(*this, static_cast<std::uint64_t>(value.size()));
+                else
+                {
+                    static_assert(mode == Serialization::Mode::Read);
+                    std::uint64_t size = 0;
+                    visitor(*this, size);
+                    value.resize(static_cast<std::size_t>(size));
+                }
+                visitor(*this, value.data(), value.size());
+            }
+
+            template <class Visitor, class Key, class Value>
+            void operator()(Visitor&& visitor, const std::map<Key, Value, std::less<>>& value) const
+            {
+                static_assert(mode == Serialization::Mode::Write);
+                visitor(*this, static_cast<std::uint64_t>(value.size()));
+                for (const auto& [k, v] : value)
+                {
+                    visitor(*this, k);
+                    visitor(*this, v);
+                }
+            }
+
+            template <class Visitor, class Key, class Value>
+            void operator()(Visitor&& visitor, std::map<Key, Value, std::less<>>& value) const
+            {
+                static_assert(mode == Serialization::Mode::Read);
+                std::uint64_t size = 0;
+                visitor(*this, size);
+                for (std::uint64_t i = 0; i < size; ++i)
+                {
+                    Key key;
+                    visitor(*this, key);
+                    visitor(*this, value[std::move(key)]);
+                }
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, FileStamp>>
+            {
+                visitor(*this, value.mSize);
+                visitor(*this, value.mModificationTime);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, DirectoryStamp>>
+            {
+                visitor(*this, value.mPath);
+                visitor(*this, value.mModificationTime);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, DirectoryListing>>
+            {
+                visitor(*this, value.mFiles);
+                visitor(*this, value.mDirectories);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, Bsa::BSAFile::FileStruct>>
+            {
+                visitor(*this, value.fileSize);
+                visitor(*this, value.offset);
+                visitor(*this, value.hash.low);
+                visitor(*this, value.hash.high);
+                visitor(*this, value.namesOffset);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, BsaListing>>
+            {
+                visitor(*this, value.mStamp);
+                visitor(*this, value.mFiles);
+                visitor(*this, value.mNames);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, IndexCache>>
+            {
+                if constexpr (mode == Serialization::Mode::Write)
+                {
+                    visitor(*this, indexCacheMagic);
+                    visitor(*this, indexCacheVersion);
+                }
+                else
+                {
+                    static_assert(mode == Serialization::Mode::Read);
+                    char magic[std::size(indexCacheMagic)];
+                    visitor(*this, magic);
+                    if (std::memcmp(magic, indexCacheMagic, sizeof(magic)) != 0)
+                        throw std::runtime_error("Bad VFS index cache magic");
+                    std::uint32_t version = 0;
+                    visitor(*this, version);
+                    if (version != indexCacheVersion)
+                        throw std::runtime_error("Bad VFS index cache version");
+                }
+                visitor(*this, value.mDirectories);
+                visitor(*this, value.mBsas);
+            }
+        };
+    }
+
+    std::optional<FileStamp> getFileStamp(const std::filesystem::path& path)
+    {
+        std::error_code ec;
+        const std::uintmax_t size = std::filesystem::file_size(path, ec);
+        if (ec != std::error_code())
+            return std::nullopt;
+        const auto modificationTime = std::filesystem::last_write_time(path, ec);
+        if (ec != std::error_code())
+            return std::nullopt;
+        return FileStamp{
+            .mSize = static_cast<std::uint64_t>(size),
+            .mModificationTime = static_cast<std::int64_t>(modificationTime.time_since_epoch().count()),
+        };
+    }
+
+    IndexCache readIndexCache(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios_base::binary);
+        if (!stream.is_open())
+            return {};
+
+        try
+        {
+            std::vector<char> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+            const std::byte* const begin = reinterpret_cast<const std::byte*>(data.data());
+            IndexCache result;
+            constexpr Format<Serialization::Mode::Read> format;
+            format(Serialization::BinaryReader(begin, begin + data.size()), result);
+            return result;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read VFS index cache " << path << ": " << e.what();
+            return {};
+        }
+    }
+
+    void writeIndexCache(const IndexCache& cache, const std::filesystem::path& path)
+    {
+        constexpr Format<Serialization::Mode::Write> format;
+        Serialization::SizeAccumulator sizeAccumulator;
+        format(sizeAccumulator, cache);
+        std::vector<std::byte> data(sizeAccumulator.value());
+        format(Serialization::BinaryWriter(data.data(), data.data() + data.size()), cache);
+
+        std::filesystem::create_directories(path.parent_path());
+
+        // Several processes may update the cache at the same time
+        const std::filesystem::path temporaryPath = Files::makeTemporaryPath(path);
+
+        try
+        {
+            {
+                std::ofstream stream(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+                stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+                if (!stream.good())
+                    throw std::runtime_error(
+                        "Failed to write VFS index cache " + Files::pathToUnicodeString(temporaryPath));
+            }
+
+            std::filesystem::rename(temporaryPath, path);
+        }
+        catch (...)
+        {
+            std::error_code ec;
+            std::filesystem::remove(temporaryPath, ec);
+            throw;
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef OPENMW_COMPONENTS_VFS_INDEXCACHE_H
+#define OPENMW_COMPONENTS_VFS_INDEXCACHE_H
+
+#include "filesystemarchive.hpp"
+
+#include <components/bsa/bsa_file.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace VFS
+{
+    struct FileStamp
+    {
+        std::uint64_t mSize = 0;
+        std::int64_t mModificationTime = 0;
+
+        friend bool operator==(const FileStamp& lhs, const FileStamp& rhs) = default;
+    };
+
+    /// Returns nullopt if file doesn't exist or its attributes can't be read.
+    std::optional<FileStamp> getFileStamp(const std::filesystem::path& path);
+
+    /// File table of an uncompressed (Morrowind) BSA archive.
+    struct BsaListing
+    {
+        FileStamp mStamp;
+        Bsa::BSAFile::FileList mFiles;
+        std::vector<char> mNames;
+    };
+
+    /// @brief Snapshot of the archives content used to build VFS index without rescanning data directories and
+    /// parsing archive headers when nothing has changed since the previous run.
+    /// @par Keys are UTF-8 paths of data directories and archives.
+    struct IndexCache
+    {
+        std::map<std::string, DirectoryListing, std::less<>> mDirectories;
+        std::map<std::string, BsaListing, std::less<>> mBsas;
+    };
+
+    /// Returns empty cache if the file doesn't exist or can't be read.
+    IndexCache readIndexCache(const std::filesystem::path& path);
+
+    /// Replaces the file atomically to avoid partially written snapshot.
+    void writeIndexCache(const IndexCache& cache, const std::filesystem::path& path);
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include <string_view>
 #include <vector>
 
+#include "fileindex.hpp"
 #include "filemap.hpp"
 #include "pathutil.hpp"
 
@@ -80,7 +81,9 @@ namespace VFS
     private:
         std::vector<std::unique_ptr<Archive>> mArchives;
 
+        // Ordered view is used only to iterate over directories, lookups go through mFileIndex
         FileMap mIndex;
+        FileIndex mFileIndex;
 
         inline Files::IStreamPtr findNormalized(std::string_view normalizedPath) const;
     };
@@ -1,31 +1,218 @@
 #include "registerarchives.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <filesystem>
+#include <optional>
 #include <set>
 #include <stdexcept>
+#include <system_error>
+#include <thread>
 
 #include <components/debug/debuglog.hpp>
 
+#include <components/files/conversion.hpp>
 #include <components/vfs/bsaarchive.hpp>
 #include <components/vfs/filesystemarchive.hpp>
+#include <components/vfs/indexcache.hpp>
 #include <components/vfs/manager.hpp>
 
 namespace VFS
 {
+    namespace
+    {
+        enum class ArchiveType
+        {
+            Bsa,
+            Directory,
+        };
+
+        struct PendingArchive
+        {
+            ArchiveType mType;
+            std::filesystem::path mPath;
+            std::unique_ptr<Archive> mArchive{};
+            std::exception_ptr mError{};
+            std::chrono::steady_clock::duration mLoadTime{};
+            bool mFromCache = false;
+            std::optional<DirectoryListing> mDirectoryListing{};
+            std::optional<BsaListing> mBsaListing{};
+        };
+
+        void loadBsaArchive(PendingArchive& pending, const IndexCache* cache)
+        {
+            if (cache != nullptr)
+            {
+                const std::optional<FileStamp> stamp = getFileStamp(pending.mPath);
+                if (stamp.has_value())
+                {
+                    const auto it = cache->mBsas.find(Files::pathToUnicodeString(pending.mPath));
+                    if (it != cache->mBsas.end() && it->second.mStamp == *stamp)
+                    {
+                        pending.mArchive = std::make_unique<BsaArchive<Bsa::BSAFile>>(
+                            pending.mPath, it->second.mFiles, it->second.mNames);
+                        pending.mFromCache = true;
+                        return;
+                    }
+
+                    // Only uncompressed archives support loading from the cached file table
+                    if (Bsa::BSAFile::detectVersion(pending.mPath) == Bsa::BsaVersion::Uncompressed)
+                    {
+                        auto archive = std::make_unique<BsaArchive<Bsa::BSAFile>>(pending.mPath);
+                        pending.mBsaListing = BsaListing{
+                            .mStamp = *stamp,
+                            .mFiles = archive->getBsaFile().getList(),
+                            .mNames = archive->getBsaFile().getNames(),
+                        };
+                        pending.mArchive = std::move(archive);
+                        return;
+                    }
+                }
+            }
+
+            pending.mArchive = makeBsaArchive(pending.mPath);
+        }
+
+        void loadDirectoryArchive(PendingArchive& pending, const IndexCache* cache)
+        {
+            if (cache != nullptr)
+            {
+                const auto it = cache->mDirectories.find(Files::pathToUnicodeString(pending.mPath));
+                if (it != cache->mDirectories.end() && isUpToDate(pending.mPath, it->second))
+                {
+                    pending.mArchive = std::make_unique<FileSystemArchive>(pending.mPath, it->second);
+                    pending.mFromCache = true;
+                    return;
+                }
+
+                DirectoryListing listing = listDirectory(pending.mPath);
+                pending.mArchive = std::make_unique<FileSystemArchive>(pending.mPath, listing);
+                pending.mDirectoryListing = std::move(listing);
+                return;
+            }
+
+            pending.mArchive = std::make_unique<FileSystemArchive>(pending.mPath);
+        }
+
+        void loadArchive(PendingArchive& pending, const IndexCache* cache)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                switch (pending.mType)
+                {
+                    case ArchiveType::Bsa:
+                        loadBsaArchive(pending, cache);
+                        break;
+                    case ArchiveType::Directory:
+                        loadDirectoryArchive(pending, cache);
+                        break;
+                }
+            }
+            catch (...)
+            {
+                pending.mError = std::current_exception();
+            }
+            pending.mLoadTime = std::chrono::steady_clock::now() - start;
+        }
+
+        // Archives are independent from each other so headers parsing and directories scanning are done in parallel.
+        // Results are stored by index to keep the priority order.
+        void loadArchives(std::vector<PendingArchive>& pending, const IndexCache* cache)
+        {
+            const std::size_t threadsCount
+                = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), pending.size());
+
+            if (threadsCount <= 1)
+            {
+                for (PendingArchive& v : pending)
+                    loadArchive(v, cache);
+                return;
+            }
+
+            std::atomic_size_t next{ 0 };
+            const auto worker = [&] {
+                for (std::size_t i = next++; i < pending.size(); i = next++)
+                    loadArchive(pending[i], cache);
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadsCount - 1);
+            for (std::size_t i = 1; i < threadsCount; ++i)
+                threads.emplace_back(worker);
+            worker();
+            for (std::thread& thread : threads)
+                thread.join();
+        }
+
+        template <class Map>
+        bool removeAbsentPaths(Map& map)
+        {
+            const std::size_t size = map.size();
+            std::erase_if(map, [](const auto& v) {
+                std::error_code ec;
+                return !std::filesystem::exists(Files::pathFromUnicodeString(v.first), ec);
+            });
+            return map.size() != size;
+        }
+
+        // Returns true if the cache is modified. Entries of archives not used by this run are kept because the same
+        // file is shared by the engine and the tools loading different sets of archives.
+        bool updateIndexCache(std::vector<PendingArchive>& pending, IndexCache& cache)
+        {
+            bool modified = false;
+
+            for (PendingArchive& v : pending)
+            {
+                switch (v.mType)
+                {
+                    case ArchiveType::Bsa:
+                        if (v.mBsaListing.has_value())
+                        {
+                            cache.mBsas.insert_or_assign(
+                                Files::pathToUnicodeString(v.mPath), std::move(*v.mBsaListing));
+                            modified = true;
+                        }
+                        break;
+                    case ArchiveType::Directory:
+                        if (v.mDirectoryListing.has_value())
+                        {
+                            cache.mDirectories.insert_or_assign(
+                                Files::pathToUnicodeString(v.mPath), std::move(*v.mDirectoryListing));
+                            modified = true;
+                        }
+                        break;
+                }
+            }
+
+            modified = removeAbsentPaths(cache.mBsas) || modified;
+            modified = removeAbsentPaths(cache.mDirectories) || modified;
+
+            return modified;
+        }
+
+        double toMilliseconds(std::chrono::steady_clock::duration value)
+        {
+            return std::chrono::duration<double, std::milli>(value).count();
+        }
+    }
 
     void registerArchives(VFS::Manager* vfs, const Files::Collections& collections,
-        const std::vector<std::string>& archives, bool useLooseFiles)
+        const std::vector<std::string>& archives, bool useLooseFiles, const std::filesystem::path& indexCachePath)
     {
         const Files::PathContainer& dataDirs = collections.getPaths();
 
+        std::vector<PendingArchive> pending;
+
         for (std::vector<std::string>::const_iterator archive = archives.begin(); archive != archives.end(); ++archive)
         {
             if (collections.doesExist(*archive))
             {
                 // Last BSA has the highest priority
-                const auto archivePath = collections.getPath(*archive);
-                Log(Debug::Info) << "Adding BSA archive " << archivePath;
-                vfs->addArchive(makeBsaArchive(archivePath));
+                pending.push_back(
+                    PendingArchive{ .mType = ArchiveType::Bsa, .mPath = collections.getPath(*archive) });
             }
             else
             {
@@ -40,16 +227,63 @@ namespace VFS
             {
                 if (seen.insert(dataDir).second)
                 {
-                    Log(Debug::Info) << "Adding data directory " << dataDir;
                     // Last data dir has the highest priority
-                    vfs->addArchive(std::make_unique<FileSystemArchive>(dataDir));
+                    pending.push_back(PendingArchive{ .mType = ArchiveType::Directory, .mPath = dataDir });
                 }
                 else
                     Log(Debug::Info) << "Ignoring duplicate data directory " << dataDir;
             }
         }
 
+        const auto start = std::chrono::steady_clock::now();
+
+        std::optional<IndexCache> cache;
+        if (!indexCachePath.empty())
+            cache = readIndexCache(indexCachePath);
+
+        loadArchives(pending, cache.has_value() ? &*cache : nullptr);
+
+        for (PendingArchive& v : pending)
+        {
+            if (v.mError != nullptr)
+                std::rethrow_exception(v.mError);
+
+            const std::string_view source = v.mFromCache ? ", cached" : "";
+            switch (v.mType)
+            {
+                case ArchiveType::Bsa:
+                    Log(Debug::Info) << "Adding BSA archive " << v.mPath << " (" << toMilliseconds(v.mLoadTime)
+                                     << " ms" << source << ")";
+                    break;
+                case ArchiveType::Directory:
+                    Log(Debug::Info) << "Adding data directory " << v.mPath << " (" << toMilliseconds(v.mLoadTime)
+                                     << " ms" << source << ")";
+                    break;
+            }
+
+            vfs->addArchive(std::move(v.mArchive));
+        }
+
+        const auto loaded = std::chrono::steady_clock::now();
+
         vfs->buildIndex();
+
+        const auto indexed = std::chrono::steady_clock::now();
+
+        Log(Debug::Info) << "Loaded " << pending.size() << " archives in " << toMilliseconds(loaded - start)
+                         << " ms, built VFS index in " << toMilliseconds(indexed - loaded) << " ms";
+
+        if (cache.has_value() && updateIndexCache(pending, *cache))
+        {
+            try
+            {
+                writeIndexCache(*cache, indexCachePath);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Warning) << "Failed to write VFS index cache " << indexCachePath << ": " << e.what();
+            }
+        }
     }
 
 }
@@ -3,13 +3,20 @@
 
 #include <components/files/collections.hpp>
 
+#include <filesystem>
+#include <string_view>
+
 namespace VFS
 {
     class Manager;
 
+    inline constexpr std::string_view indexCacheFileName = "vfsindex.bin";
+
     /// @brief Register BSA and file system archives based on the given OpenMW configuration.
+    /// @param indexCachePath Path to the snapshot of the archives content reused on the next run if none of them has
+    /// changed. Empty path disables the cache.
     void registerArchives(VFS::Manager* vfs, const Files::Collections& collections,
-        const std::vector<std::string>& archives, bool useLooseFiles);
+        const std::vector<std::string>& archives, bool useLooseFiles, const std::filesystem::path& indexCachePath = {});
 }
 
 #endif